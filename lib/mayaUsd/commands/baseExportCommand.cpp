@@ -170,6 +170,18 @@ MSyntax MayaUSDExportCommand::createSyntax()
         kExportBlendShapesFlag,
         UsdMayaJobExportArgsTokens->exportBlendShapes.GetText(),
         MSyntax::kBoolean);
+    syntax.addFlag(
+        kBlendShapeOffsetToleranceFlag,
+        UsdMayaJobExportArgsTokens->blendShapeOffsetTolerance.GetText(),
+        MSyntax::kDouble);
+    syntax.addFlag(
+        kMaxSkinInfluencesFlag,
+        UsdMayaJobExportArgsTokens->maxSkinInfluences.GetText(),
+        MSyntax::kLong);
+    syntax.addFlag(
+        kSkinWeightEpsilonFlag,
+        UsdMayaJobExportArgsTokens->skinWeightEpsilon.GetText(),
+        MSyntax::kDouble);
     syntax.addFlag(
         kParentScopeFlag,
         UsdMayaJobExportArgsTokens->parentScope.GetText(),
@@ -232,6 +244,10 @@ MSyntax MayaUSDExportCommand::createSyntax()
         kStaticSingleSample,
         UsdMayaJobExportArgsTokens->staticSingleSample.GetText(),
         MSyntax::kBoolean);
+    syntax.addFlag(
+        kProfileReportFlag,
+        UsdMayaJobExportArgsTokens->profileReport.GetText(),
+        MSyntax::kBoolean);
     syntax.addFlag(
         kGeomSidednessFlag, UsdMayaJobExportArgsTokens->geomSidedness.GetText(), MSyntax::kString);
 
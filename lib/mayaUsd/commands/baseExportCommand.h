@@ -75,6 +75,9 @@ public:
     static constexpr auto kExportSkelsFlag = "skl";
     static constexpr auto kExportSkinFlag = "skn";
     static constexpr auto kExportBlendShapesFlag = "ebs";
+    static constexpr auto kBlendShapeOffsetToleranceFlag = "bot";
+    static constexpr auto kMaxSkinInfluencesFlag = "msi";
+    static constexpr auto kSkinWeightEpsilonFlag = "swe";
     static constexpr auto kParentScopeFlag = "psc"; // deprecated
     static constexpr auto kRootPrimFlag = "rpm";
     static constexpr auto kRootPrimTypeFlag = "rpt";
@@ -92,6 +95,7 @@ public:
     static constexpr auto kPythonPostCallbackFlag = "ppc";
     static constexpr auto kVerboseFlag = "v";
     static constexpr auto kStaticSingleSample = "sss";
+    static constexpr auto kProfileReportFlag = "prf";
     static constexpr auto kGeomSidednessFlag = "gs";
     static constexpr auto kApiSchemaFlag = "api";
     static constexpr auto kJobContextFlag = "jc";
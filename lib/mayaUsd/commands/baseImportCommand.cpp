@@ -115,6 +115,10 @@ MSyntax MayaUSDImportCommand::createSyntax()
         kApplyEulerFilterFlag,
         UsdMayaJobImportArgsTokens->applyEulerFilter.GetText(),
         MSyntax::kBoolean);
+    syntax.addFlag(
+        kProfileReportFlag,
+        UsdMayaJobImportArgsTokens->profileReport.GetText(),
+        MSyntax::kBoolean);
 
     // These are additional flags under our control.
     syntax.addFlag(kFileFlag, kFileFlagLong, MSyntax::kString);
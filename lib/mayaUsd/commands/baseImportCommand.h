@@ -56,6 +56,7 @@ public:
     static constexpr auto kImportChaserArgsFlag = "cha";
     static constexpr auto kRemapUVSetsToFlag = "ruv";
     static constexpr auto kApplyEulerFilterFlag = "aef";
+    static constexpr auto kProfileReportFlag = "prf";
 
     // Short and Long forms of flags defined by this command itself:
     static constexpr auto kFileFlag = "f";
@@ -30,6 +30,8 @@ public:
 
     bool Read(UsdMayaPrimReaderContext& context) override;
 
+    bool MayPruneChildren() const override { return false; }
+
     static UsdMayaPrimReaderRegistry::ReaderFactoryFn CreateFactory();
 };
 
@@ -73,6 +73,13 @@ bool UsdMaya_FunctorPrimWriter::ExportsGprims() const { return _exportsGprims; }
 /* virtual */
 bool UsdMaya_FunctorPrimWriter::ShouldPruneChildren() const { return _pruneChildren; }
 
+/* virtual */
+bool UsdMaya_FunctorPrimWriter::IsAnimated() const
+{
+    // The functor may write anything at each time sample.
+    return true;
+}
+
 /* virtual */
 const SdfPathVector& UsdMaya_FunctorPrimWriter::GetModelPaths() const { return _modelPaths; }
 
@@ -48,6 +48,7 @@
 
 #include <ghc/filesystem.hpp>
 
+#include <algorithm>
 #include <cstdlib>
 #include <mutex>
 #include <ostream>
@@ -637,7 +638,13 @@ UsdMayaJobExportArgs::UsdMayaJobExportArgs(
           UsdMayaJobExportArgsTokens->exportSkin,
           UsdMayaJobExportArgsTokens->none,
           { UsdMayaJobExportArgsTokens->auto_, UsdMayaJobExportArgsTokens->explicit_ }))
+    , maxSkinInfluences(
+          std::max(0, extractInt(userArgs, UsdMayaJobExportArgsTokens->maxSkinInfluences, 0)))
+    , skinWeightEpsilon(
+          extractDouble(userArgs, UsdMayaJobExportArgsTokens->skinWeightEpsilon, 1e-8))
     , exportBlendShapes(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->exportBlendShapes))
+    , blendShapeOffsetTolerance(
+          extractDouble(userArgs, UsdMayaJobExportArgsTokens->blendShapeOffsetTolerance, 1e-5))
     , exportVisibility(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->exportVisibility))
     , exportComponentTags(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->exportComponentTags))
     , file(extractString(userArgs, UsdMayaJobExportArgsTokens->file))
@@ -684,6 +691,7 @@ UsdMayaJobExportArgs::UsdMayaJobExportArgs(
           extractTokenSet(userArgs, UsdMayaJobExportArgsTokens->convertMaterialsTo))
     , verbose(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->verbose))
     , staticSingleSample(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->staticSingleSample))
+    , profileReport(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->profileReport))
     , geomSidedness(extractToken(
           userArgs,
           UsdMayaJobExportArgsTokens->geomSidedness,
@@ -747,7 +755,11 @@ std::ostream& operator<<(std::ostream& out, const UsdMayaJobExportArgs& exportAr
         << "exportSelected: " << TfStringify(exportArgs.exportSelected) << std::endl
         << "exportSkels: " << TfStringify(exportArgs.exportSkels) << std::endl
         << "exportSkin: " << TfStringify(exportArgs.exportSkin) << std::endl
+        << "maxSkinInfluences: " << TfStringify(exportArgs.maxSkinInfluences) << std::endl
+        << "skinWeightEpsilon: " << TfStringify(exportArgs.skinWeightEpsilon) << std::endl
         << "exportBlendShapes: " << TfStringify(exportArgs.exportBlendShapes) << std::endl
+        << "blendShapeOffsetTolerance: " << TfStringify(exportArgs.blendShapeOffsetTolerance)
+        << std::endl
         << "exportVisibility: " << TfStringify(exportArgs.exportVisibility) << std::endl
         << "exportComponentTags: " << TfStringify(exportArgs.exportComponentTags) << std::endl
         << "file: " << exportArgs.file << std::endl
@@ -784,6 +796,7 @@ std::ostream& operator<<(std::ostream& out, const UsdMayaJobExportArgs& exportAr
         << "worldspace: " << TfStringify(exportArgs.worldspace) << std::endl
         << "timeSamples: " << exportArgs.timeSamples.size() << " sample(s)" << std::endl
         << "staticSingleSample: " << TfStringify(exportArgs.staticSingleSample) << std::endl
+        << "profileReport: " << TfStringify(exportArgs.profileReport) << std::endl
         << "geomSidedness: " << TfStringify(exportArgs.geomSidedness) << std::endl
         << "usdModelRootOverridePath: " << exportArgs.usdModelRootOverridePath << std::endl;
 
@@ -1033,7 +1046,10 @@ const VtDictionary& UsdMayaJobExportArgs::GetDefaultDictionary()
         d[UsdMayaJobExportArgsTokens->exportSelected] = false;
         d[UsdMayaJobExportArgsTokens->exportSkin] = UsdMayaJobExportArgsTokens->none.GetString();
         d[UsdMayaJobExportArgsTokens->exportSkels] = UsdMayaJobExportArgsTokens->none.GetString();
+        d[UsdMayaJobExportArgsTokens->maxSkinInfluences] = 0;
+        d[UsdMayaJobExportArgsTokens->skinWeightEpsilon] = 1e-8;
         d[UsdMayaJobExportArgsTokens->exportBlendShapes] = false;
+        d[UsdMayaJobExportArgsTokens->blendShapeOffsetTolerance] = 1e-5;
         d[UsdMayaJobExportArgsTokens->exportUVs] = true;
         d[UsdMayaJobExportArgsTokens->exportRelativeTextures]
             = UsdMayaJobExportArgsTokens->automatic.GetString();
@@ -1071,6 +1087,7 @@ const VtDictionary& UsdMayaJobExportArgs::GetDefaultDictionary()
         d[UsdMayaJobExportArgsTokens->worldspace] = false;
         d[UsdMayaJobExportArgsTokens->verbose] = false;
         d[UsdMayaJobExportArgsTokens->staticSingleSample] = false;
+        d[UsdMayaJobExportArgsTokens->profileReport] = false;
         d[UsdMayaJobExportArgsTokens->geomSidedness]
             = UsdMayaJobExportArgsTokens->derived.GetString();
         d[UsdMayaJobExportArgsTokens->customLayerData] = std::vector<VtValue>();
@@ -1098,6 +1115,7 @@ const VtDictionary& UsdMayaJobExportArgs::GetGuideDictionary()
         // Common types:
         const auto _boolean = VtValue(false);
         const auto _double = VtValue(0.0);
+        const auto _int = VtValue(0);
         const auto _string = VtValue(std::string());
         const auto _doubleVector = VtValue(std::vector<double>());
         const auto _stringVector = VtValue(std::vector<VtValue>({ _string }));
@@ -1137,7 +1155,10 @@ const VtDictionary& UsdMayaJobExportArgs::GetGuideDictionary()
         d[UsdMayaJobExportArgsTokens->exportSkin] = _string;
         d[UsdMayaJobExportArgsTokens->exportSelected] = _boolean;
         d[UsdMayaJobExportArgsTokens->exportSkels] = _string;
+        d[UsdMayaJobExportArgsTokens->maxSkinInfluences] = _int;
+        d[UsdMayaJobExportArgsTokens->skinWeightEpsilon] = _double;
         d[UsdMayaJobExportArgsTokens->exportBlendShapes] = _boolean;
+        d[UsdMayaJobExportArgsTokens->blendShapeOffsetTolerance] = _double;
         d[UsdMayaJobExportArgsTokens->exportUVs] = _boolean;
         d[UsdMayaJobExportArgsTokens->exportRelativeTextures] = _string;
         d[UsdMayaJobExportArgsTokens->exportVisibility] = _boolean;
@@ -1171,6 +1192,7 @@ const VtDictionary& UsdMayaJobExportArgs::GetGuideDictionary()
         d[UsdMayaJobExportArgsTokens->worldspace] = _boolean;
         d[UsdMayaJobExportArgsTokens->verbose] = _boolean;
         d[UsdMayaJobExportArgsTokens->staticSingleSample] = _boolean;
+        d[UsdMayaJobExportArgsTokens->profileReport] = _boolean;
         d[UsdMayaJobExportArgsTokens->geomSidedness] = _string;
         d[UsdMayaJobExportArgsTokens->excludeExportTypes] = _stringVector;
         d[UsdMayaJobExportArgsTokens->defaultPrim] = _string;
@@ -1267,6 +1289,7 @@ UsdMayaJobImportArgs::UsdMayaJobImportArgs(
     , importWithProxyShapes(importWithProxyShapes)
     , preserveTimeline(extractBoolean(userArgs, UsdMayaJobImportArgsTokens->preserveTimeline))
     , applyEulerFilter(extractBoolean(userArgs, UsdMayaJobImportArgsTokens->applyEulerFilter))
+    , profileReport(extractBoolean(userArgs, UsdMayaJobImportArgsTokens->profileReport))
     , pullImportStage(extractUsdStageRefPtr(userArgs, UsdMayaJobImportArgsTokens->pullImportStage))
     , timeInterval(timeInterval)
     , chaserNames(extractVector<std::string>(userArgs, UsdMayaJobImportArgsTokens->chaser))
@@ -1364,6 +1387,7 @@ const VtDictionary& UsdMayaJobImportArgs::GetDefaultDictionary()
         d[UsdMayaJobImportArgsTokens->chaserArgs] = std::vector<VtValue>();
         d[UsdMayaJobImportArgsTokens->remapUVSetsTo] = std::vector<VtValue>();
         d[UsdMayaJobImportArgsTokens->applyEulerFilter] = false;
+        d[UsdMayaJobImportArgsTokens->profileReport] = false;
 
         // plugInfo.json site defaults.
         // The defaults dict should be correctly-typed, so enable
@@ -1446,6 +1470,7 @@ const VtDictionary& UsdMayaJobImportArgs::GetGuideDictionary()
         d[UsdMayaJobImportArgsTokens->chaserArgs] = _stringTripletVector;
         d[UsdMayaJobImportArgsTokens->remapUVSetsTo] = _stringPairVector;
         d[UsdMayaJobImportArgsTokens->applyEulerFilter] = _boolean;
+        d[UsdMayaJobImportArgsTokens->profileReport] = _boolean;
     });
 
     return d;
@@ -1535,7 +1560,8 @@ std::ostream& operator<<(std::ostream& out, const UsdMayaJobImportArgs& importAr
         << "useAsAnimationCache: " << TfStringify(importArgs.useAsAnimationCache) << std::endl
         << "preserveTimeline: " << TfStringify(importArgs.preserveTimeline) << std::endl
         << "importWithProxyShapes: " << TfStringify(importArgs.importWithProxyShapes) << std::endl
-        << "applyEulerFilter: " << importArgs.applyEulerFilter << std::endl;
+        << "applyEulerFilter: " << importArgs.applyEulerFilter << std::endl
+        << "profileReport: " << TfStringify(importArgs.profileReport) << std::endl;
 
     out << "jobContextNames (" << importArgs.jobContextNames.size() << ")" << std::endl;
     for (const std::string& jobContextName : importArgs.jobContextNames) {
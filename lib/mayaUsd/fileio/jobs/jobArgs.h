@@ -59,6 +59,7 @@ TF_DECLARE_PUBLIC_TOKENS(
     (frameStride) \
     (frameSample) \
     (apiSchema) \
+    (blendShapeOffsetTolerance) \
     (chaser) \
     (chaserArgs) \
     (compatibility) \
@@ -98,9 +99,11 @@ TF_DECLARE_PUBLIC_TOKENS(
     (materialsScopeName) \
     (melPerFrameCallback) \
     (melPostCallback) \
+    (maxSkinInfluences) \
     (mergeTransformAndShape) \
     (normalizeNurbs) \
     (preserveUVSetNames) \
+    (profileReport) \
     /* Deprecated and replaced by rootPrim */ \
     (parentScope) \
     (rootPrim) \
@@ -112,6 +115,7 @@ TF_DECLARE_PUBLIC_TOKENS(
     (shadingMode) \
     (convertMaterialsTo) \
     (remapUVSetsTo) \
+    (skinWeightEpsilon) \
     (stripNamespaces) \
     (verbose) \
     (staticSingleSample) \
@@ -172,6 +176,7 @@ TF_DECLARE_PUBLIC_TOKENS(
     (importRelativeTextures) \
     (pullImportStage) \
     (preserveTimeline) \
+    (profileReport) \
     (remapUVSetsTo) \
     /* values for import relative textures */ \
     (automatic) \
@@ -224,7 +229,10 @@ struct UsdMayaJobExportArgs
     const bool        exportSelected;
     const TfToken     exportSkels;
     const TfToken     exportSkin;
+    const int         maxSkinInfluences;
+    const double      skinWeightEpsilon;
     const bool        exportBlendShapes;
+    const double      blendShapeOffsetTolerance;
     const bool        exportVisibility;
     const bool        exportComponentTags;
     const std::string file;
@@ -264,6 +272,7 @@ struct UsdMayaJobExportArgs
     const TfToken::Set allMaterialConversions;
     const bool         verbose;
     const bool         staticSingleSample;
+    const bool         profileReport;
     const TfToken      geomSidedness;
     const TfToken::Set includeAPINames;
     const TfToken::Set jobContextNames;
@@ -402,6 +411,7 @@ struct UsdMayaJobImportArgs
     const bool           importWithProxyShapes;
     const bool           preserveTimeline;
     const bool           applyEulerFilter;
+    const bool           profileReport;
     const UsdStageRefPtr pullImportStage;
     /// The interval over which to import animated data.
     /// An empty interval (<tt>GfInterval::IsEmpty()</tt>) means that no
@@ -0,0 +1,182 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "jobProfiler.h"
+
+#include <pxr/base/arch/demangle.h>
+#include <pxr/base/arch/timing.h>
+#include <pxr/base/js/json.h>
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/mallocTag.h>
+#include <pxr/base/trace/collector.h>
+
+#include <maya/MProfiler.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+//! Profiler category for read and write job events
+const int _jobProfilerCategory
+    = MProfiler::addCategory("UsdMayaJob", "mayaUsd import and export job events");
+
+int64_t _GetAllocatedBytes()
+{
+    return TfMallocTag::IsInitialized() ? static_cast<int64_t>(TfMallocTag::GetTotalBytes()) : 0;
+}
+
+} // namespace
+
+UsdMaya_JobProfiler::UsdMaya_JobProfiler(bool reportEnabled)
+    : _reportEnabled(reportEnabled)
+{
+}
+
+/* static */
+int UsdMaya_JobProfiler::GetProfilerCategory() { return _jobProfilerCategory; }
+
+/* static */
+std::string UsdMaya_JobProfiler::GetReportFileName(const std::string& fileName)
+{
+    return fileName + ".profile.json";
+}
+
+void UsdMaya_JobProfiler::_AddSample(const std::string& key, double seconds, int64_t netBytes)
+{
+    _TranslatorStats& stats = _stats[key];
+    stats.seconds.push_back(seconds);
+    stats.netBytes += netBytes;
+}
+
+bool UsdMaya_JobProfiler::WriteReport(const std::string& reportFileName) const
+{
+    if (!_reportEnabled) {
+        return false;
+    }
+
+    struct _Row
+    {
+        std::string name;
+        size_t      count;
+        double      total;
+        double      p95;
+        int64_t     netBytes;
+    };
+    std::vector<_Row> rows;
+    rows.reserve(_stats.size());
+    for (const auto& entry : _stats) {
+        std::vector<double> seconds = entry.second.seconds;
+        if (seconds.empty()) {
+            continue;
+        }
+
+        double total = 0.0;
+        for (double sample : seconds) {
+            total += sample;
+        }
+
+        // Nearest-rank 95th percentile.
+        const size_t p95Rank = static_cast<size_t>(std::ceil(0.95 * seconds.size()));
+        const size_t p95Index = std::max<size_t>(p95Rank, 1) - 1;
+        std::nth_element(seconds.begin(), seconds.begin() + p95Index, seconds.end());
+
+        rows.push_back(
+            { entry.first, seconds.size(), total, seconds[p95Index], entry.second.netBytes });
+    }
+
+    // Slowest translators first.
+    std::sort(
+        rows.begin(), rows.end(), [](const _Row& a, const _Row& b) { return a.total > b.total; });
+
+    JsArray translators;
+    for (const _Row& row : rows) {
+        JsObject translator;
+        translator["name"] = row.name;
+        translator["count"] = static_cast<int64_t>(row.count);
+        translator["total"] = row.total;
+        translator["mean"] = row.total / row.count;
+        translator["p95"] = row.p95;
+        if (TfMallocTag::IsInitialized()) {
+            translator["netBytes"] = row.netBytes;
+        }
+        translators.push_back(translator);
+    }
+
+    JsObject report;
+    report["translators"] = translators;
+
+    std::ofstream reportFile(reportFileName);
+    if (!reportFile) {
+        TF_WARN("Could not write the profile report to '%s'", reportFileName.c_str());
+        return false;
+    }
+    JsWriteToStream(report, reportFile);
+    return true;
+}
+
+UsdMaya_JobProfiler::Scope::Scope(
+    UsdMaya_JobProfiler&  profiler,
+    const char*           eventName,
+    const TfToken&        primType,
+    const std::type_info& translatorType)
+{
+    const bool profiling = MProfiler::isCategoryEnabled(_jobProfilerCategory);
+    _traced = TraceCollector::IsEnabled();
+    if (!profiler._reportEnabled && !profiling && !_traced) {
+        return;
+    }
+
+    // Only pay for the demangling when someone is listening.
+    const std::string translatorName = ArchGetDemangled(translatorType);
+    _key = eventName;
+    if (primType.IsEmpty()) {
+        _key += " " + translatorName;
+    } else {
+        _key += " " + primType.GetString() + " (" + translatorName + ")";
+    }
+
+    if (_traced) {
+        TraceCollector::GetInstance().BeginEvent(TraceCollector::Key(_key));
+    }
+    if (profiling) {
+        _profilerEventId = MProfiler::eventBegin(
+            _jobProfilerCategory, MProfiler::kColorC_L1, eventName, _key.c_str());
+    }
+    if (profiler._reportEnabled) {
+        _profiler = &profiler;
+        _startTicks = ArchGetTickTime();
+        _startBytes = _GetAllocatedBytes();
+    }
+}
+
+UsdMaya_JobProfiler::Scope::~Scope()
+{
+    if (_profiler) {
+        const double seconds = ArchTicksToSeconds(ArchGetTickTime() - _startTicks);
+        _profiler->_AddSample(_key, seconds, _GetAllocatedBytes() - _startBytes);
+    }
+    if (_profilerEventId >= 0) {
+        MProfiler::eventEnd(_profilerEventId);
+    }
+    if (_traced) {
+        TraceCollector::GetInstance().EndEvent(TraceCollector::Key(_key));
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,107 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef PXRUSDMAYA_JOB_PROFILER_H
+#define PXRUSDMAYA_JOB_PROFILER_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/tf/token.h>
+#include <pxr/pxr.h>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// This class instruments the prim readers, prim writers and chasers invoked
+/// by UsdMaya_ReadJob and UsdMaya_WriteJob.
+///
+/// Each invocation is wrapped in a UsdMaya_JobProfiler::Scope, which opens a
+/// Trace event and a Maya profiler event named after the prim type and the
+/// translator class, so that slow translators show up in both the USD trace
+/// tools and the Maya Profiler window. When the report is enabled, the
+/// duration and net allocation of every invocation is also accumulated per
+/// translator and can be written out as JSON with WriteReport().
+class UsdMaya_JobProfiler
+{
+public:
+    MAYAUSD_CORE_PUBLIC
+    UsdMaya_JobProfiler(bool reportEnabled);
+
+    /// Returns the Maya profiler category used by the read and write jobs.
+    MAYAUSD_CORE_PUBLIC
+    static int GetProfilerCategory();
+
+    /// Returns the path of the report written next to \p fileName.
+    MAYAUSD_CORE_PUBLIC
+    static std::string GetReportFileName(const std::string& fileName);
+
+    /// Writes the aggregated per-translator report to \p reportFileName.
+    /// For each translator, the number of invocations, the total, mean and
+    /// 95th percentile durations in seconds and, when malloc tagging is
+    /// active, the net number of bytes allocated are reported.
+    /// Returns \c false if the report is disabled or could not be written.
+    MAYAUSD_CORE_PUBLIC
+    bool WriteReport(const std::string& reportFileName) const;
+
+    /// RAII helper timing a single translator invocation.
+    class Scope
+    {
+    public:
+        /// Starts timing \p eventName (e.g. "Prim writer") for the translator
+        /// of class \p translatorType, handling a prim of type \p primType.
+        /// \p primType may be empty, e.g. for chasers.
+        MAYAUSD_CORE_PUBLIC
+        Scope(
+            UsdMaya_JobProfiler&  profiler,
+            const char*           eventName,
+            const TfToken&        primType,
+            const std::type_info& translatorType);
+
+        MAYAUSD_CORE_PUBLIC
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        UsdMaya_JobProfiler* _profiler = nullptr;
+        std::string          _key;
+        int                  _profilerEventId = -1;
+        bool                 _traced = false;
+        uint64_t             _startTicks = 0;
+        int64_t              _startBytes = 0;
+    };
+
+private:
+    struct _TranslatorStats
+    {
+        std::vector<double> seconds;
+        int64_t             netBytes = 0;
+    };
+
+    void _AddSample(const std::string& key, double seconds, int64_t netBytes);
+
+    bool                                    _reportEnabled;
+    std::map<std::string, _TranslatorStats> _stats;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -28,7 +28,11 @@
 #include <mayaUsd/utils/utilFileSystem.h>
 
 #include <pxr/base/tf/debug.h>
+#include <pxr/base/tf/envSetting.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/work/dispatcher.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/fileFormat.h>
 #include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/sdf/path.h>
@@ -56,10 +60,13 @@
 #include <maya/MItDependencyGraph.h>
 #include <maya/MObject.h>
 #include <maya/MPlug.h>
+#include <maya/MProfiler.h>
 #include <maya/MStatus.h>
 #include <maya/MTime.h>
 
+#include <algorithm>
 #include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -67,6 +74,12 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_IMPORT_PREFETCH_BATCH_SIZE,
+    0,
+    "Number of prims whose USD data is prefetched on worker threads while the "
+    "preceding prims are imported. The prefetching is disabled when 0.");
+
 namespace {
 // Simple RAII class to ensure tracking does not extend past the scope.
 struct TempNodeTrackerScope
@@ -178,6 +191,179 @@ void ApplyVariantSelections(const UsdPrim& prim, const SdfVariantSelectionMap& s
 
 } // namespace
 
+/// Creates the prim readers of a traversal ahead of the main thread, in
+/// batches, and runs the Prefetch step of the readers that have one on worker
+/// threads. While the main thread reads the prims of one batch, the USD data
+/// of the next batch is being pulled and decoded.
+///
+/// Only the readers of prims that the traversal is sure to read are created
+/// ahead: the readers of the descendants of a prim that is not read yet are
+/// only created when the reader of that prim does not prune its children.
+/// The prefetching only goes on while readers that have a Prefetch step are
+/// read, since the other readers may author on the stage.
+class UsdMaya_ReadJob::_PrimReaderPrefetcher
+{
+public:
+    _PrimReaderPrefetcher(
+        std::vector<UsdPrim>&&      prims,
+        const UsdMayaJobImportArgs& args,
+        size_t                      batchSize)
+        : _args(args)
+        , _prims(std::move(prims))
+        , _readers(_prims.size())
+        , _parents(_prims.size(), _noIndex)
+        , _subtreeEnds(_prims.size())
+        , _mayPrune(_prims.size(), true)
+        , _batchSize(batchSize)
+    {
+        // The prims are in traversal order, so the ancestors of a prim that
+        // are in the list are the prims still open when it is reached.
+        std::vector<size_t> openPrims;
+        for (size_t i = 0; i < _prims.size(); ++i) {
+            while (!openPrims.empty()
+                   && !_prims[i].GetPath().HasPrefix(_prims[openPrims.back()].GetPath())) {
+                _subtreeEnds[openPrims.back()] = i;
+                openPrims.pop_back();
+            }
+            if (!openPrims.empty()) {
+                _parents[i] = openPrims.back();
+            }
+            openPrims.push_back(i);
+        }
+        for (const size_t i : openPrims) {
+            _subtreeEnds[i] = _prims.size();
+        }
+    }
+
+    ~_PrimReaderPrefetcher() { _dispatcher.Wait(); }
+
+    /// Returns the reader created ahead of time for \p prim, or null if there
+    /// is none. Prims must be requested in traversal order; the readers of the
+    /// prims skipped in between, e.g. because an overridden prim reader pruned
+    /// their parent, are discarded.
+    UsdMayaPrimReaderSharedPtr TakeReader(const UsdPrim& prim)
+    {
+        size_t index = _cursor;
+        while (index < _prims.size() && _prims[index] != prim) {
+            ++index;
+        }
+        if (index == _prims.size()) {
+            return nullptr;
+        }
+
+        if (index >= _readyEnd) {
+            // Wait for the batch in flight. If the traversal skipped past it,
+            // prefetch the batch starting at this prim right away.
+            Drain();
+            if (index >= _readyEnd) {
+                _Schedule(index, index);
+                Drain();
+            }
+        }
+
+        // No worker touches the readers before _readyEnd anymore.
+        for (size_t i = _cursor; i < index; ++i) {
+            _readers[i].reset();
+        }
+        _cursor = index + 1;
+
+        // Keep the next batch in flight while a reader that has a Prefetch
+        // step is read.
+        UsdMayaPrimReaderSharedPtr reader = std::move(_readers[index]);
+        if (reader && reader->HasPrefetch() && _pendingEnd == _readyEnd) {
+            _Schedule(_readyEnd, index);
+        }
+        return reader;
+    }
+
+    /// Waits for the batch in flight, so that the stage can be authored.
+    void Drain()
+    {
+        _dispatcher.Wait();
+        _readyEnd = _pendingEnd;
+    }
+
+private:
+    static constexpr size_t _noIndex = static_cast<size_t>(-1);
+
+    /// Whether the traversal is sure to read the prim at \p index once the
+    /// prim at \p readIndex is read.
+    bool _WillBeRead(size_t index, size_t readIndex) const
+    {
+        for (size_t parent = _parents[index]; parent != _noIndex && parent >= readIndex;
+             parent = _parents[parent]) {
+            if (_mayPrune[parent]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void _Schedule(size_t begin, size_t readIndex)
+    {
+        const size_t end = std::min(begin + _batchSize, _prims.size());
+        if (begin >= end) {
+            return;
+        }
+        _pendingEnd = end;
+
+        // The reader factories may be implemented in Python, so the readers
+        // are created on the main thread.
+        bool hasPrefetch = false;
+        for (size_t i = begin; i < end;) {
+            if (!_WillBeRead(i, readIndex)) {
+                i = _subtreeEnds[i];
+                continue;
+            }
+
+            const UsdPrim& prim = _prims[i];
+            if (UsdMayaPrimReaderRegistry::ReaderFactoryFn factoryFn
+                = UsdMayaPrimReaderRegistry::FindOrFallback(prim.GetTypeName(), _args, prim)) {
+                _readers[i] = factoryFn(UsdMayaPrimReaderArgs(prim, _args));
+            }
+            const UsdMayaPrimReaderSharedPtr& reader = _readers[i];
+            _mayPrune[i] = reader && reader->MayPruneChildren();
+            hasPrefetch = hasPrefetch || (reader && reader->HasPrefetch());
+            ++i;
+        }
+        if (!hasPrefetch) {
+            return;
+        }
+
+        _dispatcher.Run([this, begin, end]() {
+            WorkParallelForN(end - begin, [this, begin](size_t first, size_t last) {
+                for (size_t i = begin + first; i < begin + last; ++i) {
+                    const UsdMayaPrimReaderSharedPtr& reader = _readers[i];
+                    if (reader && reader->HasPrefetch()) {
+                        reader->Prefetch();
+                    }
+                }
+            });
+        });
+    }
+
+    const UsdMayaJobImportArgs&             _args;
+    std::vector<UsdPrim>                    _prims;
+    std::vector<UsdMayaPrimReaderSharedPtr> _readers;
+    // Index of the closest ancestor of each prim in the list, or _noIndex.
+    std::vector<size_t> _parents;
+    // Index following the last descendant of each prim.
+    std::vector<size_t> _subtreeEnds;
+    // Whether the reader of each prim may prune its children. It is only
+    // known for the readers created ahead of time.
+    std::vector<bool> _mayPrune;
+    const size_t      _batchSize;
+
+    // Index of the next prim expected by TakeReader.
+    size_t _cursor = 0;
+    // The readers before _readyEnd are created and prefetched, those in
+    // [_readyEnd, _pendingEnd) are being prefetched.
+    size_t _readyEnd = 0;
+    size_t _pendingEnd = 0;
+
+    WorkDispatcher _dispatcher;
+};
+
 UsdMaya_ReadJob::UsdMaya_ReadJob(
     const MayaUsd::ImportData&  iImportData,
     const UsdMayaJobImportArgs& iArgs)
@@ -186,6 +372,7 @@ UsdMaya_ReadJob::UsdMaya_ReadJob(
     , mMayaRootDagPath()
     , mDagModifierUndo()
     , mDagModifierSeeded(false)
+    , mProfiler(iArgs.profileReport)
 {
 }
 
@@ -193,6 +380,10 @@ UsdMaya_ReadJob::~UsdMaya_ReadJob() { }
 
 bool UsdMaya_ReadJob::Read(std::vector<MDagPath>* addedDagPaths)
 {
+    TRACE_SCOPE("UsdMaya_ReadJob::Read");
+    MProfilingScope profilingScope(
+        UsdMaya_JobProfiler::GetProfilerCategory(), MProfiler::kColorC_L3, "Read job");
+
     // When we are called from PrimUpdaterManager we should already have
     // a computation scope. If we are called from elsewhere don't show any
     // progress bar here.
@@ -470,6 +661,8 @@ bool UsdMaya_ReadJob::Read(std::vector<MDagPath>* addedDagPaths)
     progressBar.advance();
 
     for (const UsdMayaImportChaserRefPtr& chaser : this->mImportChasers) {
+        UsdMaya_JobProfiler::Scope profilerScope(
+            mProfiler, "Import chaser post import", TfToken(), typeid(*chaser));
         chaser->SetSdfToDagMap(sdfToDagMap);
         bool bStat
             = chaser->PostImport(predicate, stage, currentAddedDagPaths, fromSdfPaths, this->mArgs);
@@ -482,6 +675,10 @@ bool UsdMaya_ReadJob::Read(std::vector<MDagPath>* addedDagPaths)
 
     UsdMayaReadUtil::mapFileHashes.clear();
 
+    if (mArgs.profileReport) {
+        mProfiler.WriteReport(UsdMaya_JobProfiler::GetReportFileName(mImportData.filename()));
+    }
+
     return (status == MS::kSuccess);
 }
 
@@ -504,7 +701,8 @@ void UsdMaya_ReadJob::_DoImportPrimIt(
     UsdPrimRange::iterator&   primIt,
     const UsdPrim&            usdRootPrim,
     UsdMayaPrimReaderContext& readCtx,
-    _PrimReaderMap&           primReaderMap)
+    _PrimReaderMap&           primReaderMap,
+    _PrimReaderPrefetcher*    prefetcher)
 {
     const UsdPrim& prim = *primIt;
     // The iterator will hit each prim twice. IsPostVisit tells us if
@@ -515,30 +713,50 @@ void UsdMaya_ReadJob::_DoImportPrimIt(
         // specified one.
         auto primReaderIt = primReaderMap.find(prim.GetPath());
         if (primReaderIt != primReaderMap.end()) {
+            if (prefetcher) {
+                prefetcher->Drain();
+            }
+            UsdMaya_JobProfiler::Scope profilerScope(
+                mProfiler,
+                "Prim reader post read subtree",
+                prim.GetTypeName(),
+                typeid(*primReaderIt->second));
             primReaderIt->second->PostReadSubtree(readCtx);
         }
     } else {
-        // This is the normal Read step (pre-visit).
+        // This is the normal Read step (pre-visit). Readers and prim reader
+        // overrides may author on the stage, so the prefetching has to stop
+        // first. TakeReader() only starts prefetching the next batch again
+        // when it returns a reader that has a Prefetch step.
+        if (prefetcher) {
+            prefetcher->Drain();
+        }
         UsdMayaPrimReaderArgs args(prim, mArgs);
         if (OverridePrimReader(usdRootPrim, prim, args, readCtx, primIt)) {
             return;
         }
 
-        TfToken typeName = prim.GetTypeName();
-        if (UsdMayaPrimReaderRegistry::ReaderFactoryFn factoryFn
-            = UsdMayaPrimReaderRegistry::FindOrFallback(typeName, mArgs, prim)) {
-            UsdMayaPrimReaderSharedPtr primReader = factoryFn(args);
-            if (primReader) {
-                TempNodeTrackerScope scope(readCtx);
-                primReader->Read(readCtx);
-                if (primReader->HasPostReadSubtree()) {
-                    primReaderMap[prim.GetPath()] = primReader;
-                }
-                if (readCtx.GetPruneChildren()) {
-                    primIt.PruneChildren();
-                }
-                UsdMayaReadUtil::ReadAPISchemaAttributesFromPrim(args, readCtx);
+        TfToken                    typeName = prim.GetTypeName();
+        UsdMayaPrimReaderSharedPtr primReader
+            = prefetcher ? prefetcher->TakeReader(prim) : UsdMayaPrimReaderSharedPtr();
+        if (!primReader) {
+            if (UsdMayaPrimReaderRegistry::ReaderFactoryFn factoryFn
+                = UsdMayaPrimReaderRegistry::FindOrFallback(typeName, mArgs, prim)) {
+                primReader = factoryFn(args);
+            }
+        }
+        if (primReader) {
+            TempNodeTrackerScope       scope(readCtx);
+            UsdMaya_JobProfiler::Scope profilerScope(
+                mProfiler, "Prim reader", typeName, typeid(*primReader));
+            primReader->Read(readCtx);
+            if (primReader->HasPostReadSubtree()) {
+                primReaderMap[prim.GetPath()] = primReader;
+            }
+            if (readCtx.GetPruneChildren()) {
+                primIt.PruneChildren();
             }
+            UsdMayaReadUtil::ReadAPISchemaAttributesFromPrim(args, readCtx);
         }
     }
 }
@@ -618,7 +836,12 @@ void UsdMaya_ReadJob::_ImportPrototype(
 
 bool UsdMaya_ReadJob::_DoImport(UsdPrimRange& rootRange, const UsdPrim& usdRootPrim)
 {
+    TRACE_SCOPE("UsdMaya_ReadJob::_DoImport");
+    MProfilingScope profilingScope(
+        UsdMaya_JobProfiler::GetProfilerCategory(), MProfiler::kColorC_L2, "Import prims");
+
     const bool buildInstances = mArgs.importInstances;
+    const int  prefetchBatchSize = TfGetEnvSetting(MAYAUSD_IMPORT_PREFETCH_BATCH_SIZE);
 
     MayaUsd::ProgressBarScope progressBar(0);
 
@@ -635,7 +858,24 @@ bool UsdMaya_ReadJob::_DoImport(UsdPrimRange& rootRange, const UsdPrim& usdRootP
             : UsdPrimRange::PreAndPostVisit(
                 rootPrim, UsdTraverseInstanceProxies(UsdPrimAllPrimsPredicate));
 
-        const int                     loopSize = std::distance(range.begin(), range.end());
+        // Traverse the range once to size the progress bar and to gather the
+        // prims whose readers can be created and prefetched ahead of time.
+        int                  loopSize = 0;
+        std::vector<UsdPrim> readerPrims;
+        for (auto primIt = range.begin(); primIt != range.end(); ++primIt) {
+            ++loopSize;
+            if (prefetchBatchSize > 0 && !primIt.IsPostVisit()
+                && !(buildInstances && primIt->IsInstance())) {
+                readerPrims.push_back(*primIt);
+            }
+        }
+
+        std::unique_ptr<_PrimReaderPrefetcher> prefetcher;
+        if (prefetchBatchSize > 0) {
+            prefetcher.reset(
+                new _PrimReaderPrefetcher(std::move(readerPrims), mArgs, prefetchBatchSize));
+        }
+
         MayaUsd::ProgressBarLoopScope instanceLoop(loopSize);
         for (auto primIt = range.begin(); primIt != range.end(); ++primIt) {
             const UsdPrim&           prim = *primIt;
@@ -643,9 +883,12 @@ bool UsdMaya_ReadJob::_DoImport(UsdPrimRange& rootRange, const UsdPrim& usdRootP
             readCtx.SetTimeSampleMultiplier(mTimeSampleMultiplier);
 
             if (buildInstances && prim.IsInstance()) {
+                if (prefetcher) {
+                    prefetcher->Drain();
+                }
                 _DoImportInstanceIt(primIt, usdRootPrim, readCtx, primReaderMap);
             } else {
-                _DoImportPrimIt(primIt, usdRootPrim, readCtx, primReaderMap);
+                _DoImportPrimIt(primIt, usdRootPrim, readCtx, primReaderMap, prefetcher.get());
             }
             instanceLoop.loopAdvance();
         }
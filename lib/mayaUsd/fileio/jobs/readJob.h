@@ -19,6 +19,7 @@
 #include <mayaUsd/fileio/chaser/importChaser.h>
 #include <mayaUsd/fileio/importData.h>
 #include <mayaUsd/fileio/jobs/jobArgs.h>
+#include <mayaUsd/fileio/jobs/jobProfiler.h>
 #include <mayaUsd/fileio/primReader.h>
 #include <mayaUsd/fileio/primReaderContext.h>
 
@@ -112,11 +113,14 @@ protected:
     MDagPath                                 mMayaRootDagPath;
 
 private:
+    class _PrimReaderPrefetcher;
+
     void _DoImportPrimIt(
         UsdPrimRange::iterator&   primIt,
         const UsdPrim&            usdRootPrim,
         UsdMayaPrimReaderContext& readCtx,
-        _PrimReaderMap&           primReaders);
+        _PrimReaderMap&           primReaders,
+        _PrimReaderPrefetcher*    prefetcher = nullptr);
 
     void _DoImportInstanceIt(
         UsdPrimRange::iterator&   primIt,
@@ -139,6 +143,9 @@ private:
     /// Cache of import chasers that were run. Currently used to aid in redo/undo operations
     /// This cache is cleared for every new Read() operation.
     UsdMayaImportChaserRefPtrVector mImportChasers;
+
+    // Per-translator instrumentation of the prim readers and import chasers
+    UsdMaya_JobProfiler mProfiler;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -21,6 +21,7 @@
 #include <pxr/base/tf/pathUtils.h>
 #include <pxr/base/tf/stl.h>
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/trace/trace.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/ar/resolver.h>
 #include <pxr/usd/kind/registry.h>
@@ -35,6 +36,7 @@
 #include <maya/MGlobal.h>
 #include <maya/MItDag.h>
 #include <maya/MObjectArray.h>
+#include <maya/MProfiler.h>
 #include <maya/MPxNode.h>
 #include <maya/MStatus.h>
 #include <maya/MUuid.h>
@@ -74,6 +76,7 @@ PXR_NAMESPACE_OPEN_SCOPE
 UsdMaya_WriteJob::UsdMaya_WriteJob(const UsdMayaJobExportArgs& iArgs)
     : mJobCtx(iArgs)
     , _modelKindProcessor(new UsdMaya_ModelKindProcessor(iArgs))
+    , mProfiler(iArgs.profileReport)
 {
 }
 
@@ -114,6 +117,10 @@ static TfToken _GetFallbackExtension(const TfToken& compatibilityMode)
 
 bool UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
 {
+    TRACE_SCOPE("UsdMaya_WriteJob::Write");
+    MProfilingScope profilingScope(
+        UsdMaya_JobProfiler::GetProfilerCategory(), MProfiler::kColorC_L3, "Write job");
+
     const std::vector<double>& timeSamples = mJobCtx.mArgs.timeSamples;
 
     // Non-animated export doesn't show progress.
@@ -160,11 +167,19 @@ bool UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
         return false;
     }
     progressBar.advance();
+
+    if (mJobCtx.mArgs.profileReport) {
+        mProfiler.WriteReport(UsdMaya_JobProfiler::GetReportFileName(fileName));
+    }
     return true;
 }
 
 bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
 {
+    TRACE_SCOPE("UsdMaya_WriteJob::_BeginWriting");
+    MProfilingScope profilingScope(
+        UsdMaya_JobProfiler::GetProfilerCategory(), MProfiler::kColorC_L2, "Begin writing");
+
     MayaUsd::ProgressBarScope progressBar(8);
 
     // Check for DAG nodes that are a child of an already specified DAG node to export
@@ -394,7 +409,14 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
                         return false;
                     }
 
-                    primWriter->Write(UsdTimeCode::Default());
+                    {
+                        UsdMaya_JobProfiler::Scope profilerScope(
+                            mProfiler,
+                            "Prim writer",
+                            usdPrim.GetTypeName(),
+                            typeid(*primWriter));
+                        primWriter->Write(UsdTimeCode::Default());
+                    }
 
                     const UsdMayaUtil::MDagPathMap<SdfPath>& mapping
                         = primWriter->GetDagToUsdPathMapping();
@@ -438,6 +460,8 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
         return false;
     }
 
+    _GatherAnimatedPrimWriters();
+
     // now we populate the chasers and run export default
     mChasers.clear();
     UsdMayaExportChaserRegistry::FactoryContext ctx(
@@ -455,6 +479,8 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
 
     MayaUsd::ProgressBarLoopScope chasersLoop(mChasers.size());
     for (const UsdMayaExportChaserRefPtr& chaser : mChasers) {
+        UsdMaya_JobProfiler::Scope profilerScope(
+            mProfiler, "Export chaser default", TfToken(), typeid(*chaser));
         if (!chaser->ExportDefault()) {
             return false;
         }
@@ -464,18 +490,49 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
     return true;
 }
 
+void UsdMaya_WriteJob::_GatherAnimatedPrimWriters()
+{
+    mAnimatedPrimWriters.clear();
+    if (mJobCtx.mArgs.timeSamples.empty()) {
+        return;
+    }
+
+    // Static prim writers have already written everything they need at the
+    // default time, so there is no need to call them for every time sample.
+    for (const UsdMayaPrimWriterSharedPtr& primWriter : mJobCtx.mMayaPrimWriterList) {
+        if (primWriter->GetUsdPrim() && primWriter->IsAnimated()) {
+            mAnimatedPrimWriters.push_back(primWriter);
+        }
+    }
+
+    if (mJobCtx.mArgs.verbose) {
+        TF_STATUS(
+            "%zu of %zu prim writers are animated",
+            mAnimatedPrimWriters.size(),
+            mJobCtx.mMayaPrimWriterList.size());
+    }
+}
+
 bool UsdMaya_WriteJob::_WriteFrame(double iFrame)
 {
+    TRACE_SCOPE("UsdMaya_WriteJob::_WriteFrame");
+    MProfilingScope profilingScope(
+        UsdMaya_JobProfiler::GetProfilerCategory(), MProfiler::kColorC_L2, "Write frame");
+
     const UsdTimeCode usdTime(iFrame);
 
-    for (const UsdMayaPrimWriterSharedPtr& primWriter : mJobCtx.mMayaPrimWriterList) {
+    for (const UsdMayaPrimWriterSharedPtr& primWriter : mAnimatedPrimWriters) {
         const UsdPrim& usdPrim = primWriter->GetUsdPrim();
         if (usdPrim) {
+            UsdMaya_JobProfiler::Scope profilerScope(
+                mProfiler, "Prim writer", usdPrim.GetTypeName(), typeid(*primWriter));
             primWriter->Write(usdTime);
         }
     }
 
     for (UsdMayaExportChaserRefPtr& chaser : mChasers) {
+        UsdMaya_JobProfiler::Scope profilerScope(
+            mProfiler, "Export chaser frame", TfToken(), typeid(*chaser));
         if (!chaser->ExportFrame(iFrame)) {
             return false;
         }
@@ -488,6 +545,10 @@ bool UsdMaya_WriteJob::_WriteFrame(double iFrame)
 
 bool UsdMaya_WriteJob::_FinishWriting()
 {
+    TRACE_SCOPE("UsdMaya_WriteJob::_FinishWriting");
+    MProfilingScope profilingScope(
+        UsdMaya_JobProfiler::GetProfilerCategory(), MProfiler::kColorC_L2, "Finish writing");
+
     MayaUsd::ProgressBarScope progressBar(7);
 
     UsdPrimSiblingRange usdRootPrims = mJobCtx.mStage->GetPseudoRoot().GetChildren();
@@ -572,6 +633,12 @@ bool UsdMaya_WriteJob::_FinishWriting()
     const int                     loopSize = mJobCtx.mMayaPrimWriterList.size();
     MayaUsd::ProgressBarLoopScope primWriterLoop(loopSize);
     for (auto& primWriter : mJobCtx.mMayaPrimWriterList) {
+        const UsdPrim&             usdPrim = primWriter->GetUsdPrim();
+        UsdMaya_JobProfiler::Scope profilerScope(
+            mProfiler,
+            "Prim writer post export",
+            usdPrim ? usdPrim.GetTypeName() : TfToken(),
+            typeid(*primWriter));
         primWriter->PostExport();
         primWriterLoop.loopAdvance();
     }
@@ -579,6 +646,8 @@ bool UsdMaya_WriteJob::_FinishWriting()
     // Run post export function on the chasers.
     MayaUsd::ProgressBarLoopScope chasersLoop(mChasers.size());
     for (const UsdMayaExportChaserRefPtr& chaser : mChasers) {
+        UsdMaya_JobProfiler::Scope profilerScope(
+            mProfiler, "Export chaser post export", TfToken(), typeid(*chaser));
         if (!chaser->PostExport()) {
             return false;
         }
@@ -593,6 +662,9 @@ bool UsdMaya_WriteJob::_FinishWriting()
 
     TF_STATUS("Saving stage");
     if (mJobCtx.mStage->GetRootLayer()->PermissionToSave()) {
+        TRACE_SCOPE("UsdMaya_WriteJob::Save");
+        MProfilingScope profilingScope(
+            UsdMaya_JobProfiler::GetProfilerCategory(), MProfiler::kColorC_L2, "Save stage");
         mJobCtx.mStage->GetRootLayer()->Save();
     }
 
@@ -605,6 +677,7 @@ bool UsdMaya_WriteJob::_FinishWriting()
     progressBar.advance();
 
     mJobCtx.mStage = UsdStageRefPtr();
+    mAnimatedPrimWriters.clear();
     mJobCtx.mMayaPrimWriterList.clear(); // clear this so that no stage references are left around
 
     // In the usdz case, the layer at _fileName was just a temp file, so
@@ -830,6 +903,10 @@ removeEmptyPrims(const UsdStageRefPtr& stage, const std::vector<SdfPath>& toRemo
 
 void UsdMaya_WriteJob::_PruneEmpties()
 {
+    TRACE_SCOPE("UsdMaya_WriteJob::_PruneEmpties");
+    MProfilingScope profilingScope(
+        UsdMaya_JobProfiler::GetProfilerCategory(), MProfiler::kColorC_L2, "Prune empties");
+
     if (mJobCtx.mArgs.includeEmptyTransforms)
         return;
 
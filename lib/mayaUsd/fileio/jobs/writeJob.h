@@ -18,6 +18,7 @@
 
 #include <mayaUsd/base/api.h>
 #include <mayaUsd/fileio/chaser/exportChaser.h>
+#include <mayaUsd/fileio/jobs/jobProfiler.h>
 #include <mayaUsd/fileio/writeJobContext.h>
 #include <mayaUsd/utils/util.h>
 
@@ -60,6 +61,10 @@ private:
     /// time. Returns \c true if the stage can be created successfully.
     bool _BeginWriting(const std::string& fileName, bool append);
 
+    /// Collects the prim writers which need to be called at each time sample,
+    /// skipping the ones whose Maya node is not animated.
+    void _GatherAnimatedPrimWriters();
+
     /// Writes the stage values at the given frame.
     /// Warning: this function must be called with non-decreasing frame numbers.
     /// If you call WriteFrame() with a frame number lower than a previous
@@ -103,9 +108,15 @@ private:
 
     UsdMayaExportChaserRefPtrVector mChasers;
 
+    // Subset of the prim writers of the job context called at each time sample
+    std::vector<UsdMayaPrimWriterSharedPtr> mAnimatedPrimWriters;
+
     UsdMayaWriteJobContext mJobCtx;
 
     std::unique_ptr<UsdMaya_ModelKindProcessor> _modelKindProcessor;
+
+    // Per-translator instrumentation of the prim writers and chasers
+    UsdMaya_JobProfiler mProfiler;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
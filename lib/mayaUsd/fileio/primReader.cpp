@@ -31,6 +31,12 @@ UsdMayaPrimReader::CanImport(const UsdMayaJobImportArgs&, const UsdPrim& importP
     return ContextSupport::Fallback;
 }
 
+bool UsdMayaPrimReader::HasPrefetch() const { return false; }
+
+void UsdMayaPrimReader::Prefetch() { }
+
+bool UsdMayaPrimReader::MayPruneChildren() const { return true; }
+
 bool UsdMayaPrimReader::HasPostReadSubtree() const { return false; }
 
 void UsdMayaPrimReader::PostReadSubtree(UsdMayaPrimReaderContext&) { }
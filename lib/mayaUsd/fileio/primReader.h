@@ -56,6 +56,28 @@ public:
     MAYAUSD_CORE_PUBLIC
     virtual bool Read(UsdMayaPrimReaderContext& context) = 0;
 
+    /// Whether this prim reader specifies a Prefetch step.
+    MAYAUSD_CORE_PUBLIC
+    virtual bool HasPrefetch() const;
+
+    /// An optional import step that runs before Read(), on a worker thread,
+    /// while the prims preceding this one are still being read.
+    /// Readers can use it to pull and decode the USD data Read() needs, so that
+    /// Read() only has to create the Maya nodes. It must only read from USD:
+    /// it must not call into Maya, nor author anything on the stage.
+    /// Since the Prefetch step of the following prims may run while the Read()
+    /// of a reader that has one runs, that Read() must not author anything on
+    /// the stage either.
+    MAYAUSD_CORE_PUBLIC
+    virtual void Prefetch();
+
+    /// Whether Read() may prune the children of the prim, see
+    /// UsdMayaPrimReaderContext::SetPruneChildren(). The readers of the
+    /// descendants of a prim are only created ahead of time, to run their
+    /// Prefetch step, when the reader of the prim does not prune them.
+    MAYAUSD_CORE_PUBLIC
+    virtual bool MayPruneChildren() const;
+
     /// Whether this prim reader specifies a PostReadSubtree step.
     MAYAUSD_CORE_PUBLIC
     virtual bool HasPostReadSubtree() const;
@@ -219,6 +219,31 @@ bool UsdMayaPrimWriter::ExportsGprims() const { return false; }
 /* virtual */
 bool UsdMayaPrimWriter::ShouldPruneChildren() const { return false; }
 
+/* virtual */
+bool UsdMayaPrimWriter::IsAnimated() const { return true; }
+
+bool UsdMayaPrimWriter::_IsVisibilityAnimated() const
+{
+    // Mirror the conditions under which Write() authors visibility.
+    if (!_exportVisibility || _IsMergedTransform() || !UsdGeomImageable(_usdPrim)) {
+        return false;
+    }
+
+    const MFnDependencyNode depNodeFn(GetMayaObject());
+    if (UsdMayaUtil::isPlugAnimated(depNodeFn.findPlug("visibility", true))) {
+        return true;
+    }
+
+    if (_IsMergedShape()) {
+        MDagPath parentDagPath = GetDagPath();
+        parentDagPath.pop();
+        return UsdMayaUtil::isPlugAnimated(
+            MFnDependencyNode(parentDagPath.node()).findPlug("visibility", true));
+    }
+
+    return false;
+}
+
 /* virtual */
 void UsdMayaPrimWriter::PostExport() { MakeSingleSamplesStatic(); }
 
@@ -118,6 +118,15 @@ public:
     MAYAUSD_CORE_PUBLIC
     virtual bool ShouldPruneChildren() const;
 
+    /// Whether the data written by this prim writer may change over time.
+    /// During an animated export, the write job only calls Write() at each
+    /// time sample for prim writers that report being animated.
+    ///
+    /// Base implementation conservatively returns \c true; prim writers that
+    /// know when their Maya node is static should override.
+    MAYAUSD_CORE_PUBLIC
+    virtual bool IsAnimated() const;
+
     /// Whether visibility can be exported for this prim.
     /// By default, this is based off of the export visibility setting in the
     /// export args.
@@ -192,6 +201,11 @@ protected:
     MAYAUSD_CORE_PUBLIC
     virtual bool _HasAnimCurves() const;
 
+    /// Helper function for determining whether the visibility written by the
+    /// base Write() implementation is animated.
+    MAYAUSD_CORE_PUBLIC
+    bool _IsVisibilityAnimated() const;
+
     /// Sets the destination USD prim to which we are writing. (Should only be used once in the
     /// constructor)
     MAYAUSD_CORE_PUBLIC
@@ -257,7 +257,6 @@ UsdMayaShadingModeExportContext::GetAssignments() const
     SdfPathSet seenBoundPrimPaths;
 
     for (auto& dagPath : dagPaths) {
-        unsigned int instanceNumber = dagPath.instanceNumber();
 #else
     // Maya 2022 and older use this version
     MPlug dsmPlug = seDepNode.findPlug("dagSetMembers", true, &status);
@@ -338,26 +337,14 @@ UsdMayaShadingModeExportContext::GetAssignments() const
             continue;
         }
 
-        MObjectArray sgObjs, compObjs;
-        status = dagNode.getConnectedSetsAndMembers(instanceNumber, sgObjs, compObjs, true);
-        if (status != MS::kSuccess) {
-            continue;
-        }
-
-        for (unsigned int j = 0u; j < sgObjs.length(); ++j) {
+        const _ShapeAssignments& shapeAssignments = _GetShapeAssignments(dagPath);
+        for (size_t j = 0u; j < shapeAssignments.shadingEngines.size(); ++j) {
             // If the shading group isn't the one we're interested in, skip it.
-            if (sgObjs[j] != _shadingEngine) {
+            if (shapeAssignments.shadingEngines[j].object() != _shadingEngine) {
                 continue;
             }
 
-            VtIntArray faceIndices;
-            if (!compObjs[j].isNull()) {
-                MItMeshPolygon faceIt(dagPath, compObjs[j]);
-                faceIndices.reserve(faceIt.count());
-                for (faceIt.reset(); !faceIt.isDone(); faceIt.next()) {
-                    faceIndices.push_back(faceIt.index());
-                }
-            }
+            const VtIntArray& faceIndices = shapeAssignments.faceIndices[j];
             ret.assignments.push_back(Assignment {
                 usdPath, faceIndices, TfToken(dagNode.name().asChar()), dagNode.object() });
         }
@@ -365,6 +352,46 @@ UsdMayaShadingModeExportContext::GetAssignments() const
     return ret;
 }
 
+const UsdMayaShadingModeExportContext::_ShapeAssignments&
+UsdMayaShadingModeExportContext::_GetShapeAssignments(const MDagPath& dagPath) const
+{
+    auto iter = _shapeAssignments.find(dagPath);
+    if (iter != _shapeAssignments.end()) {
+        return iter->second;
+    }
+
+    _ShapeAssignments& shapeAssignments = _shapeAssignments[dagPath];
+
+    MStatus          status;
+    const MFnDagNode dagNode(dagPath, &status);
+    if (!status) {
+        return shapeAssignments;
+    }
+
+    MObjectArray sgObjs, compObjs;
+    status = dagNode.getConnectedSetsAndMembers(dagPath.instanceNumber(), sgObjs, compObjs, true);
+    if (status != MS::kSuccess) {
+        return shapeAssignments;
+    }
+
+    shapeAssignments.shadingEngines.reserve(sgObjs.length());
+    shapeAssignments.faceIndices.reserve(sgObjs.length());
+    for (unsigned int j = 0u; j < sgObjs.length(); ++j) {
+        VtIntArray faceIndices;
+        if (!compObjs[j].isNull()) {
+            MItMeshPolygon faceIt(dagPath, compObjs[j]);
+            faceIndices.reserve(faceIt.count());
+            for (faceIt.reset(); !faceIt.isDone(); faceIt.next()) {
+                faceIndices.push_back(faceIt.index());
+            }
+        }
+        shapeAssignments.shadingEngines.emplace_back(sgObjs[j]);
+        shapeAssignments.faceIndices.push_back(faceIndices);
+    }
+
+    return shapeAssignments;
+}
+
 static SdfPath _GetCommonAncestor(
     const UsdStageRefPtr&                                    stage,
     const UsdMayaShadingModeExportContext::AssignmentVector& assignments)
@@ -28,7 +28,9 @@
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
 
+#include <maya/MDagPath.h>
 #include <maya/MObject.h>
+#include <maya/MObjectHandle.h>
 #include <maya/MPlug.h>
 
 #include <string>
@@ -133,6 +135,21 @@ public:
         const UsdMayaUtil::MDagPathMap<SdfPath>& dagPathToUsdMap);
 
 private:
+    /// The shading engines a shape instance is a member of, along with the
+    /// faces assigned to each of them. Empty face indices mean the whole
+    /// shape is assigned.
+    struct _ShapeAssignments
+    {
+        std::vector<MObjectHandle> shadingEngines;
+        std::vector<VtIntArray>    faceIndices;
+    };
+
+    /// Returns the shading engine assignments of \p dagPath, computing them
+    /// on first use. Every shading engine queries the same shapes, so the
+    /// set memberships and per-face components of each shape are only
+    /// walked once per export rather than once per shading engine.
+    const _ShapeAssignments& _GetShapeAssignments(const MDagPath& dagPath) const;
+
     MObject                                  _shadingEngine;
     const UsdStageRefPtr&                    _stage;
     const UsdMayaUtil::MDagPathMap<SdfPath>& _dagPathToUsdMap;
@@ -144,6 +161,8 @@ private:
     /// Shaders that are bound to prims under \p _bindableRoot paths will get
     /// exported. If \p bindableRoots is empty, it will export all.
     SdfPathSet _bindableRoots;
+
+    mutable UsdMayaUtil::MDagPathMap<_ShapeAssignments> _shapeAssignments;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
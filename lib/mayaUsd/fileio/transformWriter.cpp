@@ -647,4 +647,18 @@ void UsdMayaTransformWriter::Write(const UsdTimeCode& usdTime)
     }
 }
 
+/* virtual */
+bool UsdMayaTransformWriter::IsAnimated() const
+{
+    for (const _AnimChannel& channel : _animChannels) {
+        for (const _SampleType sampleType : channel.sampleType) {
+            if (sampleType == _SampleType::Animated) {
+                return true;
+            }
+        }
+    }
+
+    return _HasAnimCurves() || _IsVisibilityAnimated();
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
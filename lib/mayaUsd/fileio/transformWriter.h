@@ -57,6 +57,12 @@ public:
     MAYAUSD_CORE_PUBLIC
     void Write(const UsdTimeCode& usdTime) override;
 
+    /// Returns \c true if any of the xform op channels, the visibility or any
+    /// other attribute of the transform is animated. Subclasses writing
+    /// additional time-varying data must override this.
+    MAYAUSD_CORE_PUBLIC
+    bool IsAnimated() const override;
+
 private:
     // Cache of previous rotations.
     using _TokenRotationMap
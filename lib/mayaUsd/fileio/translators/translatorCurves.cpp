@@ -16,6 +16,7 @@
 #include "translatorCurves.h"
 
 #include <mayaUsd/fileio/translators/translatorUtil.h>
+#include <mayaUsd/nodes/stageNode.h>
 #include <mayaUsd/undo/OpUndoItems.h>
 
 #include <pxr/usd/usdGeom/basisCurves.h>
@@ -29,6 +30,7 @@
 #include <maya/MIntArray.h>
 #include <maya/MPlug.h>
 #include <maya/MPointArray.h>
+#include <maya/MString.h>
 #include <maya/MTime.h>
 #include <maya/MTimeArray.h>
 
@@ -137,6 +139,17 @@ bool UsdMayaTranslatorCurves::Create(
 
     curves.GetWidthsAttr().Get(&curveWidths); // not animatable
 
+    // When importing as an animation cache, animated points are streamed from
+    // the stage by a point based deformer instead of being baked into blend
+    // shape targets. The deformer maps CVs one-to-one onto the prim's points,
+    // so this is only possible when the prim holds a single curve.
+    MObject stageNode;
+    if (numTimeSamples > 0 && args.GetUseAsAnimationCache() && context
+        && curveVertexCounts.size() == 1u) {
+        stageNode = context->GetMayaNode(
+            SdfPath(UsdMayaStageNodeTokens->MayaTypeName.GetString()), false);
+    }
+
     int     indexOffset = 0;
     int     coffset = 0;
     int     mayaDegree = 0;
@@ -259,10 +272,23 @@ bool UsdMayaTranslatorCurves::Create(
         }
 
         // == Animate points ==
-        //   Use blendShapeDeformer so that all the points for a frame are contained in a single
-        //   node Almost identical code as used with MayaMeshReader.cpp
-        //
-        if (numTimeSamples > 0) {
+        //   Stream the points from the stage with a point based deformer when possible. Curves
+        //   converted to bezier shapes no longer match the USD points, so they fall back to the
+        //   blend shape deformer.
+        const bool streamPoints = !stageNode.isNull()
+            && (curveType == MFn::kNurbsCurve || typeToken == UsdGeomTokens->linear);
+        if (streamPoints) {
+            MObject deformerNode;
+            MString deformerName;
+            status = UsdMayaTranslatorUtil::CreatePointBasedDeformer(
+                curveObj, stageNode, prim, &deformerNode, &deformerName);
+            if (status != MS::kSuccess) {
+                return false;
+            }
+            context->RegisterNewMayaNode(deformerName.asChar(), deformerNode); // used for undo/redo
+        } else if (numTimeSamples > 0) {
+            // Use blendShapeDeformer so that all the points for a frame are contained in a single
+            // node. Almost identical code as used with MayaMeshReader.cpp
             MPointArray mayaPoints(mayaNumVertices);
             MObject     curveAnimObj;
 
@@ -15,25 +15,20 @@
 //
 #include "translatorMesh.h"
 
+#include <mayaUsd/fileio/translators/translatorUtil.h>
 #include <mayaUsd/fileio/utils/meshReadUtils.h>
 #include <mayaUsd/fileio/utils/meshWriteUtils.h>
 #include <mayaUsd/fileio/utils/readUtil.h>
-#include <mayaUsd/nodes/pointBasedDeformerNode.h>
-#include <mayaUsd/nodes/stageNode.h>
-#include <mayaUsd/undo/OpUndoItems.h>
 #include <mayaUsd/utils/util.h>
 
 #include <pxr/usd/usdGeom/primvarsAPI.h>
 
-#include <maya/MDGModifier.h>
 #include <maya/MDoubleArray.h>
 #include <maya/MFloatArray.h>
 #include <maya/MFnAnimCurve.h>
 #include <maya/MFnBlendShapeDeformer.h>
-#include <maya/MFnDagNode.h>
 #include <maya/MFnDependencyNode.h>
 #include <maya/MFnMesh.h>
-#include <maya/MGlobal.h>
 #include <maya/MIntArray.h>
 #include <maya/MItMeshFaceVertex.h>
 #include <maya/MObject.h>
@@ -56,7 +51,8 @@ TranslatorMeshRead::TranslatorMeshRead(
     const GfInterval&         frameRange,
     bool                      wantCacheAnimation,
     UsdMayaPrimReaderContext* context,
-    MStatus*                  status)
+    MStatus*                  status,
+    const UsdData*            usdData)
     : m_wantCacheAnimation(wantCacheAnimation)
     , m_pointsNumTimeSamples(0u)
 {
@@ -65,11 +61,21 @@ TranslatorMeshRead::TranslatorMeshRead(
     // ==============================================
     // construct a Maya mesh
     // ==============================================
-    VtIntArray faceVertexCounts;
-    VtIntArray faceVertexIndices;
+    UsdData readUsdData;
+    if (!usdData) {
+        ReadUsdData(mesh, frameRange, &readUsdData);
+        usdData = &readUsdData;
+    }
 
-    const UsdAttribute fvc = mesh.GetFaceVertexCountsAttr();
-    if (fvc.ValueMightBeTimeVarying()) {
+    const VtIntArray&          faceVertexCounts = usdData->faceVertexCounts;
+    const VtIntArray&          faceVertexIndices = usdData->faceVertexIndices;
+    const std::vector<double>& pointsTimeSamples = usdData->pointsTimeSamples;
+    const TfToken&             normalsInterpolation = usdData->normalsInterpolation;
+    VtVec3fArray               points = usdData->points;
+    VtVec3fArray               normals = usdData->normals;
+    m_pointsNumTimeSamples = pointsTimeSamples.size();
+
+    if (usdData->faceVertexCountsVarying) {
         // at some point, it would be great, instead of failing, to create a usd/hydra proxy node
         // for the mesh, perhaps?  For now, better to give a more specific error
         TF_RUNTIME_ERROR(
@@ -77,12 +83,9 @@ TranslatorMeshRead::TranslatorMeshRead(
             "faceVertexCounts), which isn't currently supported. "
             "Skipping...",
             prim.GetPath().GetText());
-    } else {
-        fvc.Get(&faceVertexCounts, UsdTimeCode::EarliestTime());
     }
 
-    const UsdAttribute fvi = mesh.GetFaceVertexIndicesAttr();
-    if (fvi.ValueMightBeTimeVarying()) {
+    if (usdData->faceVertexIndicesVarying) {
         // at some point, it would be great, instead of failing, to create a usd/hydra proxy node
         // for the mesh, perhaps?  For now, better to give a more specific error
         TF_RUNTIME_ERROR(
@@ -90,8 +93,6 @@ TranslatorMeshRead::TranslatorMeshRead(
             "faceVertexIndices), which isn't currently supported. "
             "Skipping...",
             prim.GetPath().GetText());
-    } else {
-        fvi.Get(&faceVertexIndices, UsdTimeCode::EarliestTime());
     }
 
     // Sanity Checks. If the vertex arrays are empty, skip this mesh
@@ -104,55 +105,6 @@ TranslatorMeshRead::TranslatorMeshRead(
             prim.GetPath().GetText());
     }
 
-    // If the USD mesh was left-handed, then the faces had their vertices in left-handed order.
-    // Fix them to be in right-handed order, as expected by Maya.
-    if (isPrimitiveLeftHanded(mesh)) {
-        size_t firstIndex = 0;
-        for (int vertexCount : faceVertexCounts) {
-            std::reverse(
-                faceVertexIndices.begin() + firstIndex,
-                faceVertexIndices.begin() + firstIndex + vertexCount);
-            firstIndex += vertexCount;
-        }
-    }
-
-    // Gather points and normals
-    // If timeInterval is non-empty, pick the first available sample in the
-    // timeInterval or default.
-    VtVec3fArray        points;
-    VtVec3fArray        normals;
-    TfToken             normalsInterpolation;
-    UsdTimeCode         pointsTimeSample = UsdTimeCode::EarliestTime();
-    UsdTimeCode         normalsTimeSample = UsdTimeCode::EarliestTime();
-    std::vector<double> pointsTimeSamples;
-
-    if (!frameRange.IsEmpty()) {
-        mesh.GetPointsAttr().GetTimeSamplesInInterval(frameRange, &pointsTimeSamples);
-        if (!pointsTimeSamples.empty()) {
-            m_pointsNumTimeSamples = pointsTimeSamples.size();
-            pointsTimeSample = pointsTimeSamples.front();
-        }
-
-        std::vector<double> normalsTimeSamples;
-        mesh.GetNormalsAttr().GetTimeSamplesInInterval(frameRange, &normalsTimeSamples);
-        if (!normalsTimeSamples.empty()) {
-            normalsTimeSample = normalsTimeSamples.front();
-        }
-    }
-
-    mesh.GetPointsAttr().Get(&points, pointsTimeSample);
-
-    /* If 'normals' and 'primvars:normals' are both specified, the latter has precedence. */
-    UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(mesh).GetPrimvar(UsdGeomTokens->normals);
-
-    if (primvar.HasValue()) {
-        primvar.ComputeFlattened(&normals, normalsTimeSample);
-        normalsInterpolation = primvar.GetInterpolation();
-    } else {
-        mesh.GetNormalsAttr().Get(&normals, normalsTimeSample);
-        normalsInterpolation = mesh.GetNormalsInterpolation();
-    }
-
     if (points.empty()) {
         TF_RUNTIME_ERROR(
             "points array is empty on Mesh <%s>. Skipping...", prim.GetPath().GetText());
@@ -269,7 +221,12 @@ TranslatorMeshRead::TranslatorMeshRead(
     }
 
     if (m_wantCacheAnimation) {
-        *status = setPointBasedDeformerForMayaNode(m_meshObj, stageNode, prim);
+        *status = UsdMayaTranslatorUtil::CreatePointBasedDeformer(
+            m_meshObj,
+            stageNode,
+            prim,
+            &m_pointBasedDeformerNode,
+            &m_newPointBasedDeformerName);
         return;
     }
 
@@ -363,93 +320,77 @@ TranslatorMeshRead::TranslatorMeshRead(
     *status = stat;
 }
 
-bool TranslatorMeshRead::isPrimitiveLeftHanded(const UsdGeomGprim& prim)
+void TranslatorMeshRead::ReadUsdData(
+    const UsdGeomMesh& mesh,
+    const GfInterval&  frameRange,
+    UsdData*           usdData)
 {
-    TfToken orientation;
-    if (!prim.GetOrientationAttr().Get(&orientation)) {
-        return false;
+    const UsdAttribute fvc = mesh.GetFaceVertexCountsAttr();
+    usdData->faceVertexCountsVarying = fvc.ValueMightBeTimeVarying();
+    if (!usdData->faceVertexCountsVarying) {
+        fvc.Get(&usdData->faceVertexCounts, UsdTimeCode::EarliestTime());
     }
 
-    return orientation == UsdGeomTokens->leftHanded;
+    const UsdAttribute fvi = mesh.GetFaceVertexIndicesAttr();
+    usdData->faceVertexIndicesVarying = fvi.ValueMightBeTimeVarying();
+    if (!usdData->faceVertexIndicesVarying) {
+        fvi.Get(&usdData->faceVertexIndices, UsdTimeCode::EarliestTime());
+    }
+
+    // If the USD mesh was left-handed, then the faces had their vertices in left-handed order.
+    // Fix them to be in right-handed order, as expected by Maya.
+    if (isPrimitiveLeftHanded(mesh)) {
+        VtIntArray& faceVertexIndices = usdData->faceVertexIndices;
+        size_t      firstIndex = 0;
+        for (int vertexCount : usdData->faceVertexCounts) {
+            std::reverse(
+                faceVertexIndices.begin() + firstIndex,
+                faceVertexIndices.begin() + firstIndex + vertexCount);
+            firstIndex += vertexCount;
+        }
+    }
+
+    // Gather points and normals
+    // If timeInterval is non-empty, pick the first available sample in the
+    // timeInterval or default.
+    UsdTimeCode pointsTimeSample = UsdTimeCode::EarliestTime();
+    UsdTimeCode normalsTimeSample = UsdTimeCode::EarliestTime();
+
+    if (!frameRange.IsEmpty()) {
+        mesh.GetPointsAttr().GetTimeSamplesInInterval(frameRange, &usdData->pointsTimeSamples);
+        if (!usdData->pointsTimeSamples.empty()) {
+            pointsTimeSample = usdData->pointsTimeSamples.front();
+        }
+
+        std::vector<double> normalsTimeSamples;
+        mesh.GetNormalsAttr().GetTimeSamplesInInterval(frameRange, &normalsTimeSamples);
+        if (!normalsTimeSamples.empty()) {
+            normalsTimeSample = normalsTimeSamples.front();
+        }
+    }
+
+    mesh.GetPointsAttr().Get(&usdData->points, pointsTimeSample);
+
+    /* If 'normals' and 'primvars:normals' are both specified, the latter has precedence. */
+    UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(mesh).GetPrimvar(UsdGeomTokens->normals);
+
+    if (primvar.HasValue()) {
+        primvar.ComputeFlattened(&usdData->normals, normalsTimeSample);
+        usdData->normalsInterpolation = primvar.GetInterpolation();
+    } else {
+        mesh.GetNormalsAttr().Get(&usdData->normals, normalsTimeSample);
+        usdData->normalsInterpolation = mesh.GetNormalsInterpolation();
+    }
 }
 
-MStatus TranslatorMeshRead::setPointBasedDeformerForMayaNode(
-    const MObject& mayaObj,
-    const MObject& stageNode,
-    const UsdPrim& prim)
+bool TranslatorMeshRead::isPrimitiveLeftHanded(const UsdGeomGprim& prim)
 {
-    MStatus status { MS::kSuccess };
-
-    // Get the output time plug and node for Maya's global time object.
-    MPlug timePlug = UsdMayaUtil::GetMayaTimePlug();
-    if (timePlug.isNull()) {
-        status = MS::kFailure;
+    TfToken orientation;
+    if (!prim.GetOrientationAttr().Get(&orientation)) {
+        return false;
     }
 
-    MObject timeNode = timePlug.node(&status);
-    CHECK_MSTATUS(status);
-
-    // Clear the selection list so that the deformer command doesn't try to add
-    // anything to the new deformer's set. We'll do that manually afterwards.
-    status = MGlobal::clearSelectionList();
-    CHECK_MSTATUS(status);
-
-    const MFnDagNode dagNodeFn(mayaObj, &status);
-    CHECK_MSTATUS(status);
-
-    status = MGlobal::selectByName(dagNodeFn.fullPathName().asChar());
-    CHECK_MSTATUS(status);
-
-    // Create the point based deformer node for this prim.
-    const std::string pointBasedDeformerNodeName = TfStringPrintf(
-        "usdPointBasedDeformerNode%s",
-        TfStringReplace(prim.GetPath().GetString(), SdfPathTokens->childDelimiter.GetString(), "_")
-            .c_str());
-
-    const std::string deformerCmd = TfStringPrintf(
-        "from maya import cmds; cmds.deformer(name=\'%s\', type=\'%s\')[0]",
-        pointBasedDeformerNodeName.c_str(),
-        UsdMayaPointBasedDeformerNodeTokens->MayaTypeName.GetText());
-    status = MGlobal::executePythonCommand(deformerCmd.c_str(), m_newPointBasedDeformerName);
-    CHECK_MSTATUS(status);
-
-    // Get the newly created point based deformer node.
-    status = UsdMayaUtil::GetMObjectByName(m_newPointBasedDeformerName, m_pointBasedDeformerNode);
-    CHECK_MSTATUS(status);
-
-    MFnDependencyNode depNodeFn(m_pointBasedDeformerNode, &status);
-    CHECK_MSTATUS(status);
-
-    MDGModifier& dgMod = MDGModifierUndoItem::create("Deformer connection");
-
-    // Set the prim path on the deformer node.
-    MPlug primPathPlug
-        = depNodeFn.findPlug(UsdMayaPointBasedDeformerNode::primPathAttr, true, &status);
-    CHECK_MSTATUS(status);
-
-    status = dgMod.newPlugValueString(primPathPlug, prim.GetPath().GetText());
-    CHECK_MSTATUS(status);
-
-    // Connect the stage node's stage output to the deformer node.
-    status = dgMod.connect(
-        stageNode,
-        UsdMayaStageNode::outUsdStageAttr,
-        m_pointBasedDeformerNode,
-        UsdMayaPointBasedDeformerNode::inUsdStageAttr);
-    CHECK_MSTATUS(status);
-
-    // Connect the global Maya time to the deformer node.
-    status = dgMod.connect(
-        timeNode,
-        timePlug.attribute(),
-        m_pointBasedDeformerNode,
-        UsdMayaPointBasedDeformerNode::timeAttr);
-    CHECK_MSTATUS(status);
-
-    status = dgMod.doIt();
-    CHECK_MSTATUS(status);
-
-    return status;
+    return orientation == UsdGeomTokens->leftHanded;
 }
 
 MObject TranslatorMeshRead::meshObject() const { return m_meshObj; }
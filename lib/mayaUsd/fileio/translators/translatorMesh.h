@@ -28,6 +28,8 @@
 #include <maya/MObject.h>
 #include <maya/MString.h>
 
+#include <vector>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace MAYAUSD_NS_DEF {
@@ -37,6 +39,27 @@ namespace MAYAUSD_NS_DEF {
 class MAYAUSD_CORE_PUBLIC TranslatorMeshRead
 {
 public:
+    /// The USD topology, points and normals a Maya mesh is built from.
+    struct UsdData
+    {
+        VtIntArray          faceVertexCounts;
+        VtIntArray          faceVertexIndices;
+        VtVec3fArray        points;
+        VtVec3fArray        normals;
+        TfToken             normalsInterpolation;
+        std::vector<double> pointsTimeSamples;
+        bool                faceVertexCountsVarying = false;
+        bool                faceVertexIndicesVarying = false;
+    };
+
+    /// Reads the data of \p mesh at the first sample in \p frameRange, or at
+    /// the earliest time if the range is empty. This only reads from USD and
+    /// can be called from a worker thread ahead of the translation.
+    static void
+    ReadUsdData(const UsdGeomMesh& mesh, const GfInterval& frameRange, UsdData* usdData);
+
+    /// Creates the Maya mesh. When \p usdData is null, the USD data is read
+    /// with ReadUsdData first.
     TranslatorMeshRead(
         const UsdGeomMesh&        mesh,
         const UsdPrim&            prim,
@@ -45,7 +68,8 @@ public:
         const GfInterval&         frameRange,
         bool                      wantCacheAnimation,
         UsdMayaPrimReaderContext* context,
-        MStatus*                  status = nullptr);
+        MStatus*                  status = nullptr,
+        const UsdData*            usdData = nullptr);
 
     ~TranslatorMeshRead() = default;
 
@@ -61,8 +85,6 @@ public:
     SdfPath shapePath() const;
 
 private:
-    MStatus setPointBasedDeformerForMayaNode(const MObject&, const MObject&, const UsdPrim&);
-
     static bool isPrimitiveLeftHanded(const UsdGeomGprim& prim);
 
 private:
@@ -24,11 +24,15 @@
 #include <mayaUsd/fileio/translators/translatorXformable.h>
 #include <mayaUsd/fileio/utils/adaptor.h>
 #include <mayaUsd/fileio/utils/xformStack.h>
+#include <mayaUsd/nodes/pointBasedDeformerNode.h>
+#include <mayaUsd/nodes/stageNode.h>
 #include <mayaUsd/undo/OpUndoItems.h>
 #include <mayaUsd/utils/converter.h>
 #include <mayaUsd/utils/util.h>
 
+#include <pxr/base/tf/stringUtils.h>
 #include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
 #include <pxr/usd/sdf/schema.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usdGeom/xformable.h>
@@ -36,6 +40,7 @@
 #include <pxr/usd/usdLux/shapingAPI.h>
 #include <pxr/usd/usdShade/tokens.h>
 
+#include <maya/MDGModifier.h>
 #include <maya/MDagModifier.h>
 #include <maya/MDagPath.h>
 #include <maya/MFn.h>
@@ -43,6 +48,7 @@
 #include <maya/MFnDependencyNode.h>
 #include <maya/MGlobal.h>
 #include <maya/MObject.h>
+#include <maya/MPlug.h>
 #include <maya/MStatus.h>
 #include <maya/MString.h>
 
@@ -222,6 +228,86 @@ bool UsdMayaTranslatorUtil::CreateNode(
     return TF_VERIFY(!mayaNodeObj->isNull());
 }
 
+/* static */
+MStatus UsdMayaTranslatorUtil::CreatePointBasedDeformer(
+    const MObject& mayaObj,
+    const MObject& stageNode,
+    const UsdPrim& usdPrim,
+    MObject*       deformerNode,
+    MString*       deformerName)
+{
+    MStatus status { MS::kSuccess };
+
+    // Get the output time plug and node for Maya's global time object.
+    MPlug timePlug = UsdMayaUtil::GetMayaTimePlug();
+    if (timePlug.isNull()) {
+        status = MS::kFailure;
+    }
+
+    MObject timeNode = timePlug.node(&status);
+    CHECK_MSTATUS(status);
+
+    // Clear the selection list so that the deformer command doesn't try to add
+    // anything to the new deformer's set. We'll do that manually afterwards.
+    status = MGlobal::clearSelectionList();
+    CHECK_MSTATUS(status);
+
+    const MFnDagNode dagNodeFn(mayaObj, &status);
+    CHECK_MSTATUS(status);
+
+    status = MGlobal::selectByName(dagNodeFn.fullPathName().asChar());
+    CHECK_MSTATUS(status);
+
+    // Create the point based deformer node for this prim.
+    const std::string pointBasedDeformerNodeName = TfStringPrintf(
+        "usdPointBasedDeformerNode%s",
+        TfStringReplace(
+            usdPrim.GetPath().GetString(), SdfPathTokens->childDelimiter.GetString(), "_")
+            .c_str());
+
+    const std::string deformerCmd = TfStringPrintf(
+        "from maya import cmds; cmds.deformer(name=\'%s\', type=\'%s\')[0]",
+        pointBasedDeformerNodeName.c_str(),
+        UsdMayaPointBasedDeformerNodeTokens->MayaTypeName.GetText());
+    status = MGlobal::executePythonCommand(deformerCmd.c_str(), *deformerName);
+    CHECK_MSTATUS(status);
+
+    // Get the newly created point based deformer node.
+    status = UsdMayaUtil::GetMObjectByName(*deformerName, *deformerNode);
+    CHECK_MSTATUS(status);
+
+    MFnDependencyNode depNodeFn(*deformerNode, &status);
+    CHECK_MSTATUS(status);
+
+    MDGModifier& dgMod = MayaUsd::MDGModifierUndoItem::create("Deformer connection");
+
+    // Set the prim path on the deformer node.
+    MPlug primPathPlug
+        = depNodeFn.findPlug(UsdMayaPointBasedDeformerNode::primPathAttr, true, &status);
+    CHECK_MSTATUS(status);
+
+    status = dgMod.newPlugValueString(primPathPlug, usdPrim.GetPath().GetText());
+    CHECK_MSTATUS(status);
+
+    // Connect the stage node's stage output to the deformer node.
+    status = dgMod.connect(
+        stageNode,
+        UsdMayaStageNode::outUsdStageAttr,
+        *deformerNode,
+        UsdMayaPointBasedDeformerNode::inUsdStageAttr);
+    CHECK_MSTATUS(status);
+
+    // Connect the global Maya time to the deformer node.
+    status = dgMod.connect(
+        timeNode, timePlug.attribute(), *deformerNode, UsdMayaPointBasedDeformerNode::timeAttr);
+    CHECK_MSTATUS(status);
+
+    status = dgMod.doIt();
+    CHECK_MSTATUS(status);
+
+    return status;
+}
+
 /* static */
 bool UsdMayaTranslatorUtil::CreateShaderNode(
     const MString&               nodeName,
@@ -131,6 +131,20 @@ struct UsdMayaTranslatorUtil
         MStatus*       status,
         MObject*       mayaNodeObj);
 
+    /// \brief Deforms \p mayaObj with a new point based deformer node that
+    /// reads the points of \p usdPrim from the stage output by \p stageNode,
+    /// driven by Maya's global time. Points are streamed from USD on demand,
+    /// so no per-time-sample geometry is created in the Maya scene. The new
+    /// deformer node and its name are returned in \p deformerNode and
+    /// \p deformerName so that the caller can register them for undo/redo.
+    MAYAUSD_CORE_PUBLIC
+    static MStatus CreatePointBasedDeformer(
+        const MObject& mayaObj,
+        const MObject& stageNode,
+        const UsdPrim& usdPrim,
+        MObject*       deformerNode,
+        MString*       deformerName);
+
     /// \brief Helper to create shadingNodes. Wrapper around mel "shadingNode".
     ///
     /// This does several things beyond just creating the node, including but
@@ -30,6 +30,7 @@
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/base/vt/array.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usdGeom/mesh.h>
@@ -56,6 +57,11 @@
 #include <maya/MStatus.h>
 #include <maya/MUintArray.h>
 
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 // clang-format off
@@ -229,7 +235,9 @@ int UsdMayaJointUtil::getCompressedSkinWeights(
     const MFnMesh&        mesh,
     const MFnSkinCluster& skinCluster,
     VtIntArray*           usdJointIndices,
-    VtFloatArray*         usdJointWeights)
+    VtFloatArray*         usdJointWeights,
+    const double          weightEpsilon,
+    const int             maxInfluences)
 {
     // Get the single output dag path from the skin cluster.
     // Note that we can't get the dag path from the mesh because it's the input
@@ -274,41 +282,88 @@ int UsdMayaJointUtil::getCompressedSkinWeights(
         throw std::runtime_error(msg.asChar());
     }
 
+    // Gather the influences of a point whose magnitude is above the epsilon,
+    // keeping only the strongest ones if their number is capped.
+    using Influences = std::vector<std::pair<float, int>>;
+    auto gatherInfluences = [&](size_t vert, Influences& influences) {
+        influences.clear();
+        const unsigned int offset = static_cast<unsigned int>(vert) * numInfluences;
+        bool               pruned = false;
+        for (unsigned int i = 0; i < numInfluences; ++i) {
+            const double weight = weights[offset + i];
+            if (std::abs(weight) > weightEpsilon) {
+                influences.emplace_back(static_cast<float>(weight), static_cast<int>(i));
+            } else if (weight != 0.0) {
+                pruned = true;
+            }
+        }
+
+        if (maxInfluences > 0 && influences.size() > static_cast<size_t>(maxInfluences)) {
+            std::partial_sort(
+                influences.begin(),
+                influences.begin() + maxInfluences,
+                influences.end(),
+                [](const std::pair<float, int>& a, const std::pair<float, int>& b) {
+                    return std::abs(a.first) > std::abs(b.first);
+                });
+            influences.resize(maxInfluences);
+            pruned = true;
+        }
+
+        // Renormalize the remaining weights if any were dropped, so that
+        // the point is not shrunk towards the origin.
+        if (pruned) {
+            float sum = 0.0f;
+            for (const auto& influence : influences) {
+                sum += influence.first;
+            }
+            if (sum > 0.0f) {
+                for (auto& influence : influences) {
+                    influence.first /= sum;
+                }
+            }
+        }
+    };
+
     // Determine how many influence/weight "slots" we actually need per point.
     // For example, if there are the joints /a, /a/b, and /a/c, but each point
     // only has non-zero weighting for a single joint, then we only need one
-    // slot instead of three.
-    int maxInfluenceCount = 0;
-    for (unsigned int vert = 0; vert < numVertices; ++vert) {
-        // Looping through each vertex.
-        const unsigned int offset = vert * numInfluences;
-        int                influenceCount = 0;
-        for (unsigned int i = 0; i < numInfluences; ++i) {
-            // Looping through each weight for vertex.
-            if (weights[offset + i] != 0.0) {
-                influenceCount++;
-            }
+    // slot instead of three. Points are independent, so they are processed in
+    // parallel, each chunk reusing a single scratch buffer.
+    std::vector<size_t> influenceCounts(numVertices, 0);
+    WorkParallelForN(numVertices, [&](size_t begin, size_t end) {
+        Influences influences;
+        influences.reserve(numInfluences);
+        for (size_t vert = begin; vert < end; ++vert) {
+            gatherInfluences(vert, influences);
+            influenceCounts[vert] = influences.size();
         }
-        maxInfluenceCount = std::max(maxInfluenceCount, influenceCount);
+    });
+    size_t maxInfluenceCount = 0;
+    for (const size_t count : influenceCounts) {
+        maxInfluenceCount = std::max(maxInfluenceCount, count);
     }
 
+    // The influences are gathered again rather than kept, so that only one
+    // buffer per chunk is needed instead of one per point.
     usdJointIndices->assign(maxInfluenceCount * numVertices, 0);
     usdJointWeights->assign(maxInfluenceCount * numVertices, 0.0);
-    for (unsigned int vert = 0; vert < numVertices; ++vert) {
-        // Looping through each vertex.
-        const unsigned int inputOffset = vert * numInfluences;
-        int                outputOffset = vert * maxInfluenceCount;
-        for (unsigned int i = 0; i < numInfluences; ++i) {
-            // Looping through each weight for vertex.
-            float weight = weights[inputOffset + i];
-            if (!GfIsClose(weight, 0.0, 1e-8)) {
-                (*usdJointIndices)[outputOffset] = i;
-                (*usdJointWeights)[outputOffset] = weight;
+    int*   jointIndices = usdJointIndices->data();
+    float* jointWeights = usdJointWeights->data();
+    WorkParallelForN(numVertices, [&](size_t begin, size_t end) {
+        Influences influences;
+        influences.reserve(numInfluences);
+        for (size_t vert = begin; vert < end; ++vert) {
+            gatherInfluences(vert, influences);
+            size_t outputOffset = vert * maxInfluenceCount;
+            for (const auto& influence : influences) {
+                jointIndices[outputOffset] = influence.second;
+                jointWeights[outputOffset] = influence.first;
                 outputOffset++;
             }
         }
-    }
-    return maxInfluenceCount;
+    });
+    return static_cast<int>(maxInfluenceCount);
 }
 
 void UsdMayaJointUtil::warnForPostDeformationTransform(
@@ -356,25 +411,55 @@ bool UsdMayaJointUtil::getGeomBindTransform(
 bool UsdMayaJointUtil::writeJointInfluences(
     const MFnSkinCluster&    skinCluster,
     const MFnMesh&           inMesh,
-    const UsdSkelBindingAPI& binding)
+    const UsdSkelBindingAPI& binding,
+    const double             weightEpsilon,
+    const int                maxInfluences,
+    const bool               verbose)
 {
     // The data in the skinCluster is essentially already in the same format
     // as UsdSkel expects, but we're going to compress it by only outputting
     // the nonzero weights.
     VtIntArray   jointIndices;
     VtFloatArray jointWeights;
-    int          maxInfluenceCount
-        = getCompressedSkinWeights(inMesh, skinCluster, &jointIndices, &jointWeights);
+    int          maxInfluenceCount = getCompressedSkinWeights(
+        inMesh, skinCluster, &jointIndices, &jointWeights, weightEpsilon, maxInfluences);
 
     if (maxInfluenceCount <= 0)
         return false;
 
-    UsdSkelSortInfluences(&jointIndices, &jointWeights, maxInfluenceCount);
+    // A mesh whose points are all fully bound to the same joint is rigidly
+    // bound, so a single constant influence describes it.
+    const int*   indices = jointIndices.cdata();
+    const float* weights = jointWeights.cdata();
+    bool         isRigid = maxInfluenceCount == 1;
+    for (size_t i = 0; isRigid && i < jointIndices.size(); ++i) {
+        isRigid = indices[i] == indices[0] && GfIsClose(weights[i], 1.0f, 1e-6);
+    }
+    if (isRigid) {
+        jointIndices = VtIntArray(1, jointIndices[0]);
+        jointWeights = VtFloatArray(1, 1.0f);
+    } else {
+        UsdSkelSortInfluences(&jointIndices, &jointWeights, maxInfluenceCount);
+    }
+
+    if (verbose) {
+        MDagPathArray influenceObjects;
+        skinCluster.influenceObjects(influenceObjects);
+        const size_t numDenseWeights
+            = static_cast<size_t>(inMesh.numVertices()) * influenceObjects.length();
+        TF_STATUS(
+            "Skin weights of <%s>: %zu of %zu weights written (%.1f%%)%s",
+            binding.GetPrim().GetPath().GetText(),
+            jointWeights.size(),
+            numDenseWeights,
+            numDenseWeights > 0 ? 100.0 * jointWeights.size() / numDenseWeights : 0.0,
+            isRigid ? ", rigidly bound" : "");
+    }
 
-    UsdGeomPrimvar indicesPrimvar = binding.CreateJointIndicesPrimvar(false, maxInfluenceCount);
+    UsdGeomPrimvar indicesPrimvar = binding.CreateJointIndicesPrimvar(isRigid, maxInfluenceCount);
     indicesPrimvar.Set(jointIndices);
 
-    UsdGeomPrimvar weightsPrimvar = binding.CreateJointWeightsPrimvar(false, maxInfluenceCount);
+    UsdGeomPrimvar weightsPrimvar = binding.CreateJointWeightsPrimvar(isRigid, maxInfluenceCount);
     weightsPrimvar.Set(jointWeights);
 
     return true;
@@ -430,7 +515,10 @@ MObject UsdMayaJointUtil::writeSkinningData(
     const MDagPath&            dagPath,
     SdfPath&                   skelPath,
     const bool                 stripNamespaces,
-    FlexibleSparseValueWriter* valueWriter)
+    FlexibleSparseValueWriter* valueWriter,
+    const double               weightEpsilon,
+    const int                  maxInfluences,
+    const bool                 verbose)
 {
     // Figure out if we even have a skin cluster in the first place.
     MObject skinClusterObj = UsdMayaJointUtil::getSkinCluster(dagPath);
@@ -476,7 +564,8 @@ MObject UsdMayaJointUtil::writeSkinningData(
     const UsdSkelBindingAPI bindingAPI
         = UsdMayaTranslatorUtil::GetAPISchemaForAuthoring<UsdSkelBindingAPI>(primSchema.GetPrim());
 
-    if (UsdMayaJointUtil::writeJointInfluences(skinCluster, inMesh, bindingAPI)) {
+    if (UsdMayaJointUtil::writeJointInfluences(
+            skinCluster, inMesh, bindingAPI, weightEpsilon, maxInfluences, verbose)) {
         UsdMayaJointUtil::writeJointOrder(rootJoint, jointDagPaths, bindingAPI, stripNamespaces);
     }
 
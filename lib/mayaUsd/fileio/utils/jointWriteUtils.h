@@ -104,12 +104,18 @@ MObject getInputMesh(const MFnSkinCluster& skinCluster);
 /// Gets skin weights, and compresses them into the form expected by
 /// UsdSkelBindingAPI, which allows us to omit zero-weight influences from the
 /// joint weights list.
+/// Weights at or below \p weightEpsilon are omitted. If \p maxInfluences is
+/// positive, only the strongest \p maxInfluences influences of each point are
+/// kept. The weights of points that lost influences are renormalized.
+/// Returns the number of influences written per point.
 MAYAUSD_CORE_PUBLIC
 int getCompressedSkinWeights(
     const MFnMesh&        mesh,
     const MFnSkinCluster& skinCluster,
     VtIntArray*           usdJointIndices,
-    VtFloatArray*         usdJointWeights);
+    VtFloatArray*         usdJointWeights,
+    const double          weightEpsilon = 1e-8,
+    const int             maxInfluences = 0);
 
 /// Check if a skinned primitive has an unsupported post-deformation
 /// transformation. These transformations aren't represented in UsdSkel.
@@ -144,11 +150,17 @@ MAYAUSD_CORE_PUBLIC
 MDagPath getRootJoint(const std::vector<MDagPath>& jointDagPaths);
 
 /// Compute and write joint influences.
+/// See getCompressedSkinWeights() for \p weightEpsilon and \p maxInfluences.
+/// Meshes rigidly bound to a single joint get constant influences.
+/// If \p verbose is true, the compression achieved is reported.
 MAYAUSD_CORE_PUBLIC
 bool writeJointInfluences(
     const MFnSkinCluster&    skinCluster,
     const MFnMesh&           inMesh,
-    const UsdSkelBindingAPI& binding);
+    const UsdSkelBindingAPI& binding,
+    const double             weightEpsilon = 1e-8,
+    const int                maxInfluences = 0,
+    const bool               verbose = false);
 
 MAYAUSD_CORE_PUBLIC
 bool writeJointOrder(
@@ -173,7 +185,10 @@ MObject writeSkinningData(
     const MDagPath&            dagPath,
     SdfPath&                   skelPath,
     const bool                 stripNamespaces,
-    FlexibleSparseValueWriter* valueWriter);
+    FlexibleSparseValueWriter* valueWriter,
+    const double               weightEpsilon = 1e-8,
+    const int                  maxInfluences = 0,
+    const bool                 verbose = false);
 } // namespace UsdMayaJointUtil
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -48,8 +48,6 @@
 #include <maya/MFnTypedAttribute.h>
 #include <maya/MGlobal.h>
 #include <maya/MIntArray.h>
-#include <maya/MItMeshEdge.h>
-#include <maya/MItMeshFaceVertex.h>
 #include <maya/MItMeshVertex.h>
 #include <maya/MPlug.h>
 #include <maya/MPointArray.h>
@@ -57,6 +55,10 @@
 #include <maya/MStatus.h>
 #include <maya/MUintArray.h>
 
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DEFINE_PUBLIC_TOKENS(UsdMayaMeshPrimvarTokens, PXRUSDMAYA_MESH_PRIMVAR_TOKENS);
@@ -157,25 +159,98 @@ bool addCreaseSet(
     return true;
 }
 
+//! Face-vertex topology of a Maya mesh, queried once per mesh and shared by
+//! all of the UV set and color set primvars assigned to it.
+class MeshFaceVertexTopology
+{
+public:
+    MeshFaceVertexTopology(const MFnMesh& meshFn)
+        : _meshFn(meshFn)
+    {
+    }
+
+    //! Returns false if the mesh topology could not be queried.
+    bool IsValid() { return _EnsureVertices(); }
+
+    //! Number of face-vertices in each face.
+    const MIntArray& GetFaceVertexCounts()
+    {
+        _EnsureVertices();
+        return _faceVertexCounts;
+    }
+
+    //! Vertex id of each face-vertex.
+    const MIntArray& GetFaceVertexIndices()
+    {
+        _EnsureVertices();
+        return _faceVertexIndices;
+    }
+
+    //! Face id of each face-vertex.
+    const MIntArray& GetFaceIds()
+    {
+        if (!_faceIdsComputed && _EnsureVertices()) {
+            _faceIds.setLength(_faceVertexIndices.length());
+            unsigned int fvi = 0;
+            for (unsigned int faceId = 0; faceId < _faceVertexCounts.length(); ++faceId) {
+                const int numFaceVertices = _faceVertexCounts[faceId];
+                for (int i = 0; i < numFaceVertices; ++i) {
+                    _faceIds[fvi++] = faceId;
+                }
+            }
+            _faceIdsComputed = true;
+        }
+        return _faceIds;
+    }
+
+private:
+    bool _EnsureVertices()
+    {
+        if (!_verticesQueried) {
+            _verticesQueried = true;
+            _verticesValid
+                = (_meshFn.getVertices(_faceVertexCounts, _faceVertexIndices) == MS::kSuccess);
+        }
+        return _verticesValid;
+    }
+
+    const MFnMesh& _meshFn;
+    MIntArray      _faceVertexCounts;
+    MIntArray      _faceVertexIndices;
+    MIntArray      _faceIds;
+    bool           _verticesQueried = false;
+    bool           _verticesValid = false;
+    bool           _faceIdsComputed = false;
+};
+
 MIntArray getMayaFaceVertexAssignmentIds(
-    const MFnMesh&    meshFn,
-    const TfToken&    interpolation,
-    const VtIntArray& assignmentIndices,
-    const int         unauthoredValuesIndex)
+    MeshFaceVertexTopology& topology,
+    const TfToken&          interpolation,
+    const VtIntArray&       assignmentIndices,
+    const int               unauthoredValuesIndex)
 {
-    MIntArray valueIds(meshFn.numFaceVertices(), -1);
+    const MIntArray&   faceVertexIndices = topology.GetFaceVertexIndices();
+    const unsigned int numFaceVertices = faceVertexIndices.length();
+
+    MIntArray valueIds(numFaceVertices, -1);
+
+    // Resolve the interpolation once up front. Constant (and unknown)
+    // interpolation assigns the first value to every face-vertex.
+    const MIntArray* componentIds = nullptr;
+    bool             faceVarying = false;
+    if (interpolation == UsdGeomTokens->uniform) {
+        componentIds = &topology.GetFaceIds();
+    } else if (interpolation == UsdGeomTokens->vertex) {
+        componentIds = &faceVertexIndices;
+    } else if (interpolation == UsdGeomTokens->faceVarying) {
+        faceVarying = true;
+    }
 
-    MItMeshFaceVertex itFV(meshFn.object());
-    unsigned int      fvi = 0;
-    for (itFV.reset(); !itFV.isDone(); itFV.next(), ++fvi) {
+    for (unsigned int fvi = 0; fvi < numFaceVertices; ++fvi) {
         int valueId = 0;
-        if (interpolation == UsdGeomTokens->constant) {
-            valueId = 0;
-        } else if (interpolation == UsdGeomTokens->uniform) {
-            valueId = itFV.faceId();
-        } else if (interpolation == UsdGeomTokens->vertex) {
-            valueId = itFV.vertId();
-        } else if (interpolation == UsdGeomTokens->faceVarying) {
+        if (componentIds) {
+            valueId = (*componentIds)[fvi];
+        } else if (faceVarying) {
             valueId = fvi;
         }
 
@@ -199,6 +274,7 @@ MIntArray getMayaFaceVertexAssignmentIds(
 bool assignUVSetPrimvarToMesh(
     const UsdGeomPrimvar&                     primvar,
     MFnMesh&                                  meshFn,
+    MeshFaceVertexTopology&                   topology,
     bool&                                     firstUVPrimvar,
     const std::map<std::string, std::string>& uvSetNameRemappings)
 {
@@ -299,12 +375,7 @@ bool assignUVSetPrimvarToMesh(
 
     // Build an array of value assignments for each face vertex in the mesh.
     // Any assignments left as -1 will not be assigned a value.
-    MIntArray uvIds = getMayaFaceVertexAssignmentIds(meshFn, interpolation, assignmentIndices, -1);
-
-    MIntArray vertexCounts;
-    MIntArray vertexList;
-    status = meshFn.getVertices(vertexCounts, vertexList);
-    if (status != MS::kSuccess) {
+    if (!topology.IsValid()) {
         TF_WARN(
             "Could not get vertex counts for UV set '%s' on mesh: %s",
             uvSetName.asChar(),
@@ -312,7 +383,10 @@ bool assignUVSetPrimvarToMesh(
         return false;
     }
 
-    status = meshFn.assignUVs(vertexCounts, uvIds, &uvSetName);
+    MIntArray uvIds
+        = getMayaFaceVertexAssignmentIds(topology, interpolation, assignmentIndices, -1);
+
+    status = meshFn.assignUVs(topology.GetFaceVertexCounts(), uvIds, &uvSetName);
     if (status != MS::kSuccess) {
         TF_WARN(
             "Could not assign UV values to UV set '%s' on mesh: %s",
@@ -325,9 +399,10 @@ bool assignUVSetPrimvarToMesh(
 }
 
 bool assignColorSetPrimvarToMesh(
-    const UsdGeomMesh&    mesh,
-    const UsdGeomPrimvar& primvar,
-    MFnMesh&              meshFn)
+    const UsdGeomMesh&      mesh,
+    const UsdGeomPrimvar&   primvar,
+    MFnMesh&                meshFn,
+    MeshFaceVertexTopology& topology)
 {
 
     const TfToken&          primvarName = primvar.GetPrimvarName();
@@ -505,7 +580,7 @@ bool assignColorSetPrimvarToMesh(
     // Build an array of value assignments for each face vertex in the mesh.
     // Any assignments left as -1 will not be assigned a value.
     MIntArray colorIds = getMayaFaceVertexAssignmentIds(
-        meshFn, interpolation, assignmentIndices, unauthoredValuesIndex);
+        topology, interpolation, assignmentIndices, unauthoredValuesIndex);
 
     status = meshFn.assignColors(colorIds, &colorSetName);
     if (status != MS::kSuccess) {
@@ -619,6 +694,10 @@ void UsdMayaMeshReadUtils::assignPrimvarsToMesh(
     const std::vector<UsdGeomPrimvar> primvars = UsdGeomPrimvarsAPI(mesh).GetPrimvars();
     bool                              firstUVPrimvar = true;
 
+    // The face-vertex topology is only queried if a UV set or color set
+    // primvar is found, and then shared between all of them.
+    MeshFaceVertexTopology topology(meshFn);
+
     for (const UsdGeomPrimvar& primvar : primvars) {
         const TfToken          name = primvar.GetBaseName();
         const TfToken          fullName = primvar.GetPrimvarName();
@@ -673,7 +752,8 @@ void UsdMayaMeshReadUtils::assignPrimvarsToMesh(
             // Otherwise, if env variable for reading Float2
             // as uv sets is turned on, we assume that Float2Array primvars
             // are UV sets.
-            if (!assignUVSetPrimvarToMesh(primvar, meshFn, firstUVPrimvar, uvSetNameRemappings)) {
+            if (!assignUVSetPrimvarToMesh(
+                    primvar, meshFn, topology, firstUVPrimvar, uvSetNameRemappings)) {
                 TF_WARN(
                     "Unable to retrieve and assign data for UV set <%s> on "
                     "mesh <%s>",
@@ -685,7 +765,7 @@ void UsdMayaMeshReadUtils::assignPrimvarsToMesh(
             || typeName == SdfValueTypeNames->Color3fArray
             || typeName == SdfValueTypeNames->Float4Array
             || typeName == SdfValueTypeNames->Color4fArray) {
-            if (!assignColorSetPrimvarToMesh(mesh, primvar, meshFn)) {
+            if (!assignColorSetPrimvarToMesh(mesh, primvar, meshFn, topology)) {
                 TF_WARN(
                     "Unable to retrieve and assign data for color set <%s> "
                     "on mesh <%s>",
@@ -828,11 +908,34 @@ MStatus UsdMayaMeshReadUtils::assignSubDivTagsToMesh(
         if (subdCreaseLengths.size() == subdCreaseSharpnesses.size()) {
             MUintArray   mayaCreaseEdgeIds;
             MDoubleArray mayaCreaseEdgeValues;
-            MIntArray    connectedEdges;
             unsigned int creaseIndexBase = 0;
 
             statusOK.clear();
 
+            // Crease edges are authored as vertex id pairs, so index the mesh
+            // edges by their (unordered) vertex pair once rather than walking
+            // the edges connected to each crease vertex.
+            auto edgeKey = [](int v0, int v1) {
+                if (v0 > v1) {
+                    std::swap(v0, v1);
+                }
+                return (static_cast<uint64_t>(static_cast<uint32_t>(v0)) << 32)
+                    | static_cast<uint32_t>(v1);
+            };
+            std::unordered_map<uint64_t, int> edgeIdsPerVertexPair;
+            const int                         numEdges = meshFn.numEdges();
+            edgeIdsPerVertexPair.reserve(numEdges);
+            for (int edgeId = 0; edgeId < numEdges; ++edgeId) {
+                int2 edgeVertices;
+                statusOK = meshFn.getEdgeVertices(edgeId, edgeVertices);
+                if (!statusOK)
+                    break;
+                edgeIdsPerVertexPair.emplace(edgeKey(edgeVertices[0], edgeVertices[1]), edgeId);
+            }
+
+            // Edges are added to the crease sets as one component per weight.
+            std::unordered_map<float, MIntArray> edgeIdsPerWeight;
+
             for (unsigned int creaseGroup = 0; statusOK && creaseGroup < subdCreaseLengths.size();
                  creaseIndexBase += subdCreaseLengths[creaseGroup++]) {
 
@@ -840,46 +943,37 @@ MStatus UsdMayaMeshReadUtils::assignSubDivTagsToMesh(
                 if (subdCreaseSharpnesses[creaseGroup] == 0)
                     continue;
 
-                MItMeshVertex vertIt(meshObj);
-                MItMeshEdge   edgeIt(meshObj);
-
-                for (int i = 0; statusOK && i < subdCreaseLengths[creaseGroup] - 1; i++) {
+                for (int i = 0; i < subdCreaseLengths[creaseGroup] - 1; i++) {
                     // Find the edgeId associated with the 2 vertIds.
-                    int prevIndexDummy; // dummy param
-                    statusOK
-                        = vertIt.setIndex(subdCreaseIndices[creaseIndexBase + i], prevIndexDummy);
+                    const auto edgeIt = edgeIdsPerVertexPair.find(edgeKey(
+                        subdCreaseIndices[creaseIndexBase + i],
+                        subdCreaseIndices[creaseIndexBase + i + 1]));
+                    if (edgeIt == edgeIdsPerVertexPair.end())
+                        continue;
+
+                    const int edgeIndex = edgeIt->second;
+                    if (USE_CREASE_SETS) {
+                        edgeIdsPerWeight[subdCreaseSharpnesses[creaseGroup]].append(edgeIndex);
+                    } else {
+                        mayaCreaseEdgeIds.append(edgeIndex);
+                        mayaCreaseEdgeValues.append(subdCreaseSharpnesses[creaseGroup]);
+                    }
+                }
+            }
+
+            if (statusOK && USE_CREASE_SETS) {
+                for (const auto& edgeIds : edgeIdsPerWeight) {
+                    MFnSingleIndexedComponent edgeComponentFn;
+                    MObject                   edgeComponent
+                        = edgeComponentFn.create(MFn::kMeshEdgeComponent, &statusOK);
                     if (!statusOK)
                         break;
-                    statusOK = vertIt.getConnectedEdges(connectedEdges);
+                    statusOK = edgeComponentFn.addElements(edgeIds.second);
+                    if (!statusOK)
+                        break;
+                    statusOK = elemsPerWeight[edgeIds.first].add(meshPath, edgeComponent);
                     if (!statusOK)
                         break;
-
-                    int edgeIndex = -1;
-                    for (unsigned int e = 0; statusOK && e < connectedEdges.length(); e++) {
-                        int tmpOppositeVertexId;
-                        statusOK = vertIt.getOppositeVertex(tmpOppositeVertexId, connectedEdges[e]);
-                        if (!statusOK)
-                            break;
-                        if (subdCreaseIndices[creaseIndexBase + i + 1] == tmpOppositeVertexId) {
-                            edgeIndex = connectedEdges[e];
-                            break;
-                        }
-                    }
-                    if (statusOK && edgeIndex != -1) {
-                        if (USE_CREASE_SETS) {
-                            int prevIndexDummy; // dummy param
-                            statusOK = edgeIt.setIndex(edgeIndex, prevIndexDummy);
-                            if (!statusOK)
-                                break;
-                            statusOK = elemsPerWeight[subdCreaseSharpnesses[creaseGroup]].add(
-                                meshPath, edgeIt.currentItem());
-                            if (!statusOK)
-                                break;
-                        } else {
-                            mayaCreaseEdgeIds.append(edgeIndex);
-                            mayaCreaseEdgeValues.append(subdCreaseSharpnesses[creaseGroup]);
-                        }
-                    }
                 }
             }
 
@@ -70,6 +70,17 @@ TF_DEFINE_ENV_SETTING(
     false,
     "Enables area selection of objects occluded in depth");
 
+// Resolving selections on the CPU avoids rendering an id buffer for every
+// selection, but keeps a copy of the triangles of every mesh that has been
+// tested for intersection, so it is disabled by default. Like depth
+// selection, it can be toggled within a Maya session with an attribute on the
+// pxrHdImagingShape.
+TF_DEFINE_ENV_SETTING(
+    PXRMAYAHD_ENABLE_CPU_PICKING,
+    false,
+    "Enables resolving selections against cached mesh triangles on the CPU "
+    "when possible");
+
 TF_DEFINE_PUBLIC_TOKENS(PxrMayaHdImagingShapeTokens, PXRUSDMAYA_HD_IMAGING_SHAPE_TOKENS);
 
 const MTypeId PxrMayaHdImagingShape::typeId(0x00126402);
@@ -78,6 +89,7 @@ const MString PxrMayaHdImagingShape::typeName(PxrMayaHdImagingShapeTokens->MayaT
 // Attributes
 MObject PxrMayaHdImagingShape::selectionResolutionAttr;
 MObject PxrMayaHdImagingShape::enableDepthSelectionAttr;
+MObject PxrMayaHdImagingShape::enableCpuPickingAttr;
 
 namespace {
 
@@ -151,6 +163,22 @@ MStatus PxrMayaHdImagingShape::initialize()
     status = addAttribute(enableDepthSelectionAttr);
     CHECK_MSTATUS_AND_RETURN_IT(status);
 
+    const bool enableCpuPicking = TfGetEnvSetting(PXRMAYAHD_ENABLE_CPU_PICKING);
+
+    enableCpuPickingAttr = numericAttrFn.create(
+        "enableCpuPicking", "ecp", MFnNumericData::kBoolean, 0.0, &status);
+    CHECK_MSTATUS_AND_RETURN_IT(status);
+    status = numericAttrFn.setDefault(enableCpuPicking);
+    CHECK_MSTATUS_AND_RETURN_IT(status);
+    status = numericAttrFn.setInternal(true);
+    CHECK_MSTATUS_AND_RETURN_IT(status);
+    status = numericAttrFn.setStorable(false);
+    CHECK_MSTATUS_AND_RETURN_IT(status);
+    status = numericAttrFn.setAffectsAppearance(true);
+    CHECK_MSTATUS_AND_RETURN_IT(status);
+    status = addAttribute(enableCpuPickingAttr);
+    CHECK_MSTATUS_AND_RETURN_IT(status);
+
     return MS::kSuccess;
 }
 
@@ -298,7 +326,8 @@ void PxrMayaHdImagingShape::postConstructor()
 /* virtual */
 bool PxrMayaHdImagingShape::getInternalValue(const MPlug& plug, MDataHandle& dataHandle)
 {
-    if (plug == selectionResolutionAttr || plug == enableDepthSelectionAttr) {
+    if (plug == selectionResolutionAttr || plug == enableDepthSelectionAttr
+        || plug == enableCpuPickingAttr) {
         // We just want notification of attribute gets and sets. We return
         // false here to tell Maya that it should still manage storage of the
         // value in the data block.
@@ -311,7 +340,8 @@ bool PxrMayaHdImagingShape::getInternalValue(const MPlug& plug, MDataHandle& dat
 /* virtual */
 bool PxrMayaHdImagingShape::setInternalValue(const MPlug& plug, const MDataHandle& dataHandle)
 {
-    if (plug == selectionResolutionAttr || plug == enableDepthSelectionAttr) {
+    if (plug == selectionResolutionAttr || plug == enableDepthSelectionAttr
+        || plug == enableCpuPickingAttr) {
         // If these attributes are changed, we mark the HdImagingShape as
         // needing to be redrawn, which is when we'll pull the new values from
         // the shape and pass them to the batch renderer.
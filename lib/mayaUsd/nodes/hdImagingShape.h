@@ -66,6 +66,8 @@ public:
     static MObject selectionResolutionAttr;
     MAYAUSD_CORE_PUBLIC
     static MObject enableDepthSelectionAttr;
+    MAYAUSD_CORE_PUBLIC
+    static MObject enableCpuPickingAttr;
 
     MAYAUSD_CORE_PUBLIC
     static void* creator();
@@ -17,7 +17,6 @@
 
 #include <mayaUsd/nodes/stageData.h>
 
-#include <pxr/base/gf/math.h>
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/base/tf/stringUtils.h>
@@ -38,11 +37,13 @@
 #include <maya/MFnStringData.h>
 #include <maya/MFnTypedAttribute.h>
 #include <maya/MFnUnitAttribute.h>
+#include <maya/MIntArray.h>
 #include <maya/MItGeometry.h>
 #include <maya/MMatrix.h>
 #include <maya/MObject.h>
 #include <maya/MPlug.h>
 #include <maya/MPoint.h>
+#include <maya/MPointArray.h>
 #include <maya/MPxDeformerNode.h>
 #include <maya/MStatus.h>
 #include <maya/MString.h>
@@ -147,12 +148,6 @@ MStatus UsdMayaPointBasedDeformerNode::deform(
 
     const SdfPath primPath(primPathString);
 
-    const UsdPrim&          usdPrim = usdStage->GetPrimAtPath(primPath);
-    const UsdGeomPointBased usdPointBased(usdPrim);
-    if (!usdPointBased) {
-        return MS::kFailure;
-    }
-
     const MDataHandle timeHandle = block.inputValue(timeAttr, &status);
     CHECK_MSTATUS_AND_RETURN_IT(status);
     const UsdTimeCode usdTime(timeHandle.asTime().value());
@@ -162,28 +157,95 @@ MStatus UsdMayaPointBasedDeformerNode::deform(
     const float envelope = envelopeHandle.asFloat();
 
     VtVec3fArray usdPoints;
-    if (!usdPointBased.GetPointsAttr().Get(&usdPoints, usdTime) || usdPoints.empty()) {
+    if (!_GetPoints(usdStage, primPath, usdTime, &usdPoints) || usdPoints.empty()) {
         return MS::kFailure;
     }
 
-    for (; !iter.isDone(); iter.next()) {
-        const int index = iter.index();
-        if (index < 0 || static_cast<size_t>(index) >= usdPoints.size()) {
+    // Read and write all the positions at once rather than one point at a
+    // time; only the component indices are gathered from the iterator.
+    MPointArray mayaPoints;
+    status = iter.allPositions(mayaPoints);
+    CHECK_MSTATUS_AND_RETURN_IT(status);
+
+    MIntArray    indices(mayaPoints.length(), -1);
+    unsigned int i = 0u;
+    for (iter.reset(); !iter.isDone() && i < indices.length(); iter.next(), ++i) {
+        indices[i] = iter.index();
+    }
+
+    const size_t numUsdPoints = usdPoints.size();
+    for (i = 0u; i < mayaPoints.length(); ++i) {
+        const int index = indices[i];
+        if (index < 0 || static_cast<size_t>(index) >= numUsdPoints) {
             continue;
         }
 
-        const MPoint mayaPoint = iter.position();
-        const float  weight = weightValue(block, multiIndex, index);
-
         const GfVec3f& usdPoint = usdPoints[static_cast<size_t>(index)];
+        const float    weight = envelope * weightValue(block, multiIndex, index);
+
+        MPoint& mayaPoint = mayaPoints[i];
+        if (weight == 1.0f) {
+            mayaPoint.x = usdPoint[0];
+            mayaPoint.y = usdPoint[1];
+            mayaPoint.z = usdPoint[2];
+        } else {
+            mayaPoint.x += weight * (usdPoint[0] - mayaPoint.x);
+            mayaPoint.y += weight * (usdPoint[1] - mayaPoint.y);
+            mayaPoint.z += weight * (usdPoint[2] - mayaPoint.z);
+        }
+    }
 
-        const GfVec3f deformedPoint = GfLerp<GfVec3f>(
-            weight * envelope, GfVec3f(mayaPoint[0], mayaPoint[1], mayaPoint[2]), usdPoint);
+    return iter.setAllPositions(mayaPoints);
+}
 
-        iter.setPosition(MPoint(deformedPoint[0], deformedPoint[1], deformedPoint[2]));
+bool UsdMayaPointBasedDeformerNode::_GetPoints(
+    const UsdStageRefPtr& usdStage,
+    const SdfPath&        primPath,
+    const UsdTimeCode&    usdTime,
+    VtVec3fArray*         points)
+{
+    std::lock_guard<std::mutex> lock(_cacheMutex);
+
+    if (_cachedStage != usdStage || _cachedPrimPath != primPath || !_cachedPointsQuery.IsValid()) {
+        const UsdGeomPointBased usdPointBased(usdStage->GetPrimAtPath(primPath));
+        if (!usdPointBased) {
+            return false;
+        }
+
+        if (_cachedStage != usdStage) {
+            _stageNoticeListener.SetStageObjectsChangedCallback(
+                [this](const UsdNotice::ObjectsChanged& notice) {
+                    _OnStageObjectsChanged(notice);
+                });
+            _stageNoticeListener.SetStage(usdStage);
+        }
+
+        _cachedStage = usdStage;
+        _cachedPrimPath = primPath;
+        _cachedPointsQuery = UsdAttributeQuery(usdPointBased.GetPointsAttr());
+        _cachedPoints = VtVec3fArray();
+    } else if (!_cachedPoints.empty() && _cachedTime == usdTime) {
+        *points = _cachedPoints;
+        return true;
     }
 
-    return status;
+    if (!_cachedPointsQuery.Get(&_cachedPoints, usdTime)) {
+        _cachedPoints = VtVec3fArray();
+        return false;
+    }
+
+    _cachedTime = usdTime;
+    *points = _cachedPoints;
+    return true;
+}
+
+void UsdMayaPointBasedDeformerNode::_OnStageObjectsChanged(const UsdNotice::ObjectsChanged&)
+{
+    // Value and composition changes may both affect the points, simply drop
+    // everything and rebuild the query on the next evaluation.
+    std::lock_guard<std::mutex> lock(_cacheMutex);
+    _cachedPointsQuery = UsdAttributeQuery();
+    _cachedPoints = VtVec3fArray();
 }
 
 UsdMayaPointBasedDeformerNode::UsdMayaPointBasedDeformerNode()
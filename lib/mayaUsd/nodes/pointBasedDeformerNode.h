@@ -17,9 +17,15 @@
 #define PXRUSDMAYA_POINT_BASED_DEFORMER_NODE_H
 
 #include <mayaUsd/base/api.h>
+#include <mayaUsd/listeners/stageNoticeListener.h>
 
 #include <pxr/base/tf/staticTokens.h>
+#include <pxr/base/vt/types.h>
 #include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/attributeQuery.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
 
 #include <maya/MDataBlock.h>
 #include <maya/MItGeometry.h>
@@ -30,6 +36,8 @@
 #include <maya/MString.h>
 #include <maya/MTypeId.h>
 
+#include <mutex>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 // clang-format off
@@ -86,6 +94,27 @@ private:
 
     UsdMayaPointBasedDeformerNode(const UsdMayaPointBasedDeformerNode&);
     UsdMayaPointBasedDeformerNode& operator=(const UsdMayaPointBasedDeformerNode&);
+
+    /// Returns the points of the prim at the given time, reusing the values
+    /// read by the previous evaluation when possible.
+    bool _GetPoints(
+        const UsdStageRefPtr& usdStage,
+        const SdfPath&        primPath,
+        const UsdTimeCode&    usdTime,
+        VtVec3fArray*         points);
+
+    void _OnStageObjectsChanged(const UsdNotice::ObjectsChanged& notice);
+
+    /// Points read at the last evaluated time, along with the query used to
+    /// read them. The cache is invalidated whenever the stage changes.
+    std::mutex        _cacheMutex;
+    UsdStageWeakPtr   _cachedStage;
+    SdfPath           _cachedPrimPath;
+    UsdAttributeQuery _cachedPointsQuery;
+    UsdTimeCode       _cachedTime;
+    VtVec3fArray      _cachedPoints;
+
+    UsdMayaStageNoticeListener _stageNoticeListener;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
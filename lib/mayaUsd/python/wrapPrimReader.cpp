@@ -498,6 +498,7 @@ void wrapJobImportArgs()
                 &UsdMayaJobImportArgs::timeInterval, return_value_policy<return_by_value>()))
         .def_readonly("useAsAnimationCache", &UsdMayaJobImportArgs::useAsAnimationCache)
         .def_readonly("preserveTimeline", &UsdMayaJobImportArgs::preserveTimeline)
+        .def_readonly("profileReport", &UsdMayaJobImportArgs::profileReport)
         .def("GetMaterialConversion", &UsdMayaJobImportArgs::GetMaterialConversion);
 
     to_python_converter<
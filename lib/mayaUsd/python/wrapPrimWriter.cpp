@@ -96,6 +96,12 @@ public:
             "ShouldPruneChildren", &This::default_ShouldPruneChildren)();
     }
 
+    bool default_IsAnimated() const { return base_t::IsAnimated(); };
+    bool IsAnimated() const override
+    {
+        return this->template CallVirtual<bool>("IsAnimated", &This::default_IsAnimated)();
+    }
+
     bool default__HasAnimCurves() const { return base_t::_HasAnimCurves(); };
     bool _HasAnimCurves() const override
     {
@@ -529,6 +535,7 @@ void wrapJobExportArgs()
         .def_readonly("eulerFilter", &UsdMayaJobExportArgs::eulerFilter)
         .def_readonly("excludeInvisible", &UsdMayaJobExportArgs::excludeInvisible)
         .def_readonly("exportBlendShapes", &UsdMayaJobExportArgs::exportBlendShapes)
+        .def_readonly("blendShapeOffsetTolerance", &UsdMayaJobExportArgs::blendShapeOffsetTolerance)
         .def_readonly(
             "exportCollectionBasedBindings", &UsdMayaJobExportArgs::exportCollectionBasedBindings)
         .def_readonly("exportColorSets", &UsdMayaJobExportArgs::exportColorSets)
@@ -554,6 +561,8 @@ void wrapJobExportArgs()
             make_getter(&UsdMayaJobExportArgs::exportSkin, return_value_policy<return_by_value>()))
         .def_readonly("exportVisibility", &UsdMayaJobExportArgs::exportVisibility)
         .def_readonly("file", &UsdMayaJobExportArgs::file)
+        .def_readonly("maxSkinInfluences", &UsdMayaJobExportArgs::maxSkinInfluences)
+        .def_readonly("skinWeightEpsilon", &UsdMayaJobExportArgs::skinWeightEpsilon)
         .def_readonly("rootPrim", &UsdMayaJobExportArgs::rootPrim)
         .def_readonly("rootPrimType", &UsdMayaJobExportArgs::rootPrimType)
         .add_property(
@@ -615,6 +624,7 @@ void wrapJobExportArgs()
         .add_property(
             "shadingMode",
             make_getter(&UsdMayaJobExportArgs::shadingMode, return_value_policy<return_by_value>()))
+        .def_readonly("profileReport", &UsdMayaJobExportArgs::profileReport)
         .def_readonly("staticSingleSample", &UsdMayaJobExportArgs::staticSingleSample)
         .def_readonly("stripNamespaces", &UsdMayaJobExportArgs::stripNamespaces)
         .def_readonly("worldspace", &UsdMayaJobExportArgs::worldspace)
@@ -676,6 +686,10 @@ void wrapPrimWriter()
             static_cast<void (PrimWriterWrapper<>::*)(UsdAttribute attr)>(
                 &PrimWriterWrapper<>::MakeSingleSamplesStatic))
 
+        .def(
+            "IsAnimated",
+            &PrimWriterWrapper<>::IsAnimated,
+            &PrimWriterWrapper<>::default_IsAnimated)
         .def(
             "_HasAnimCurves",
             &PrimWriterWrapper<>::_HasAnimCurves,
@@ -384,6 +384,7 @@ UsdMayaGLBatchRenderer::UsdMayaGLBatchRenderer()
     , _hgiDriver { HgiTokens->renderDriver, VtValue(_hgi.get()) }
     , _selectionResolution(256)
     , _enableDepthSelection(false)
+    , _enableCpuPicking(false)
 {
     _rootId = SdfPath::AbsoluteRootPath().AppendChild(_tokens->BatchRendererRootName);
     _legacyViewportPrefix = _rootId.AppendChild(_tokens->LegacyViewport);
@@ -696,6 +697,20 @@ void UsdMayaGLBatchRenderer::SetDepthSelectionEnabled(const bool enabled)
     _enableDepthSelection = enabled;
 }
 
+bool UsdMayaGLBatchRenderer::IsCpuPickingEnabled() const { return _enableCpuPicking; }
+
+void UsdMayaGLBatchRenderer::SetCpuPickingEnabled(const bool enabled)
+{
+    if (_enableCpuPicking == enabled) {
+        return;
+    }
+
+    _enableCpuPicking = enabled;
+
+    // The picker only tracks changes while it is enabled.
+    _cpuPicker.Clear();
+}
+
 const HdxPickHitVector* UsdMayaGLBatchRenderer::TestIntersection(
     const PxrMayaHdShapeAdapter* shapeAdapter,
     MSelectInfo&                 selectInfo)
@@ -984,6 +999,19 @@ bool UsdMayaGLBatchRenderer::_TestIntersection(
         return false;
     }
 
+    if (_enableCpuPicking
+        && _cpuPicker.TestIntersection(
+            *_renderIndex,
+            rprimCollection,
+            renderTags,
+            viewMatrix,
+            projectionMatrix,
+            _selectionResolution,
+            singleSelection,
+            result)) {
+        return (result->size() > 0);
+    }
+
     glPushAttrib(
         GL_VIEWPORT_BIT | GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT
         | GL_STENCIL_BUFFER_BIT | GL_TEXTURE_BIT | GL_POLYGON_BIT);
@@ -1019,6 +1047,12 @@ bool UsdMayaGLBatchRenderer::_TestIntersection(
 
     VtValue vtPickParams(pickParams);
     _hdEngine.SetTaskContextData(HdxPickTokens->pickParams, vtPickParams);
+
+    // Syncing clears the dirty bits the CPU picker relies on.
+    if (_enableCpuPicking) {
+        _cpuPicker.TrackChanges(*_renderIndex);
+    }
+
     _hdEngine.Execute(_renderIndex.get(), &tasks);
 
     glBindVertexArray(0);
@@ -1196,6 +1230,10 @@ void UsdMayaGLBatchRenderer::_Render(
         MProfilingScope hydraProfilingScope(
             ProfilerCategory, MProfiler::kColorC_L3, "Batch Renderer Executing Hydra Tasks");
 
+        if (_enableCpuPicking) {
+            _cpuPicker.TrackChanges(*_renderIndex);
+        }
+
         _hdEngine.Execute(_renderIndex.get(), &tasks);
     }
 
@@ -19,6 +19,7 @@
 /// \file pxrUsdMayaGL/batchRenderer.h
 #include <mayaUsd/base/api.h>
 #include <mayaUsd/listeners/notice.h>
+#include <mayaUsd/render/pxrUsdMayaGL/cpuPicker.h>
 #include <mayaUsd/render/pxrUsdMayaGL/renderParams.h>
 #include <mayaUsd/render/pxrUsdMayaGL/sceneDelegate.h>
 #include <mayaUsd/render/pxrUsdMayaGL/shapeAdapter.h>
@@ -204,6 +205,19 @@ public:
     MAYAUSD_CORE_PUBLIC
     void SetDepthSelectionEnabled(const bool enabled);
 
+    /// Gets whether CPU picking has been enabled.
+    MAYAUSD_CORE_PUBLIC
+    bool IsCpuPickingEnabled() const;
+
+    /// Sets whether to enable CPU picking.
+    ///
+    /// When enabled, intersection tests are first resolved against a cache
+    /// of the triangles of the mesh rprims, maintained from Hydra's dirty
+    /// bits, and only fall back to rendering an id buffer when that is not
+    /// possible (see UsdMayaGLCpuPicker).
+    MAYAUSD_CORE_PUBLIC
+    void SetCpuPickingEnabled(const bool enabled);
+
     /// Tests the object from the given shape adapter for intersection with
     /// a given selection context in the legacy viewport.
     ///
@@ -458,6 +472,9 @@ private:
 
     GfVec2i _selectionResolution;
     bool    _enableDepthSelection;
+    bool    _enableCpuPicking;
+
+    UsdMayaGLCpuPicker _cpuPicker;
 
     HdxSelectionTrackerSharedPtr _selectionTracker;
 
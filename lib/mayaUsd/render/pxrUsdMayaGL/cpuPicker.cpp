@@ -0,0 +1,826 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "cpuPicker.h"
+
+#include <pxr/base/gf/bbox3d.h>
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/gf/range3f.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/gf/vec3i.h>
+#include <pxr/base/gf/vec4d.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/imaging/hd/changeTracker.h>
+#include <pxr/imaging/hd/enums.h>
+#include <pxr/imaging/hd/mesh.h>
+#include <pxr/imaging/hd/meshTopology.h>
+#include <pxr/imaging/hd/meshUtil.h>
+#include <pxr/imaging/hd/primGather.h>
+#include <pxr/imaging/hd/rprim.h>
+#include <pxr/imaging/hd/sceneDelegate.h>
+#include <pxr/imaging/hd/tokens.h>
+#include <pxr/imaging/pxOsd/tokens.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+// The dirty bits that invalidate the cached geometry, visibility or render
+// tag of an rprim.
+const HdDirtyBits _rprimDirtyBitsMask = HdChangeTracker::DirtyPoints
+    | HdChangeTracker::DirtyTopology | HdChangeTracker::DirtyTransform
+    | HdChangeTracker::DirtyVisibility | HdChangeTracker::DirtyInstancer
+    | HdChangeTracker::DirtyExtent | HdChangeTracker::DirtyRenderTag
+    | HdChangeTracker::DirtyDisplayStyle | HdChangeTracker::DirtyCullStyle;
+
+// The maximum number of items in a leaf of a bounding volume hierarchy.
+const size_t _maxLeafSize = 4u;
+
+GfVec4d _ToClip(const GfVec3f& point, const GfMatrix4d& viewProjectionMatrix)
+{
+    return GfVec4d(point[0], point[1], point[2], 1.0) * viewProjectionMatrix;
+}
+
+// Returns one bit per plane of the clip volume that the clip space position
+// is outside of.
+int _GetOutcode(const GfVec4d& clipPosition)
+{
+    int outcode = 0;
+    for (int axis = 0; axis < 3; ++axis) {
+        if (clipPosition[axis] < -clipPosition[3]) {
+            outcode |= 1 << (2 * axis);
+        }
+        if (clipPosition[axis] > clipPosition[3]) {
+            outcode |= 1 << (2 * axis + 1);
+        }
+    }
+    return outcode;
+}
+
+// Returns true if the box is entirely outside of one of the planes of the clip
+// volume. This is conservative: boxes straddling the corners of the frustum
+// are not rejected.
+bool _IsOutsideFrustum(const GfRange3f& box, const GfMatrix4d& viewProjectionMatrix)
+{
+    if (box.IsEmpty()) {
+        return true;
+    }
+
+    int outcode = ~0;
+    for (size_t corner = 0u; corner < 8u; ++corner) {
+        outcode &= _GetOutcode(_ToClip(box.GetCorner(corner), viewProjectionMatrix));
+        if (outcode == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Twice the signed area of the screen space triangle (a, b, p).
+double _Edge(const GfVec3d& a, const GfVec3d& b, const GfVec3d& p)
+{
+    return (b[0] - a[0]) * (p[1] - a[1]) - (b[1] - a[1]) * (p[0] - a[0]);
+}
+
+// Computes the world space points and triangles of the mesh rprim \p rprimId.
+// Returns false if the rprim is not drawn as its triangulated base mesh, in
+// which case the triangles cannot be used to resolve picks.
+bool _ComputeMeshTriangles(
+    const HdRenderIndex&  renderIndex,
+    HdSceneDelegate*      sceneDelegate,
+    const SdfPath&        rprimId,
+    const GfMatrix4d&     transform,
+    std::vector<GfVec3f>* points,
+    VtVec3iArray*         triangles,
+    VtIntArray*           primitiveParams)
+{
+    if (!dynamic_cast<const HdMesh*>(renderIndex.GetRprim(rprimId))) {
+        return false;
+    }
+
+    if (!sceneDelegate->GetInstancerId(rprimId).IsEmpty()) {
+        return false;
+    }
+
+    // The pick task does not cull, but a prim's own cull style still
+    // discards faces.
+    const HdCullStyle cullStyle = sceneDelegate->GetCullStyle(rprimId);
+    if (cullStyle != HdCullStyleDontCare && cullStyle != HdCullStyleNothing) {
+        return false;
+    }
+
+    const HdMeshTopology topology = sceneDelegate->GetMeshTopology(rprimId);
+    if (topology.GetScheme() != PxOsdOpenSubdivTokens->none
+        && sceneDelegate->GetDisplayStyle(rprimId).refineLevel > 0) {
+        return false;
+    }
+
+    const VtValue pointsValue = sceneDelegate->Get(rprimId, HdTokens->points);
+    if (!pointsValue.IsHolding<VtVec3fArray>()) {
+        return false;
+    }
+    const VtVec3fArray& localPoints = pointsValue.UncheckedGet<VtVec3fArray>();
+
+    HdMeshUtil meshUtil(&topology, rprimId);
+    meshUtil.ComputeTriangleIndices(triangles, primitiveParams);
+
+    const int numPoints = static_cast<int>(localPoints.size());
+    for (const GfVec3i& triangle : *triangles) {
+        for (int corner = 0; corner < 3; ++corner) {
+            if (triangle[corner] < 0 || triangle[corner] >= numPoints) {
+                return false;
+            }
+        }
+    }
+
+    points->resize(localPoints.size());
+    for (size_t pointIndex = 0u; pointIndex < localPoints.size(); ++pointIndex) {
+        (*points)[pointIndex] = transform.Transform(localPoints[pointIndex]);
+    }
+
+    return true;
+}
+
+} // anonymous namespace
+
+/// A bounding volume hierarchy over a set of boxes, split at the median of
+/// the longest axis of their centroids.
+class UsdMayaGLCpuPicker::_Bvh
+{
+public:
+    void Build(const std::vector<GfRange3f>& bounds)
+    {
+        _nodes.clear();
+        _items.resize(bounds.size());
+        std::iota(_items.begin(), _items.end(), 0);
+        if (!_items.empty()) {
+            _nodes.reserve(2u * (bounds.size() / _maxLeafSize + 1u));
+            _Build(bounds, 0u, _items.size());
+        }
+    }
+
+    /// Calls \p visit with the index of every box that may intersect the clip
+    /// volume of \p viewProjectionMatrix.
+    template <typename Visitor>
+    void Query(const GfMatrix4d& viewProjectionMatrix, Visitor&& visit) const
+    {
+        if (_nodes.empty()) {
+            return;
+        }
+
+        std::vector<size_t> stack(1u, 0u);
+        while (!stack.empty()) {
+            const size_t nodeIndex = stack.back();
+            stack.pop_back();
+
+            const _Node& node = _nodes[nodeIndex];
+            if (_IsOutsideFrustum(node.bounds, viewProjectionMatrix)) {
+                continue;
+            }
+
+            if (node.count > 0u) {
+                for (size_t item = node.first; item < node.first + node.count; ++item) {
+                    visit(_items[item]);
+                }
+            } else {
+                // The left child immediately follows its parent.
+                stack.push_back(node.first);
+                stack.push_back(nodeIndex + 1u);
+            }
+        }
+    }
+
+private:
+    /// For leaves, \c first and \c count are the range of the node's items.
+    /// For inner nodes, \c count is zero and \c first is the index of the
+    /// right child.
+    struct _Node
+    {
+        GfRange3f bounds;
+        size_t    first = 0u;
+        size_t    count = 0u;
+    };
+
+    void _Build(const std::vector<GfRange3f>& bounds, const size_t begin, const size_t end)
+    {
+        const size_t nodeIndex = _nodes.size();
+        _nodes.emplace_back();
+
+        GfRange3f nodeBounds;
+        GfRange3f centroidBounds;
+        for (size_t item = begin; item < end; ++item) {
+            nodeBounds.UnionWith(bounds[_items[item]]);
+            centroidBounds.UnionWith(bounds[_items[item]].GetMidpoint());
+        }
+        _nodes[nodeIndex].bounds = nodeBounds;
+
+        if (end - begin <= _maxLeafSize) {
+            _nodes[nodeIndex].first = begin;
+            _nodes[nodeIndex].count = end - begin;
+            return;
+        }
+
+        const GfVec3f size = centroidBounds.GetSize();
+        const int     axis = (size[0] > size[1]) ? (size[0] > size[2] ? 0 : 2)
+                                                 : (size[1] > size[2] ? 1 : 2);
+
+        const size_t middle = begin + (end - begin) / 2u;
+        std::nth_element(
+            _items.begin() + begin,
+            _items.begin() + middle,
+            _items.begin() + end,
+            [&bounds, axis](const int a, const int b) {
+                return bounds[a].GetMidpoint()[axis] < bounds[b].GetMidpoint()[axis];
+            });
+
+        _Build(bounds, begin, middle);
+        _nodes[nodeIndex].first = _nodes.size();
+        _Build(bounds, middle, end);
+    }
+
+    std::vector<_Node> _nodes;
+    std::vector<int>   _items;
+};
+
+/// The cached state of an rprim of the render index.
+struct UsdMayaGLCpuPicker::_RprimEntry
+{
+    SdfPath rprimId;
+    SdfPath delegateId;
+    TfToken renderTag;
+    bool    visible = false;
+
+    /// Whether the triangles below are what the rprim draws. Only the bounds
+    /// of unresolvable rprims are known, and they may be empty if the rprim
+    /// could not report them.
+    bool resolvable = false;
+
+    /// World space bounds, points and triangles.
+    GfRange3f            bounds;
+    std::vector<GfVec3f> points;
+    VtVec3iArray         triangles;
+    VtIntArray           primitiveParams;
+
+    /// Hierarchy over the triangles.
+    _Bvh bvh;
+};
+
+/// The pickable rprims of a collection, for a set of render tags.
+struct UsdMayaGLCpuPicker::_CollectionEntry
+{
+    HdRprimCollection rprimCollection;
+    TfTokenVector     renderTags;
+    size_t            rprimEntriesVersion = 0u;
+    unsigned          rprimIndexVersion = 0u;
+
+    /// The visible rprims with known bounds, and the hierarchy over their
+    /// bounds.
+    std::vector<const _RprimEntry*> rprims;
+    _Bvh                            bvh;
+
+    /// Whether some visible rprim has unknown bounds, in which case every
+    /// pick has to be resolved on the GPU.
+    bool hasUnboundedRprims = false;
+
+    /// The dirty rprims that were left out because they are hidden or their
+    /// render tag is not drawn. They have no cached entry to drop, so the
+    /// collection entry itself is invalidated once they are shown or drawn.
+    SdfPathVector skippedRprimIds;
+};
+
+/// A depth buffer recording the rprim and triangle of the nearest fragment
+/// of each pixel, with the same conventions as the id buffer rendered by
+/// HdxPickTask: pixels are sampled at their center, depth is in [0, 1] and
+/// tested with GL_LESS against a buffer cleared to 1.
+class UsdMayaGLCpuPicker::_Rasterizer
+{
+public:
+    struct Fragment
+    {
+        const _RprimEntry* rprim = nullptr;
+        int                triangleIndex = -1;
+        float              depth = 1.0f;
+    };
+
+    void Reset(const GfVec2i& resolution)
+    {
+        _width = resolution[0];
+        _height = resolution[1];
+        _fragments.assign(static_cast<size_t>(_width) * _height, Fragment());
+    }
+
+    int GetWidth() const { return _width; }
+
+    int GetHeight() const { return _height; }
+
+    const Fragment& GetFragment(const int x, const int y) const
+    {
+        return _fragments[static_cast<size_t>(y) * _width + x];
+    }
+
+    void DrawTriangle(
+        const GfVec4d (&clipPositions)[3],
+        const _RprimEntry* rprim,
+        const int          triangleIndex)
+    {
+        // Clip the triangle against the six planes of the clip volume. Each
+        // plane adds at most one vertex to the polygon.
+        GfVec4d polygons[2][9];
+        int     numVertices = 3;
+        std::copy(clipPositions, clipPositions + 3, polygons[0]);
+
+        int current = 0;
+        for (int plane = 0; plane < 6 && numVertices >= 3; ++plane) {
+            const int      axis = plane / 2;
+            const double   sign = (plane % 2 == 0) ? 1.0 : -1.0;
+            const GfVec4d* input = polygons[current];
+            GfVec4d*       output = polygons[1 - current];
+
+            int numOutputVertices = 0;
+            for (int vertex = 0; vertex < numVertices; ++vertex) {
+                const GfVec4d& p0 = input[vertex];
+                const GfVec4d& p1 = input[(vertex + 1) % numVertices];
+                const double   d0 = p0[3] + sign * p0[axis];
+                const double   d1 = p1[3] + sign * p1[axis];
+                if (d0 >= 0.0) {
+                    output[numOutputVertices++] = p0;
+                }
+                if ((d0 >= 0.0) != (d1 >= 0.0)) {
+                    output[numOutputVertices++] = p0 + (p1 - p0) * (d0 / (d0 - d1));
+                }
+            }
+
+            numVertices = numOutputVertices;
+            current = 1 - current;
+        }
+
+        if (numVertices < 3) {
+            return;
+        }
+
+        GfVec3d screenPositions[9];
+        for (int vertex = 0; vertex < numVertices; ++vertex) {
+            const GfVec4d& clipPosition = polygons[current][vertex];
+            if (clipPosition[3] <= 0.0) {
+                return;
+            }
+            const double inverseW = 1.0 / clipPosition[3];
+            screenPositions[vertex] = GfVec3d(
+                (clipPosition[0] * inverseW * 0.5 + 0.5) * _width,
+                (clipPosition[1] * inverseW * 0.5 + 0.5) * _height,
+                clipPosition[2] * inverseW * 0.5 + 0.5);
+        }
+
+        for (int vertex = 1; vertex + 1 < numVertices; ++vertex) {
+            _DrawScreenTriangle(
+                screenPositions[0],
+                screenPositions[vertex],
+                screenPositions[vertex + 1],
+                rprim,
+                triangleIndex);
+        }
+    }
+
+private:
+    void _DrawScreenTriangle(
+        const GfVec3d&     a,
+        const GfVec3d&     b,
+        const GfVec3d&     c,
+        const _RprimEntry* rprim,
+        const int          triangleIndex)
+    {
+        const double area = _Edge(a, b, c);
+        if (area == 0.0) {
+            return;
+        }
+
+        const int minX = std::max(0, static_cast<int>(std::floor(std::min({ a[0], b[0], c[0] }))));
+        const int minY = std::max(0, static_cast<int>(std::floor(std::min({ a[1], b[1], c[1] }))));
+        const int maxX
+            = std::min(_width - 1, static_cast<int>(std::ceil(std::max({ a[0], b[0], c[0] }))));
+        const int maxY
+            = std::min(_height - 1, static_cast<int>(std::ceil(std::max({ a[1], b[1], c[1] }))));
+
+        for (int y = minY; y <= maxY; ++y) {
+            for (int x = minX; x <= maxX; ++x) {
+                const GfVec3d sample(x + 0.5, y + 0.5, 0.0);
+
+                // Dividing by the signed area makes the barycentric
+                // coordinates positive inside the triangle whatever its
+                // winding.
+                const double wa = _Edge(b, c, sample) / area;
+                const double wb = _Edge(c, a, sample) / area;
+                const double wc = _Edge(a, b, sample) / area;
+                if (wa < 0.0 || wb < 0.0 || wc < 0.0) {
+                    continue;
+                }
+
+                const float depth = static_cast<float>(wa * a[2] + wb * b[2] + wc * c[2]);
+                Fragment&   fragment = _fragments[static_cast<size_t>(y) * _width + x];
+                if (depth < fragment.depth) {
+                    fragment.rprim = rprim;
+                    fragment.triangleIndex = triangleIndex;
+                    fragment.depth = depth;
+                }
+            }
+        }
+    }
+
+    int                   _width = 0;
+    int                   _height = 0;
+    std::vector<Fragment> _fragments;
+};
+
+UsdMayaGLCpuPicker::UsdMayaGLCpuPicker()
+    : _rasterizer(new _Rasterizer())
+    , _rprimEntriesVersion(0u)
+    , _sceneStateVersion(0u)
+    , _rprimIndexVersion(0u)
+{
+}
+
+UsdMayaGLCpuPicker::~UsdMayaGLCpuPicker() = default;
+
+void UsdMayaGLCpuPicker::TrackChanges(HdRenderIndex& renderIndex)
+{
+    const HdChangeTracker& changeTracker = renderIndex.GetChangeTracker();
+
+    const unsigned sceneStateVersion = changeTracker.GetSceneStateVersion();
+    const unsigned rprimIndexVersion = changeTracker.GetRprimIndexVersion();
+    if (sceneStateVersion == _sceneStateVersion && rprimIndexVersion == _rprimIndexVersion) {
+        return;
+    }
+
+    TRACE_FUNCTION();
+
+    _sceneStateVersion = sceneStateVersion;
+    _rprimIndexVersion = rprimIndexVersion;
+
+    const size_t numRprimEntries = _rprimEntries.size();
+    for (auto it = _rprimEntries.begin(); it != _rprimEntries.end();) {
+        const SdfPath& rprimId = it->first;
+        if (!renderIndex.HasRprim(rprimId)
+            || (changeTracker.GetRprimDirtyBits(rprimId) & _rprimDirtyBitsMask)) {
+            it = _rprimEntries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    if (_rprimEntries.size() != numRprimEntries) {
+        ++_rprimEntriesVersion;
+    }
+
+    // Showing a hidden rprim, or changing its render tag, may add it to the
+    // collections that left it out.
+    const HdDirtyBits skippedDirtyBitsMask
+        = HdChangeTracker::DirtyVisibility | HdChangeTracker::DirtyRenderTag;
+    for (const std::unique_ptr<_CollectionEntry>& collectionEntry : _collectionEntries) {
+        for (const SdfPath& rprimId : collectionEntry->skippedRprimIds) {
+            if (changeTracker.GetRprimDirtyBits(rprimId) & skippedDirtyBitsMask) {
+                collectionEntry->rprimEntriesVersion = _rprimEntriesVersion - 1u;
+                break;
+            }
+        }
+    }
+}
+
+void UsdMayaGLCpuPicker::Clear()
+{
+    _collectionEntries.clear();
+    _rprimEntries.clear();
+    ++_rprimEntriesVersion;
+}
+
+const UsdMayaGLCpuPicker::_RprimEntry*
+UsdMayaGLCpuPicker::_GetRprimEntry(HdRenderIndex& renderIndex, const SdfPath& rprimId)
+{
+    const auto it = _rprimEntries.find(rprimId);
+    if (it != _rprimEntries.end()) {
+        return it->second.get();
+    }
+
+    // What the delegate reports for a dirty rprim may not be what was drawn.
+    const HdChangeTracker& changeTracker = renderIndex.GetChangeTracker();
+    if (changeTracker.GetRprimDirtyBits(rprimId) & _rprimDirtyBitsMask) {
+        return nullptr;
+    }
+
+    HdSceneDelegate* sceneDelegate = renderIndex.GetSceneDelegateForRprim(rprimId);
+    if (!sceneDelegate) {
+        return nullptr;
+    }
+
+    std::unique_ptr<_RprimEntry> rprimEntry(new _RprimEntry());
+    rprimEntry->rprimId = rprimId;
+    rprimEntry->delegateId = sceneDelegate->GetDelegateID();
+    rprimEntry->renderTag = sceneDelegate->GetRenderTag(rprimId);
+    rprimEntry->visible = sceneDelegate->GetVisible(rprimId);
+
+    if (rprimEntry->visible) {
+        const GfMatrix4d transform = sceneDelegate->GetTransform(rprimId);
+
+        rprimEntry->resolvable = _ComputeMeshTriangles(
+            renderIndex,
+            sceneDelegate,
+            rprimId,
+            transform,
+            &rprimEntry->points,
+            &rprimEntry->triangles,
+            &rprimEntry->primitiveParams);
+
+        if (rprimEntry->resolvable) {
+            std::vector<GfRange3f> triangleBounds;
+            triangleBounds.reserve(rprimEntry->triangles.size());
+            for (const GfVec3i& triangle : rprimEntry->triangles) {
+                GfRange3f bounds(rprimEntry->points[triangle[0]], rprimEntry->points[triangle[0]]);
+                bounds.UnionWith(rprimEntry->points[triangle[1]]);
+                bounds.UnionWith(rprimEntry->points[triangle[2]]);
+                rprimEntry->bounds.UnionWith(bounds);
+                triangleBounds.push_back(bounds);
+            }
+            rprimEntry->bvh.Build(triangleBounds);
+        } else {
+            rprimEntry->points.clear();
+            rprimEntry->triangles = VtVec3iArray();
+            rprimEntry->primitiveParams = VtIntArray();
+
+            // The extent of an instanced rprim does not account for its
+            // instances.
+            const GfRange3d extent = sceneDelegate->GetExtent(rprimId);
+            if (!extent.IsEmpty() && sceneDelegate->GetInstancerId(rprimId).IsEmpty()) {
+                rprimEntry->bounds
+                    = GfRange3f(GfBBox3d(extent, transform).ComputeAlignedRange());
+            }
+        }
+    }
+
+    const _RprimEntry* result = rprimEntry.get();
+    _rprimEntries.emplace(rprimId, std::move(rprimEntry));
+    return result;
+}
+
+const UsdMayaGLCpuPicker::_CollectionEntry* UsdMayaGLCpuPicker::_GetCollectionEntry(
+    HdRenderIndex&           renderIndex,
+    const HdRprimCollection& rprimCollection,
+    const TfTokenVector&     renderTags)
+{
+    const HdChangeTracker& changeTracker = renderIndex.GetChangeTracker();
+
+    _CollectionEntry* collectionEntry = nullptr;
+    for (const std::unique_ptr<_CollectionEntry>& entry : _collectionEntries) {
+        if (entry->rprimCollection == rprimCollection && entry->renderTags == renderTags) {
+            collectionEntry = entry.get();
+            break;
+        }
+    }
+
+    if (collectionEntry && collectionEntry->rprimEntriesVersion == _rprimEntriesVersion
+        && collectionEntry->rprimIndexVersion == changeTracker.GetRprimIndexVersion()) {
+        return collectionEntry;
+    }
+
+    TRACE_FUNCTION();
+
+    if (!collectionEntry) {
+        _collectionEntries.emplace_back(new _CollectionEntry());
+        collectionEntry = _collectionEntries.back().get();
+        collectionEntry->rprimCollection = rprimCollection;
+        collectionEntry->renderTags = renderTags;
+    }
+
+    collectionEntry->rprims.clear();
+    collectionEntry->hasUnboundedRprims = false;
+    collectionEntry->skippedRprimIds.clear();
+
+    SdfPathVector rprimIds;
+    HdPrimGather  gather;
+    gather.Filter(
+        renderIndex.GetRprimIds(),
+        rprimCollection.GetRootPaths(),
+        rprimCollection.GetExcludePaths(),
+        &rprimIds);
+
+    const auto hasRenderTag = [&renderTags](const TfToken& renderTag) {
+        return renderTags.empty()
+            || std::find(renderTags.begin(), renderTags.end(), renderTag) != renderTags.end();
+    };
+
+    std::vector<GfRange3f> rprimBounds;
+    for (const SdfPath& rprimId : rprimIds) {
+        const _RprimEntry* rprimEntry = _GetRprimEntry(renderIndex, rprimId);
+        if (!rprimEntry) {
+            // Hydra never syncs hidden rprims, nor rprims whose render tag is
+            // not drawn, so these can stay dirty indefinitely without
+            // affecting picks. Any other dirty rprim has to be synced first.
+            const HdRprim*    rprim = renderIndex.GetRprim(rprimId);
+            const HdDirtyBits dirtyBits = changeTracker.GetRprimDirtyBits(rprimId);
+            if (rprim && !(dirtyBits & HdChangeTracker::DirtyVisibility) && !rprim->IsVisible()) {
+                collectionEntry->skippedRprimIds.push_back(rprimId);
+                continue;
+            }
+
+            HdSceneDelegate* sceneDelegate = renderIndex.GetSceneDelegateForRprim(rprimId);
+            if (sceneDelegate && !hasRenderTag(sceneDelegate->GetRenderTag(rprimId))) {
+                collectionEntry->skippedRprimIds.push_back(rprimId);
+                continue;
+            }
+
+            // Invalidate the partially built entry so that it is rebuilt on
+            // the next pick.
+            collectionEntry->rprimEntriesVersion = _rprimEntriesVersion - 1u;
+            return nullptr;
+        }
+
+        if (!rprimEntry->visible || !hasRenderTag(rprimEntry->renderTag)) {
+            continue;
+        }
+
+        if (rprimEntry->bounds.IsEmpty()) {
+            if (!rprimEntry->resolvable) {
+                collectionEntry->hasUnboundedRprims = true;
+            }
+            continue;
+        }
+
+        collectionEntry->rprims.push_back(rprimEntry);
+        rprimBounds.push_back(rprimEntry->bounds);
+    }
+
+    collectionEntry->bvh.Build(rprimBounds);
+    collectionEntry->rprimEntriesVersion = _rprimEntriesVersion;
+    collectionEntry->rprimIndexVersion = changeTracker.GetRprimIndexVersion();
+
+    return collectionEntry;
+}
+
+bool UsdMayaGLCpuPicker::TestIntersection(
+    HdRenderIndex&           renderIndex,
+    const HdRprimCollection& rprimCollection,
+    const TfTokenVector&     renderTags,
+    const GfMatrix4d&        viewMatrix,
+    const GfMatrix4d&        projectionMatrix,
+    const GfVec2i&           resolution,
+    const bool               singleSelection,
+    HdxPickHitVector*        result)
+{
+    TRACE_FUNCTION();
+
+    if (!result || resolution[0] <= 0 || resolution[1] <= 0) {
+        return false;
+    }
+
+    // Rprims may have been dirtied since the last draw.
+    TrackChanges(renderIndex);
+
+    const _CollectionEntry* collectionEntry
+        = _GetCollectionEntry(renderIndex, rprimCollection, renderTags);
+    if (!collectionEntry || collectionEntry->hasUnboundedRprims) {
+        return false;
+    }
+
+    const GfMatrix4d viewProjectionMatrix = viewMatrix * projectionMatrix;
+
+    std::vector<const _RprimEntry*> candidates;
+    bool                            resolvable = true;
+    collectionEntry->bvh.Query(viewProjectionMatrix, [&](const int rprimIndex) {
+        const _RprimEntry* rprimEntry = collectionEntry->rprims[rprimIndex];
+        resolvable = resolvable && rprimEntry->resolvable;
+        candidates.push_back(rprimEntry);
+    });
+    if (!resolvable) {
+        return false;
+    }
+
+    _rasterizer->Reset(resolution);
+    for (const _RprimEntry* rprimEntry : candidates) {
+        rprimEntry->bvh.Query(viewProjectionMatrix, [&](const int triangleIndex) {
+            const GfVec3i& triangle = rprimEntry->triangles[triangleIndex];
+            const GfVec4d  clipPositions[3]
+                = { _ToClip(rprimEntry->points[triangle[0]], viewProjectionMatrix),
+                    _ToClip(rprimEntry->points[triangle[1]], viewProjectionMatrix),
+                    _ToClip(rprimEntry->points[triangle[2]], viewProjectionMatrix) };
+            _rasterizer->DrawTriangle(clipPositions, rprimEntry, triangleIndex);
+        });
+    }
+
+    const GfMatrix4d inverseViewProjectionMatrix = viewProjectionMatrix.GetInverse();
+    const int        width = _rasterizer->GetWidth();
+    const int        height = _rasterizer->GetHeight();
+
+    const auto makeHit = [&](const int x, const int y) {
+        const _Rasterizer::Fragment& fragment = _rasterizer->GetFragment(x, y);
+        const _RprimEntry&           rprimEntry = *fragment.rprim;
+        const GfVec3i&               triangle = rprimEntry.triangles[fragment.triangleIndex];
+
+        const GfVec3d hitPoint = inverseViewProjectionMatrix.Transform(GfVec3d(
+            (x + 0.5) / width * 2.0 - 1.0,
+            (y + 0.5) / height * 2.0 - 1.0,
+            fragment.depth * 2.0 - 1.0));
+        const GfVec3f hitNormal
+            = GfCross(
+                  rprimEntry.points[triangle[1]] - rprimEntry.points[triangle[0]],
+                  rprimEntry.points[triangle[2]] - rprimEntry.points[triangle[0]])
+                  .GetNormalized();
+
+        HdxPickHit hit;
+        hit.delegateId = rprimEntry.delegateId;
+        hit.objectId = rprimEntry.rprimId;
+        hit.instancerId = SdfPath();
+        hit.instanceIndex = -1;
+        hit.elementIndex = HdMeshUtil::DecodeFaceIndexFromCoarseFaceParam(
+            rprimEntry.primitiveParams[fragment.triangleIndex]);
+        hit.edgeIndex = -1;
+        hit.pointIndex = -1;
+#if HDX_API_VERSION >= 12
+        hit.worldSpaceHitPoint = hitPoint;
+#else
+        hit.worldSpaceHitPoint = GfVec3f(hitPoint);
+#endif
+        hit.worldSpaceHitNormal = hitNormal;
+        hit.normalizedDepth = fragment.depth;
+        return hit;
+    };
+
+    if (singleSelection) {
+        // Like HdxPickTokens->resolveNearestToCenter, report the covered
+        // pixel nearest to the center of the frustum.
+        int    nearestX = -1;
+        int    nearestY = -1;
+        double nearestDistance = std::numeric_limits<double>::max();
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                if (!_rasterizer->GetFragment(x, y).rprim) {
+                    continue;
+                }
+                const double dx = x + 0.5 - width * 0.5;
+                const double dy = y + 0.5 - height * 0.5;
+                const double distance = dx * dx + dy * dy;
+                if (distance < nearestDistance) {
+                    nearestX = x;
+                    nearestY = y;
+                    nearestDistance = distance;
+                }
+            }
+        }
+
+        if (nearestX >= 0) {
+            result->push_back(makeHit(nearestX, nearestY));
+        }
+    } else {
+        // Like HdxPickTokens->resolveUnique, report every rprim covering at
+        // least one pixel, once, at its nearest fragment.
+        std::unordered_map<const _RprimEntry*, size_t> hitIndices;
+        std::vector<std::pair<int, int>>               hitPixels;
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                const _Rasterizer::Fragment& fragment = _rasterizer->GetFragment(x, y);
+                if (!fragment.rprim) {
+                    continue;
+                }
+
+                const auto inserted = hitIndices.emplace(fragment.rprim, hitPixels.size());
+                if (inserted.second) {
+                    hitPixels.emplace_back(x, y);
+                    continue;
+                }
+
+                std::pair<int, int>& hitPixel = hitPixels[inserted.first->second];
+                if (fragment.depth
+                    < _rasterizer->GetFragment(hitPixel.first, hitPixel.second).depth) {
+                    hitPixel = std::make_pair(x, y);
+                }
+            }
+        }
+
+        for (const std::pair<int, int>& hitPixel : hitPixels) {
+            result->push_back(makeHit(hitPixel.first, hitPixel.second));
+        }
+    }
+
+    return true;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
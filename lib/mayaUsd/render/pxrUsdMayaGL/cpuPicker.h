@@ -0,0 +1,130 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef PXRUSDMAYAGL_CPU_PICKER_H
+#define PXRUSDMAYAGL_CPU_PICKER_H
+
+/// \file pxrUsdMayaGL/cpuPicker.h
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/vec2i.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/imaging/hd/renderIndex.h>
+#include <pxr/imaging/hd/rprimCollection.h>
+#include <pxr/imaging/hdx/pickTask.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class UsdMayaGLCpuPicker
+/// \brief Resolves batch renderer picks on the CPU, without rendering an id
+/// buffer.
+///
+/// The picker caches the world space triangles of the mesh rprims of the
+/// render index, along with a bounding volume hierarchy over each mesh's
+/// triangles and one over the rprims of each collection it is queried with.
+/// A pick culls the cached geometry against the pick frustum and rasterizes
+/// the surviving triangles into a depth buffer of the selection resolution,
+/// which is then resolved the same way HdxPickTask resolves its id buffer.
+///
+/// Cached rprims are dropped as soon as Hydra reports them dirty, so
+/// TrackChanges() must be called before the render index is synced, since
+/// syncing clears the dirty bits the picker relies on.
+///
+/// Rprims the picker cannot reproduce exactly (non-mesh rprims, instanced
+/// rprims, refined subdivision surfaces, culled faces) are only tracked by
+/// their bounds. A pick whose frustum intersects one of them is not resolved,
+/// and the caller is expected to fall back to GPU picking.
+class UsdMayaGLCpuPicker
+{
+public:
+    MAYAUSD_CORE_PUBLIC
+    UsdMayaGLCpuPicker();
+
+    MAYAUSD_CORE_PUBLIC
+    ~UsdMayaGLCpuPicker();
+
+    UsdMayaGLCpuPicker(const UsdMayaGLCpuPicker&) = delete;
+    UsdMayaGLCpuPicker& operator=(const UsdMayaGLCpuPicker&) = delete;
+
+    /// Drops the cached geometry of the rprims of \p renderIndex that have
+    /// been dirtied or removed since the last call.
+    MAYAUSD_CORE_PUBLIC
+    void TrackChanges(HdRenderIndex& renderIndex);
+
+    /// Drops all of the cached geometry.
+    MAYAUSD_CORE_PUBLIC
+    void Clear();
+
+    /// Tests the rprims of \p rprimCollection with one of \p renderTags for
+    /// intersection with the frustum defined by \p viewMatrix and
+    /// \p projectionMatrix, rendered at \p resolution.
+    ///
+    /// When \p singleSelection is true, only the hit nearest to the center of
+    /// the frustum is returned, otherwise one hit per visible rprim is.
+    ///
+    /// Returns false if the pick could not be resolved on the CPU, in which
+    /// case \p result is left untouched.
+    MAYAUSD_CORE_PUBLIC
+    bool TestIntersection(
+        HdRenderIndex&           renderIndex,
+        const HdRprimCollection& rprimCollection,
+        const TfTokenVector&     renderTags,
+        const GfMatrix4d&        viewMatrix,
+        const GfMatrix4d&        projectionMatrix,
+        const GfVec2i&           resolution,
+        const bool               singleSelection,
+        HdxPickHitVector*        result);
+
+private:
+    struct _RprimEntry;
+    struct _CollectionEntry;
+    class _Bvh;
+    class _Rasterizer;
+
+    /// Returns the cached entry of \p rprimId, creating it if needed.
+    /// Returns nullptr if the rprim has not been synced yet.
+    const _RprimEntry* _GetRprimEntry(HdRenderIndex& renderIndex, const SdfPath& rprimId);
+
+    /// Returns the cached entry of \p rprimCollection, creating it if needed.
+    /// Returns nullptr if one of its rprims has not been synced yet.
+    const _CollectionEntry* _GetCollectionEntry(
+        HdRenderIndex&           renderIndex,
+        const HdRprimCollection& rprimCollection,
+        const TfTokenVector&     renderTags);
+
+    typedef std::unordered_map<SdfPath, std::unique_ptr<_RprimEntry>, SdfPath::Hash> _RprimEntryMap;
+
+    _RprimEntryMap                                 _rprimEntries;
+    std::vector<std::unique_ptr<_CollectionEntry>> _collectionEntries;
+    std::unique_ptr<_Rasterizer>                   _rasterizer;
+
+    /// Incremented whenever cached rprim entries are dropped, which
+    /// invalidates the collection entries referring to them.
+    size_t   _rprimEntriesVersion;
+    unsigned _sceneStateVersion;
+    unsigned _rprimIndexVersion;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXRUSDMAYAGL_CPU_PICKER_H
@@ -166,6 +166,15 @@ MUserData* PxrMayaHdImagingShapeDrawOverride::prepareForDraw(
                     enableDepthSelection);
             }
         }
+
+        const MPlug enableCpuPickingPlug
+            = depNodeFn.findPlug(PxrMayaHdImagingShape::enableCpuPickingAttr, &status);
+        if (status == MS::kSuccess) {
+            const bool enableCpuPicking = enableCpuPickingPlug.asBool(&status);
+            if (status == MS::kSuccess) {
+                UsdMayaGLBatchRenderer::GetInstance().SetCpuPickingEnabled(enableCpuPicking);
+            }
+        }
     }
 
     // Sync any instancers that need Hydra drawing.
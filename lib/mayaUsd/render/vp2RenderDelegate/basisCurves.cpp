@@ -16,6 +16,7 @@
 //
 #include "basisCurves.h"
 
+#include "basisCurvesIndices.h"
 #include "bboxGeom.h"
 #include "debugCodes.h"
 #include "drawItem.h"
@@ -39,6 +40,9 @@
 #include <maya/MProfiler.h>
 #include <maya/MSelectionMask.h>
 
+#include <algorithm>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 namespace {
@@ -130,217 +134,6 @@ VtArray<T> InterpolateVarying(
     return outputValues;
 }
 
-VtValue _BuildCubicIndexArray(const HdBasisCurvesTopology& topology)
-{
-    /*
-    Here's a diagram of what's happening in this code:
-
-    For open (non periodic, wrap = false) curves:
-
-      bezier (vStep = 3)
-      0------1------2------3------4------5------6 (vertex index)
-      [======= seg0 =======]
-                           [======= seg1 =======]
-
-
-      bspline / catmullRom (vStep = 1)
-      0------1------2------3------4------5------6 (vertex index)
-      [======= seg0 =======]
-             [======= seg1 =======]
-                    [======= seg2 =======]
-                           [======= seg3 =======]
-
-
-    For closed (periodic, wrap = true) curves:
-
-       periodic bezier (vStep = 3)
-       0------1------2------3------4------5------0 (vertex index)
-       [======= seg0 =======]
-                            [======= seg1 =======]
-
-
-       periodic bspline / catmullRom (vStep = 1)
-       0------1------2------3------4------5------0------1------2 (vertex index)
-       [======= seg0 =======]
-              [======= seg1 =======]
-                     [======= seg2 =======]
-                            [======= seg3 =======]
-                                   [======= seg4 =======]
-                                          [======= seg5 =======]
-    */
-    std::vector<GfVec4i> indices;
-
-    const VtArray<int> vertexCounts = topology.GetCurveVertexCounts();
-    bool               wrap = topology.GetCurveWrap() == HdTokens->periodic;
-    int                vStep;
-    TfToken            basis = topology.GetCurveBasis();
-    if (basis == HdTokens->bezier) {
-        vStep = 3;
-    } else {
-        vStep = 1;
-    }
-
-    int vertexIndex = 0;
-    TF_FOR_ALL(itCounts, vertexCounts)
-    {
-        int count = *itCounts;
-        // The first segment always eats up 4 verts, not just vstep, so to
-        // compensate, we break at count - 3.
-        int numSegs;
-
-        // If we're closing the curve, make sure that we have enough
-        // segments to wrap all the way back to the beginning.
-        if (wrap) {
-            numSegs = count / vStep;
-        } else {
-            numSegs = ((count - 4) / vStep) + 1;
-        }
-
-        for (int i = 0; i < numSegs; ++i) {
-
-            // Set up curve segments based on curve basis
-            GfVec4i seg;
-            int     offset = i * vStep;
-            for (int v = 0; v < 4; ++v) {
-                // If there are not enough verts to round out the segment
-                // just repeat the last vert.
-                seg[v] = wrap ? vertexIndex + ((offset + v) % count)
-                              : vertexIndex + std::min(offset + v, (count - 1));
-            }
-            indices.push_back(seg);
-        }
-        vertexIndex += count;
-    }
-
-    VtVec4iArray      finalIndices(indices.size());
-    VtIntArray const& curveIndices = topology.GetCurveIndices();
-
-    // If have topology has indices set, map the generated indices
-    // with the given indices.
-    if (curveIndices.empty()) {
-        std::copy(indices.begin(), indices.end(), finalIndices.begin());
-    } else {
-        size_t lineCount = indices.size();
-        int    maxIndex = curveIndices.size() - 1;
-
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum) {
-            const GfVec4i& line = indices[lineNum];
-
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
-            int i2 = std::min(line[2], maxIndex);
-            int i3 = std::min(line[3], maxIndex);
-
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
-            int v2 = curveIndices[i2];
-            int v3 = curveIndices[i3];
-
-            finalIndices[lineNum].Set(v0, v1, v2, v3);
-        }
-    }
-
-    return VtValue(finalIndices);
-}
-
-VtValue _BuildLinesIndexArray(const HdBasisCurvesTopology& topology)
-{
-    std::vector<GfVec2i> indices;
-    VtArray<int>         vertexCounts = topology.GetCurveVertexCounts();
-
-    int vertexIndex = 0;
-    TF_FOR_ALL(itCounts, vertexCounts)
-    {
-        for (int i = 0; i < *itCounts; i += 2) {
-            indices.push_back(GfVec2i(vertexIndex, vertexIndex + 1));
-            vertexIndex += 2;
-        }
-    }
-
-    VtVec2iArray      finalIndices(indices.size());
-    VtIntArray const& curveIndices = topology.GetCurveIndices();
-
-    // If have topology has indices set, map the generated indices
-    // with the given indices.
-    if (curveIndices.empty()) {
-        std::copy(indices.begin(), indices.end(), finalIndices.begin());
-    } else {
-        size_t lineCount = indices.size();
-        int    maxIndex = curveIndices.size() - 1;
-
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum) {
-            const GfVec2i& line = indices[lineNum];
-
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
-
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
-
-            finalIndices[lineNum].Set(v0, v1);
-        }
-    }
-
-    return VtValue(finalIndices);
-}
-
-VtValue _BuildLineSegmentIndexArray(const HdBasisCurvesTopology& topology)
-{
-    const TfToken basis = topology.GetCurveBasis();
-    const bool    skipFirstAndLastSegs = (basis == HdTokens->catmullRom);
-
-    std::vector<GfVec2i> indices;
-    const VtArray<int>   vertexCounts = topology.GetCurveVertexCounts();
-    bool                 wrap = topology.GetCurveWrap() == HdTokens->periodic;
-    int                  vertexIndex = 0; // Index of next vertex to emit
-    // For each curve
-    TF_FOR_ALL(itCounts, vertexCounts)
-    {
-        int v0 = vertexIndex;
-        int v1;
-        // Store first vert index incase we are wrapping
-        const int firstVert = v0;
-        ++vertexIndex;
-        for (int i = 1; i < *itCounts; ++i) {
-            v1 = vertexIndex;
-            ++vertexIndex;
-            if (!skipFirstAndLastSegs || (i > 1 && i < (*itCounts) - 1)) {
-                indices.push_back(GfVec2i(v0, v1));
-            }
-            v0 = v1;
-        }
-        if (wrap) {
-            indices.push_back(GfVec2i(v0, firstVert));
-        }
-    }
-
-    VtVec2iArray      finalIndices(indices.size());
-    VtIntArray const& curveIndices = topology.GetCurveIndices();
-
-    // If have topology has indices set, map the generated indices
-    // with the given indices.
-    if (curveIndices.empty()) {
-        std::copy(indices.begin(), indices.end(), finalIndices.begin());
-    } else {
-        size_t lineCount = indices.size();
-        int    maxIndex = curveIndices.size() - 1;
-
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum) {
-            const GfVec2i& line = indices[lineNum];
-
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
-
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
-
-            finalIndices[lineNum].Set(v0, v1);
-        }
-    }
-
-    return VtValue(finalIndices);
-}
-
 template <typename BaseType>
 VtArray<BaseType> _BuildInterpolatedArray(
     const HdBasisCurvesTopology& topology,
@@ -350,35 +143,27 @@ VtArray<BaseType> _BuildInterpolatedArray(
     // We need to interpolate primvar depending on its type
     size_t numVerts = topology.CalculateNeededNumberOfControlPoints();
 
-    VtArray<BaseType> result(numVerts);
-    size_t            size = authoredData.size();
+    const size_t size = authoredData.size();
 
     if (size == 1) {
         // Uniform data
-        const BaseType& elem = authoredData[0];
-        for (size_t i = 0; i < numVerts; ++i) {
-            result[i] = elem;
-        }
+        return VtArray<BaseType>(numVerts, authoredData[0]);
     } else if (size == numVerts) {
         // Vertex data
-        result = authoredData;
+        return authoredData;
     } else if (size == topology.CalculateNeededNumberOfVaryingControlPoints()) {
         // Varying data
-        result = InterpolateVarying<BaseType>(
+        return InterpolateVarying<BaseType>(
             numVerts,
             topology.GetCurveVertexCounts(),
             topology.GetCurveWrap(),
             topology.GetCurveBasis(),
             authoredData);
-    } else {
-        // Fallback
-        for (size_t i = 0; i < numVerts; ++i) {
-            result[i] = defaultValue;
-        }
-        TF_WARN("Incorrect number of primvar data, using default value for rendering.");
     }
 
-    return result;
+    // Fallback
+    TF_WARN("Incorrect number of primvar data, using default value for rendering.");
+    return VtArray<BaseType>(numVerts, defaultValue);
 }
 } // anonymous namespace
 
@@ -450,6 +235,15 @@ void HdVP2BasisCurves::Sync(
 
     if (HdChangeTracker::IsTopologyDirty(*dirtyBits, id)) {
         _curvesSharedData._topology = GetBasisCurvesTopology(delegate);
+
+        // Only regenerate the index arrays if the topology actually changed.
+        const HdTopology::ID topologyId = _curvesSharedData._topology.ComputeHash();
+        if (topologyId != _curvesSharedData._topologyId) {
+            _curvesSharedData._topologyId = topologyId;
+            for (VtValue& indexArray : _curvesSharedData._indexArrays) {
+                indexArray = VtValue();
+            }
+        }
     }
 
     // Prepare position buffer. It is shared among all draw items so it should
@@ -567,16 +361,29 @@ void HdVP2BasisCurves::_UpdateDrawItem(
 
         const bool forceLines = (refineLevel <= 0) || (drawMode & MHWRender::MGeometry::kWireframe);
 
-        VtValue result;
-
+        // The index arrays only depend on the topology, so they are shared by
+        // all draw items until it changes.
+        VtValue* indexArray;
         if (!forceLines && type == HdTokens->cubic) {
-            result = _BuildCubicIndexArray(topology);
+            indexArray = &_curvesSharedData._indexArrays[HdVP2BasisCurvesSharedData::kCubicIndices];
+            if (indexArray->IsEmpty()) {
+                *indexArray = VtValue(HdVP2BuildCubicIndexArray(topology));
+            }
         } else if (wrap == HdTokens->segmented) {
-            result = _BuildLinesIndexArray(topology);
+            indexArray = &_curvesSharedData._indexArrays[HdVP2BasisCurvesSharedData::kLinesIndices];
+            if (indexArray->IsEmpty()) {
+                *indexArray = VtValue(HdVP2BuildLinesIndexArray(topology));
+            }
         } else {
-            result = _BuildLineSegmentIndexArray(topology);
+            indexArray
+                = &_curvesSharedData._indexArrays[HdVP2BasisCurvesSharedData::kLineSegmentIndices];
+            if (indexArray->IsEmpty()) {
+                *indexArray = VtValue(HdVP2BuildLineSegmentIndexArray(topology));
+            }
         }
 
+        const VtValue& result = *indexArray;
+
         const void*  indexData = nullptr;
         unsigned int numIndices = 0;
 
@@ -736,13 +543,7 @@ void HdVP2BasisCurves::_UpdateDrawItem(
                     // Due to the performance indication about transparency, we have to
                     // traverse the array and enable transparency only when needed.
                     if (!stateToCommit._isTransparent) {
-                        const size_t numAlphas = alphaArray.size();
-                        for (size_t i = 0; i < numAlphas; i++) {
-                            if (alphaArray[i] < 0.999f) {
-                                stateToCommit._isTransparent = true;
-                                break;
-                            }
-                        }
+                        stateToCommit._isTransparent = _HasTransparentAlpha(alphaArray);
                     }
                 }
             }
@@ -836,15 +637,7 @@ void HdVP2BasisCurves::_UpdateDrawItem(
                     _curvesSharedData._colorBuffer->acquire(numVertices, true));
 
                 if (bufferData) {
-                    unsigned int offset = 0;
-                    for (size_t v = 0; v < numVertices; v++) {
-                        const GfVec3f& color = colorArray[v];
-                        bufferData[offset++] = color[0];
-                        bufferData[offset++] = color[1];
-                        bufferData[offset++] = color[2];
-
-                        bufferData[offset++] = alphaArray[v];
-                    }
+                    _FillColorBuffer(bufferData, colorArray, alphaArray, numVertices);
 
                     _CommitMVertexBuffer(_curvesSharedData._colorBuffer.get(), bufferData);
                 }
@@ -54,6 +54,22 @@ struct HdVP2BasisCurvesSharedData
     //! copy.
     HdBasisCurvesTopology _topology;
 
+    //! Hash of _topology.
+    HdTopology::ID _topologyId { 0 };
+
+    //! The kinds of index arrays generated from the topology.
+    enum IndexArrayKind
+    {
+        kCubicIndices,       //!< Cubic patches
+        kLinesIndices,       //!< Independent lines of segmented curves
+        kLineSegmentIndices, //!< Line strips
+        kNumIndexArrayKinds
+    };
+
+    //! Index arrays generated from _topology, shared among all draw items.
+    //! They are generated on demand, and reset when the topology changes.
+    VtValue _indexArrays[kNumIndexArrayKinds];
+
     //! A local cache of primvar scene data. "data" is a copy-on-write handle to
     //! the actual primvar buffer, and "interpolation" is the interpolation mode
     //! to be used.
@@ -0,0 +1,207 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "basisCurvesIndices.h"
+
+#include <pxr/base/work/loops.h>
+#include <pxr/imaging/hd/tokens.h>
+
+#include <algorithm>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+//! Curves are generated in parallel in chunks of this many curves.
+constexpr size_t kCurveGrainSize = 1024;
+
+/*! \brief  Generates the index array of the primitives of the curves of \p topology.
+
+    The number of vertices consumed and of primitives generated by each curve, given by
+    \p numVertices and \p numPrimitives from its vertex count, are turned into offsets with a prefix
+    sum first. \p fill can then write the primitives of each curve directly at their offset, for
+    all curves in parallel. If the topology has indices, the generated indices are mapped with them.
+*/
+template <typename Primitive, typename NumVerticesFn, typename NumPrimitivesFn, typename FillFn>
+VtArray<Primitive> _GenerateCurveIndices(
+    const HdBasisCurvesTopology& topology,
+    NumVerticesFn&&              numVertices,
+    NumPrimitivesFn&&            numPrimitives,
+    FillFn&&                     fill)
+{
+    const VtIntArray& vertexCounts = topology.GetCurveVertexCounts();
+    const size_t      numCurves = vertexCounts.size();
+
+    std::vector<int>    vertexOffsets(numCurves + 1, 0);
+    std::vector<size_t> primitiveOffsets(numCurves + 1, 0);
+    for (size_t curve = 0; curve < numCurves; ++curve) {
+        const int count = vertexCounts[curve];
+        vertexOffsets[curve + 1] = vertexOffsets[curve] + numVertices(count);
+        primitiveOffsets[curve + 1] = primitiveOffsets[curve] + std::max(numPrimitives(count), 0);
+    }
+
+    VtArray<Primitive> indices(primitiveOffsets[numCurves]);
+    Primitive* const   primitives = indices.data();
+
+    const VtIntArray& curveIndices = topology.GetCurveIndices();
+    const int         maxIndex = static_cast<int>(curveIndices.size()) - 1;
+
+    WorkParallelForN(
+        numCurves,
+        [&](size_t begin, size_t end) {
+            for (size_t curve = begin; curve < end; ++curve) {
+                fill(
+                    vertexCounts[curve],
+                    vertexOffsets[curve],
+                    primitives + primitiveOffsets[curve]);
+            }
+
+            if (!curveIndices.empty()) {
+                for (size_t p = primitiveOffsets[begin]; p < primitiveOffsets[end]; ++p) {
+                    for (size_t v = 0; v < Primitive::dimension; ++v) {
+                        primitives[p][v] = curveIndices[std::min(primitives[p][v], maxIndex)];
+                    }
+                }
+            }
+        },
+        kCurveGrainSize);
+
+    return indices;
+}
+
+} // anonymous namespace
+
+VtVec4iArray HdVP2BuildCubicIndexArray(const HdBasisCurvesTopology& topology)
+{
+    /*
+    Here's a diagram of what's happening in this code:
+
+    For open (non periodic, wrap = false) curves:
+
+      bezier (vStep = 3)
+      0------1------2------3------4------5------6 (vertex index)
+      [======= seg0 =======]
+                           [======= seg1 =======]
+
+
+      bspline / catmullRom (vStep = 1)
+      0------1------2------3------4------5------6 (vertex index)
+      [======= seg0 =======]
+             [======= seg1 =======]
+                    [======= seg2 =======]
+                           [======= seg3 =======]
+
+
+    For closed (periodic, wrap = true) curves:
+
+       periodic bezier (vStep = 3)
+       0------1------2------3------4------5------0 (vertex index)
+       [======= seg0 =======]
+                            [======= seg1 =======]
+
+
+       periodic bspline / catmullRom (vStep = 1)
+       0------1------2------3------4------5------0------1------2 (vertex index)
+       [======= seg0 =======]
+              [======= seg1 =======]
+                     [======= seg2 =======]
+                            [======= seg3 =======]
+                                   [======= seg4 =======]
+                                          [======= seg5 =======]
+    */
+    const bool wrap = topology.GetCurveWrap() == HdTokens->periodic;
+    const int  vStep = (topology.GetCurveBasis() == HdTokens->bezier) ? 3 : 1;
+
+    const auto numSegments = [wrap, vStep](const int count) {
+        // If we're closing the curve, make sure that we have enough
+        // segments to wrap all the way back to the beginning.
+        // Otherwise, the first segment always eats up 4 verts, not just
+        // vstep, so to compensate, we break at count - 3.
+        return wrap ? count / vStep : ((count - 4) / vStep) + 1;
+    };
+
+    return _GenerateCurveIndices<GfVec4i>(
+        topology,
+        [](const int count) { return count; },
+        numSegments,
+        [wrap, vStep, &numSegments](const int count, const int vertexIndex, GfVec4i* segments) {
+            const int numSegs = numSegments(count);
+            for (int i = 0; i < numSegs; ++i) {
+                // Set up curve segments based on curve basis
+                GfVec4i&  seg = segments[i];
+                const int offset = i * vStep;
+                for (int v = 0; v < 4; ++v) {
+                    // If there are not enough verts to round out the segment
+                    // just repeat the last vert.
+                    seg[v] = wrap ? vertexIndex + ((offset + v) % count)
+                                  : vertexIndex + std::min(offset + v, (count - 1));
+                }
+            }
+        });
+}
+
+VtVec2iArray HdVP2BuildLinesIndexArray(const HdBasisCurvesTopology& topology)
+{
+    // Each curve is a list of independent lines, and every line consumes two
+    // vertices, even the last one of a curve with an odd vertex count.
+    const auto numLines = [](const int count) { return count > 0 ? (count + 1) / 2 : 0; };
+
+    return _GenerateCurveIndices<GfVec2i>(
+        topology,
+        [&numLines](const int count) { return 2 * numLines(count); },
+        numLines,
+        [&numLines](const int count, const int vertexIndex, GfVec2i* lines) {
+            const int numCurveLines = numLines(count);
+            for (int i = 0; i < numCurveLines; ++i) {
+                lines[i].Set(vertexIndex + 2 * i, vertexIndex + 2 * i + 1);
+            }
+        });
+}
+
+VtVec2iArray HdVP2BuildLineSegmentIndexArray(const HdBasisCurvesTopology& topology)
+{
+    const TfToken basis = topology.GetCurveBasis();
+    const bool    skipFirstAndLastSegs = (basis == HdTokens->catmullRom);
+    const bool    wrap = topology.GetCurveWrap() == HdTokens->periodic;
+
+    // Segments connect consecutive vertices of a curve, optionally skipping
+    // the first and last ones, and closing the curve when wrapping.
+    const int firstSeg = skipFirstAndLastSegs ? 2 : 1;
+    const auto numSegments = [firstSeg, skipFirstAndLastSegs, wrap](const int count) {
+        const int lastSeg = skipFirstAndLastSegs ? count - 2 : count - 1;
+        return std::max(lastSeg - firstSeg + 1, 0) + (wrap ? 1 : 0);
+    };
+
+    return _GenerateCurveIndices<GfVec2i>(
+        topology,
+        // The first vertex of a curve is always consumed, even for empty
+        // curves.
+        [](const int count) { return std::max(count, 1); },
+        numSegments,
+        [firstSeg, skipFirstAndLastSegs, wrap](
+            const int count, const int vertexIndex, GfVec2i* segments) {
+            const int lastSeg = skipFirstAndLastSegs ? count - 2 : count - 1;
+            for (int i = firstSeg; i <= lastSeg; ++i) {
+                (segments++)->Set(vertexIndex + i - 1, vertexIndex + i);
+            }
+            if (wrap) {
+                // Close the curve back to its first vertex.
+                segments->Set(vertexIndex + std::max(count, 1) - 1, vertexIndex);
+            }
+        });
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,48 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_BASIS_CURVES_INDICES
+#define HD_VP2_BASIS_CURVES_INDICES
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/vt/types.h>
+#include <pxr/imaging/hd/basisCurvesTopology.h>
+#include <pxr/pxr.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Generates the indices of the cubic patches of the curves of \p topology.
+
+    The curves are generated in parallel. Periodic curves are closed, other wraps,
+    including pinned, are treated as non-periodic.
+*/
+MAYAUSD_CORE_PUBLIC
+VtVec4iArray HdVP2BuildCubicIndexArray(const HdBasisCurvesTopology& topology);
+
+/*! \brief  Generates the indices of the independent lines of the segmented curves of \p topology.
+ */
+MAYAUSD_CORE_PUBLIC
+VtVec2iArray HdVP2BuildLinesIndexArray(const HdBasisCurvesTopology& topology);
+
+/*! \brief  Generates the indices of the line segments joining the vertices of the curves of
+            \p topology.
+ */
+MAYAUSD_CORE_PUBLIC
+VtVec2iArray HdVP2BuildLineSegmentIndexArray(const HdBasisCurvesTopology& topology);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -16,8 +16,10 @@
 #ifndef HD_VP2_DRAW_ITEM
 #define HD_VP2_DRAW_ITEM
 
+#include <pxr/base/gf/matrix4d.h>
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/vt/array.h>
+#include <pxr/base/vt/types.h>
 #include <pxr/imaging/hd/drawItem.h>
 #include <pxr/imaging/hd/geomSubset.h>
 #include <pxr/imaging/hd/mesh.h>
@@ -30,6 +32,9 @@
 #include <maya/MMatrix.h>
 #include <maya/MString.h>
 
+#include <memory>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 class HdVP2RenderDelegate;
@@ -64,6 +69,12 @@ public:
 
         //! Instance transforms for the render item
         std::shared_ptr<MMatrixArray> _instanceTransforms;
+        //! Instancer transforms the instance transforms were built from
+        VtMatrix4dArray _instancerTransforms;
+        //! World matrix the instance transforms were built from
+        MMatrix _instancerWorldMatrix;
+        //! USD instance ids the instance transforms were built from
+        std::vector<unsigned int> _instanceIds;
 
         //! Instance colors for the render item
         std::shared_ptr<MFloatArray> _instanceColors;
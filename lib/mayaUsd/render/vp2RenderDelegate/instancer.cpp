@@ -25,6 +25,7 @@
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/gf/vec4f.h>
 #include <pxr/base/tf/staticTokens.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/imaging/hd/sceneDelegate.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -78,11 +79,15 @@ void HdVP2Instancer::_SyncPrimvars()
     HdDirtyBits dirtyBits = changeTracker.GetInstancerDirtyBits(id);
     if (HdChangeTracker::IsAnyPrimvarDirty(dirtyBits, id)
         || HdChangeTracker::IsInstancerDirty(dirtyBits, id)
-        || HdChangeTracker::IsInstanceIndexDirty(dirtyBits, id)) {
+        || HdChangeTracker::IsInstanceIndexDirty(dirtyBits, id)
+        || HdChangeTracker::IsTransformDirty(dirtyBits, id)) {
         std::lock_guard<std::mutex> lock(_instanceLock);
 
         // If not dirty, then another thread did the job
         dirtyBits = changeTracker.GetInstancerDirtyBits(id);
+        if (dirtyBits == HdChangeTracker::Clean) {
+            return;
+        }
 
 #if defined(HD_API_VERSION) && HD_API_VERSION >= 36
         _UpdateInstancer(GetDelegate(), &dirtyBits);
@@ -110,17 +115,37 @@ void HdVP2Instancer::_SyncPrimvars()
             }
         }
 
+        // Invalidate the cached instance transforms of all prototypes
+        ++_primvarVersion;
+
         // Mark the instancer as clean
         changeTracker.MarkInstancerClean(id);
     }
 }
 
+/*! \brief  Returns a sampler for the given instance primvar, or nullptr if the
+            instancer does not provide it.
+*/
+std::unique_ptr<HdVP2BufferSampler> HdVP2Instancer::_GetPrimvarSampler(TfToken const& name) const
+{
+    auto it = _primvarMap.find(name);
+    if (it == _primvarMap.end()) {
+        return nullptr;
+    }
+    return std::make_unique<HdVP2BufferSampler>(*it->second);
+}
+
 /*! \brief  Computes all instance transforms for the provided prototype id.
 
     Taking into account the scene delegate's instancerTransform and the
     instance primvars "instanceTransform", "translate", "rotate", "scale".
     Computes and flattens nested transforms, if necessary.
 
+    The result is cached per prototype and only recomputed when the instancer
+    has pulled new data from the scene delegate, or when the transforms of the
+    parent instancer have changed, so that the prototypes of an instancer
+    don't all recompose the same transforms on every sync.
+
     \param prototypeId The prototype to compute transforms for.
 
     \return One transform per instance, to apply when drawing.
@@ -132,6 +157,76 @@ VtMatrix4dArray HdVP2Instancer::ComputeInstanceTransforms(SdfPath const& prototy
 
     _SyncPrimvars();
 
+    const size_t version = _primvarVersion;
+
+    bool            hasParent = false;
+    VtMatrix4dArray parentTransforms;
+    if (!GetParentId().IsEmpty()) {
+        HdInstancer* parentInstancer = GetDelegate()->GetRenderIndex().GetInstancer(GetParentId());
+        if (TF_VERIFY(parentInstancer)) {
+            hasParent = true;
+            parentTransforms
+                = static_cast<HdVP2Instancer*>(parentInstancer)->ComputeInstanceTransforms(GetId());
+        }
+    }
+
+    // The parent instancer hands out its cached array while it is up to date,
+    // so an identical array means the parent transforms did not change.
+    {
+        std::lock_guard<std::mutex> lock(_transformsLock);
+        auto                        it = _transformsCache.find(prototypeId);
+        if (it != _transformsCache.end() && it->second.version == version
+            && it->second.parentTransforms.IsIdentical(parentTransforms)) {
+            return it->second.transforms;
+        }
+    }
+
+    VtMatrix4dArray transforms = _ComputeTransforms(prototypeId);
+
+    if (hasParent) {
+        // The transforms taking nesting into account are computed by:
+        // parentTransforms = parentInstancer->ComputeInstanceTransforms(GetId())
+        // foreach (parentXf : parentTransforms, xf : transforms) {
+        //     parentXf * xf
+        // }
+        VtMatrix4dArray   final(parentTransforms.size() * transforms.size());
+        GfMatrix4d* const finalData = final.data();
+        WorkParallelForN(parentTransforms.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                for (size_t j = 0; j < transforms.size(); ++j) {
+                    finalData[i * transforms.size() + j] = transforms[j] * parentTransforms[i];
+                }
+            }
+        });
+        transforms = final;
+    }
+
+    std::lock_guard<std::mutex> lock(_transformsLock);
+    _InstanceTransforms&        entry = _transformsCache[prototypeId];
+    entry.transforms = transforms;
+    entry.parentTransforms = parentTransforms;
+    entry.version = version;
+    return transforms;
+}
+
+/*! \brief  Releases the cached instance transforms of a prototype that is
+            being removed.
+
+    \param prototypeId The prototype, an rprim or a nested instancer.
+*/
+void HdVP2Instancer::RemovePrototype(SdfPath const& prototypeId)
+{
+    std::lock_guard<std::mutex> lock(_transformsLock);
+    _transformsCache.erase(prototypeId);
+}
+
+/*! \brief  Computes the instance transforms of this level of instancing for
+            the provided prototype id, ignoring any parent instancer.
+*/
+VtMatrix4dArray HdVP2Instancer::_ComputeTransforms(SdfPath const& prototypeId) const
+{
+    HD_TRACE_FUNCTION();
+
     // The transforms for this level of instancer are computed by:
     // foreach(index : indices) {
     //     instancerTransform
@@ -142,116 +237,81 @@ VtMatrix4dArray HdVP2Instancer::ComputeInstanceTransforms(SdfPath const& prototy
     // }
     // If any transform isn't provided, it's assumed to be the identity.
 
-    GfMatrix4d instancerTransform = GetDelegate()->GetInstancerTransform(GetId());
-    VtIntArray instanceIndices = GetDelegate()->GetInstanceIndices(GetId(), prototypeId);
-
-    VtMatrix4dArray transforms(instanceIndices.size());
-    for (size_t i = 0; i < instanceIndices.size(); ++i) {
-        transforms[i] = instancerTransform;
-    }
+    const GfMatrix4d instancerTransform = GetDelegate()->GetInstancerTransform(GetId());
+    const VtIntArray instanceIndices = GetDelegate()->GetInstanceIndices(GetId(), prototypeId);
 
-    // "hydra:instanceTranslations" holds a translation vector for each index.
 #if HD_API_VERSION < 56
-    if (_primvarMap.count(HdInstancerTokens->translate) > 0) {
-        HdVP2BufferSampler sampler(*_primvarMap[HdInstancerTokens->translate]);
+    // "hydra:translate" holds a translation vector for each index.
+    const auto translateSampler = _GetPrimvarSampler(HdInstancerTokens->translate);
+    // "hydra:rotate" holds a quaternion in <real, i, j, k> format for each index.
+    const auto rotateSampler = _GetPrimvarSampler(HdInstancerTokens->rotate);
+    // "hydra:scale" holds an axis-aligned scale vector for each index.
+    const auto scaleSampler = _GetPrimvarSampler(HdInstancerTokens->scale);
+    // "hydra:instanceTransform" holds a 4x4 transform matrix for each index.
+    const auto instanceTransformSampler
+        = _GetPrimvarSampler(HdInstancerTokens->instanceTransform);
 #else
-    if (_primvarMap.count(HdInstancerTokens->instanceTranslations) > 0) {
-        HdVP2BufferSampler sampler(*_primvarMap[HdInstancerTokens->instanceTranslations]);
+    // "hydra:instanceTranslations" holds a translation vector for each index.
+    const auto translateSampler = _GetPrimvarSampler(HdInstancerTokens->instanceTranslations);
+    // "hydra:instanceRotations" holds a quaternion in <real, i, j, k> format
+    // for each index.
+    const auto rotateSampler = _GetPrimvarSampler(HdInstancerTokens->instanceRotations);
+    // "hydra:instanceScales" holds an axis-aligned scale vector for each index.
+    const auto scaleSampler = _GetPrimvarSampler(HdInstancerTokens->instanceScales);
+    // "hydra:instanceTransforms" holds a 4x4 transform matrix for each index.
+    const auto instanceTransformSampler
+        = _GetPrimvarSampler(HdInstancerTokens->instanceTransforms);
 #endif
-        for (size_t i = 0; i < instanceIndices.size(); ++i) {
+
+    VtMatrix4dArray transforms(instanceIndices.size());
+
+    // Each instance is composed independently, so split them over the
+    // worker threads. The samplers are only read from.
+    GfMatrix4d* const transformsData = transforms.data();
+    WorkParallelForN(instanceIndices.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const int  index = instanceIndices[i];
+            GfMatrix4d transform = instancerTransform;
+
             GfVec3f translate;
-            if (sampler.Sample(instanceIndices[i], &translate)) {
+            if (translateSampler && translateSampler->Sample(index, &translate)) {
                 GfMatrix4d translateMat(1);
                 translateMat.SetTranslate(GfVec3d(translate));
-                transforms[i] = translateMat * transforms[i];
+                transform = translateMat * transform;
             }
-        }
-    }
 
-    // "hydra:instanceRotations" holds a quaternion in <real, i, j, k> format
-    // for each index.
-#if HD_API_VERSION < 56
-    if (_primvarMap.count(HdInstancerTokens->rotate) > 0) {
-        HdVP2BufferSampler sampler(*_primvarMap[HdInstancerTokens->rotate]);
-#else
-    if (_primvarMap.count(HdInstancerTokens->instanceRotations) > 0) {
-        HdVP2BufferSampler sampler(*_primvarMap[HdInstancerTokens->instanceRotations]);
-#endif
-        for (size_t i = 0; i < instanceIndices.size(); ++i) {
-            GfQuath quath;
-            if (sampler.Sample(instanceIndices[i], &quath)) {
-                GfMatrix4d rotateMat(1);
-                rotateMat.SetRotate(quath);
-                transforms[i] = rotateMat * transforms[i];
-            } else {
+            if (rotateSampler) {
+                GfQuath quath;
                 GfVec4f quat;
-                if (sampler.Sample(instanceIndices[i], &quat)) {
+                if (rotateSampler->Sample(index, &quath)) {
+                    GfMatrix4d rotateMat(1);
+                    rotateMat.SetRotate(quath);
+                    transform = rotateMat * transform;
+                } else if (rotateSampler->Sample(index, &quat)) {
                     GfMatrix4d rotateMat(1);
                     rotateMat.SetRotate(GfQuatd(quat[0], quat[1], quat[2], quat[3]));
-                    transforms[i] = rotateMat * transforms[i];
+                    transform = rotateMat * transform;
                 }
             }
-        }
-    }
 
-    // "hydra:instanceScales" holds an axis-aligned scale vector for each index.
-#if HD_API_VERSION < 56
-    if (_primvarMap.count(HdInstancerTokens->scale) > 0) {
-        HdVP2BufferSampler sampler(*_primvarMap[HdInstancerTokens->scale]);
-#else
-    if (_primvarMap.count(HdInstancerTokens->instanceScales) > 0) {
-        HdVP2BufferSampler sampler(*_primvarMap[HdInstancerTokens->instanceScales]);
-#endif
-        for (size_t i = 0; i < instanceIndices.size(); ++i) {
             GfVec3f scale;
-            if (sampler.Sample(instanceIndices[i], &scale)) {
+            if (scaleSampler && scaleSampler->Sample(index, &scale)) {
                 GfMatrix4d scaleMat(1);
                 scaleMat.SetScale(GfVec3d(scale));
-                transforms[i] = scaleMat * transforms[i];
+                transform = scaleMat * transform;
             }
-        }
-    }
 
-    // "hydra:instanceTransforms" holds a 4x4 transform matrix for each index.
-#if HD_API_VERSION < 56
-    if (_primvarMap.count(HdInstancerTokens->instanceTransform) > 0) {
-        HdVP2BufferSampler sampler(*_primvarMap[HdInstancerTokens->instanceTransform]);
-#else
-    if (_primvarMap.count(HdInstancerTokens->instanceTransforms) > 0) {
-        HdVP2BufferSampler sampler(*_primvarMap[HdInstancerTokens->instanceTransforms]);
-#endif
-        for (size_t i = 0; i < instanceIndices.size(); ++i) {
             GfMatrix4d instanceTransform;
-            if (sampler.Sample(instanceIndices[i], &instanceTransform)) {
-                transforms[i] = instanceTransform * transforms[i];
+            if (instanceTransformSampler
+                && instanceTransformSampler->Sample(index, &instanceTransform)) {
+                transform = instanceTransform * transform;
             }
-        }
-    }
-
-    if (GetParentId().IsEmpty()) {
-        return transforms;
-    }
-
-    HdInstancer* parentInstancer = GetDelegate()->GetRenderIndex().GetInstancer(GetParentId());
-    if (!TF_VERIFY(parentInstancer)) {
-        return transforms;
-    }
 
-    // The transforms taking nesting into account are computed by:
-    // parentTransforms = parentInstancer->ComputeInstanceTransforms(GetId())
-    // foreach (parentXf : parentTransforms, xf : transforms) {
-    //     parentXf * xf
-    // }
-    VtMatrix4dArray parentTransforms
-        = static_cast<HdVP2Instancer*>(parentInstancer)->ComputeInstanceTransforms(GetId());
-
-    VtMatrix4dArray final(parentTransforms.size() * transforms.size());
-    for (size_t i = 0; i < parentTransforms.size(); ++i) {
-        for (size_t j = 0; j < transforms.size(); ++j) {
-            final[i * transforms.size() + j] = transforms[j] * parentTransforms[i];
+            transformsData[i] = transform;
         }
-    }
-    return final;
+    });
+
+    return transforms;
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
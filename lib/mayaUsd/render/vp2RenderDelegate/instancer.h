@@ -18,16 +18,26 @@
 #ifndef HD_VP2_INSTANCER
 #define HD_VP2_INSTANCER
 
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/gf/matrix4d.h>
 #include <pxr/base/tf/hashmap.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/base/vt/array.h>
 #include <pxr/imaging/hd/instancer.h>
 #include <pxr/imaging/hd/vtBufferSource.h>
 #include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
 
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <unordered_map>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+class HdVP2BufferSampler;
+
 /*! \brief  VP2 instancing of prototype geometry with varying transforms
     \class  HdVP2Instancer
 
@@ -35,7 +45,7 @@ PXR_NAMESPACE_OPEN_SCOPE
     cartesian product of the transform arrays at each nesting level, to
     create a flattened transform array.
 */
-class HdVP2Instancer final : public HdInstancer
+class MAYAUSD_CORE_PUBLIC HdVP2Instancer final : public HdInstancer
 {
 public:
 #if defined(HD_API_VERSION) && HD_API_VERSION >= 36
@@ -48,12 +58,35 @@ public:
 
     VtMatrix4dArray ComputeInstanceTransforms(SdfPath const& prototypeId);
 
+    void RemovePrototype(SdfPath const& prototypeId);
+
 private:
     void _SyncPrimvars();
 
+    std::unique_ptr<HdVP2BufferSampler> _GetPrimvarSampler(TfToken const& name) const;
+
+    VtMatrix4dArray _ComputeTransforms(SdfPath const& prototypeId) const;
+
     //! Mutex guard for _SyncPrimvars().
     std::mutex _instanceLock;
 
+    //! Incremented every time _SyncPrimvars() pulls new data from the scene delegate.
+    std::atomic<size_t> _primvarVersion { 0 };
+
+    //! Cached instance transforms of a prototype.
+    struct _InstanceTransforms
+    {
+        VtMatrix4dArray transforms;       //!< Flattened transforms returned to the prototype
+        VtMatrix4dArray parentTransforms; //!< Parent instancer transforms they were built from
+        size_t          version = 0;      //!< Value of _primvarVersion they were built from
+    };
+
+    //! Mutex guard for _transformsCache.
+    std::mutex _transformsLock;
+
+    //! Cached instance transforms, keyed by prototype id.
+    std::unordered_map<SdfPath, _InstanceTransforms, SdfPath::Hash> _transformsCache;
+
     /*! Map of the latest primvar data for this instancer, keyed by
         primvar name. Primvar values are VtValue, an any-type; they are
         interpreted at consumption time (here, in ComputeInstanceTransforms).
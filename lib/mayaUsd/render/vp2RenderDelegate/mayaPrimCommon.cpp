@@ -21,6 +21,7 @@
 #include "renderDelegate.h"
 #include "tokens.h"
 
+#include <pxr/base/work/loops.h>
 #include <pxr/usdImaging/usdImaging/delegate.h>
 
 #ifdef MAYA_HAS_DISPLAY_LAYER_API
@@ -33,6 +34,9 @@
 #include <maya/M3dView.h>
 #include <maya/MProfiler.h>
 
+#include <algorithm>
+#include <atomic>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 const MColor MayaUsdRPrim::kOpaqueBlue(0.0f, 0.0f, 1.0f, 1.0f);
@@ -48,6 +52,9 @@ constexpr auto sDrawModeAllButBBox = (MHWRender::MGeometry::DrawMode)(
 
 static const InstancePrototypePath sVoidInstancePrototypePath { SdfPath(), kNativeInstancing };
 
+//! Primvar arrays are processed in parallel in chunks of this many elements.
+constexpr size_t sPrimvarGrainSize = 16384;
+
 #ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
 
 namespace {
@@ -131,6 +138,56 @@ void MayaUsdRPrim::_CommitMVertexBuffer(MHWRender::MVertexBuffer* const buffer,
         [buffer, bufferData, rprimId]() { buffer->commit(bufferData); });
 }
 
+/* static */
+bool MayaUsdRPrim::_HasTransparentAlpha(const VtFloatArray& alphaArray)
+{
+    const float*      alphas = alphaArray.cdata();
+    std::atomic<bool> transparent { false };
+
+    WorkParallelForN(
+        alphaArray.size(),
+        [alphas, &transparent](size_t begin, size_t end) {
+            if (transparent.load(std::memory_order_relaxed)) {
+                return;
+            }
+            if (std::any_of(alphas + begin, alphas + end, [](float a) { return a < 0.999f; })) {
+                transparent.store(true, std::memory_order_relaxed);
+            }
+        },
+        sPrimvarGrainSize);
+
+    return transparent.load();
+}
+
+/* static */
+void MayaUsdRPrim::_FillColorBuffer(
+    float*              bufferData,
+    const VtVec3fArray& colorArray,
+    const VtFloatArray& alphaArray,
+    size_t              numVertices)
+{
+    if (!TF_VERIFY(numVertices <= colorArray.size() && numVertices <= alphaArray.size())) {
+        return;
+    }
+
+    const GfVec3f* colors = colorArray.cdata();
+    const float*   alphas = alphaArray.cdata();
+
+    WorkParallelForN(
+        numVertices,
+        [bufferData, colors, alphas](size_t begin, size_t end) {
+            // A plain loop over raw pointers, which the compiler can vectorize.
+            float* color = bufferData + begin * kNumColorChannels;
+            for (size_t v = begin; v < end; ++v, color += kNumColorChannels) {
+                color[0] = colors[v][0];
+                color[1] = colors[v][1];
+                color[2] = colors[v][2];
+                color[3] = alphas[v];
+            }
+        },
+        sPrimvarGrainSize);
+}
+
 void MayaUsdRPrim::_SetWantConsolidation(MHWRender::MRenderItem& renderItem, bool state)
 {
     renderItem.setWantConsolidation(state);
@@ -613,6 +670,19 @@ void MayaUsdRPrim::_ForEachRenderItemInRepr(const HdReprSharedPtr& curRepr, Rend
     }
 }
 
+bool MayaUsdRPrim::HasDirtyRenderItems(const HdReprSharedPtr& repr)
+{
+    bool           dirty = false;
+    RenderItemFunc checkDirty = [&dirty](HdVP2DrawItem::RenderItemData& renderItemData) {
+        if (renderItemData.GetDirtyBits() & HdChangeTracker::AllDirty) {
+            dirty = true;
+        }
+    };
+
+    _ForEachRenderItemInRepr(repr, checkDirty);
+    return dirty;
+}
+
 void MayaUsdRPrim::_ForEachRenderItem(const ReprVector& reprs, RenderItemFunc& func)
 {
     for (const std::pair<TfToken, HdReprSharedPtr>& pair : reprs) {
@@ -20,6 +20,8 @@
 #include "pxr/imaging/hd/changeTracker.h"
 #include "pxr/imaging/hd/types.h"
 
+#include <pxr/base/vt/types.h>
+
 #include <mayaUsd/render/vp2RenderDelegate/proxyRenderDelegate.h>
 
 #include <maya/MHWGeometry.h>
@@ -165,6 +167,10 @@ public:
     MayaUsdRPrim(HdVP2RenderDelegate* delegate, const SdfPath& id);
     virtual ~MayaUsdRPrim();
 
+    //! Returns true if any render item of the repr still has pending dirty bits, meaning the repr
+    //! was not synced since the last change of the rprim.
+    static bool HasDirtyRenderItems(const HdReprSharedPtr& repr);
+
 protected:
     using ReprVector = std::vector<std::pair<TfToken, HdReprSharedPtr>>;
     using RenderItemFunc = std::function<void(HdVP2DrawItem::RenderItemData&)>;
@@ -258,6 +264,17 @@ protected:
 
     void _CommitMVertexBuffer(MHWRender::MVertexBuffer* const, void*) const;
 
+    //! Returns true if some opacity of alphaArray is translucent.
+    static bool _HasTransparentAlpha(const VtFloatArray& alphaArray);
+
+    //! Interleaves the first numVertices colors and opacities into the float4
+    //! color stream bufferData.
+    static void _FillColorBuffer(
+        float*              bufferData,
+        const VtVec3fArray& colorArray,
+        const VtFloatArray& alphaArray,
+        size_t              numVertices);
+
     void _UpdateTransform(
         MayaUsdCommitState&      stateToCommit,
         const HdRprimSharedData& sharedData,
@@ -1868,7 +1868,10 @@ void HdVP2Mesh::_UpdateDrawItem(
     // If the mesh is instanced, create one new instance per transform.
     // The current instancer invalidation tracking makes it hard for
     // us to tell whether transforms will be dirty, so this code
-    // pulls them every time something changes. Then, it compares the
+    // pulls them every time something changes. The instancer hands back
+    // its cached array while the transforms are unchanged, so when that
+    // array, the world matrix and the drawn instances are the same as last
+    // time the per-element compare is skipped. Otherwise it compares the
     // new transforms and the old transforms. If they are the same, skip
     // updating Maya.
     // If the mesh is instanced but has 0 instance transforms remember that
@@ -1881,8 +1884,9 @@ void HdVP2Mesh::_UpdateDrawItem(
         VtMatrix4dArray transforms
             = static_cast<HdVP2Instancer*>(instancer)->ComputeInstanceTransforms(id);
 
-        MMatrix            instanceMatrix;
-        const unsigned int instanceCount = transforms.size();
+        MMatrix                   instanceMatrix;
+        const unsigned int        instanceCount = transforms.size();
+        std::vector<unsigned int> instanceIds;
 
         if (0 == instanceCount) {
             instancerWithNoInstances = true;
@@ -2033,6 +2037,7 @@ void HdVP2Mesh::_UpdateDrawItem(
 
             stateToCommit._instanceTransforms = std::make_shared<MMatrixArray>();
             stateToCommit._instanceColors = std::make_shared<MFloatArray>();
+            instanceIds.reserve(instanceCount);
             for (unsigned int usdInstanceId = 0; usdInstanceId < instanceCount; usdInstanceId++) {
                 auto info = instanceInfo[usdInstanceId];
                 if (info == kInvalid)
@@ -2056,6 +2061,7 @@ void HdVP2Mesh::_UpdateDrawItem(
 #endif
                 transforms[usdInstanceId].Get(instanceMatrix.matrix);
                 stateToCommit._instanceTransforms->append(worldMatrix * instanceMatrix);
+                instanceIds.push_back(usdInstanceId);
 #ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
                 mayaToUsd.push_back(usdInstanceId);
 #endif
@@ -2108,7 +2114,12 @@ void HdVP2Mesh::_UpdateDrawItem(
         bool instanceTransformsChanged = static_cast<bool>(stateToCommit._instanceTransforms)
             ? !static_cast<bool>(drawItemData._instanceTransforms)
             : static_cast<bool>(drawItemData._instanceTransforms);
-        if (stateToCommit._instanceTransforms && drawItemData._instanceTransforms) {
+        if (stateToCommit._instanceTransforms && drawItemData._instanceTransforms
+            && transforms.IsIdentical(drawItemData._instancerTransforms)
+            && worldMatrix == drawItemData._instancerWorldMatrix
+            && instanceIds == drawItemData._instanceIds) {
+            instanceTransformsChanged = false;
+        } else if (stateToCommit._instanceTransforms && drawItemData._instanceTransforms) {
             instanceTransformsChanged
                 = (stateToCommit._instanceTransforms->length()
                    != drawItemData._instanceTransforms->length());
@@ -2127,6 +2138,9 @@ void HdVP2Mesh::_UpdateDrawItem(
         } else {
             drawItemData._instanceTransforms = stateToCommit._instanceTransforms;
         }
+        drawItemData._instancerTransforms = transforms;
+        drawItemData._instancerWorldMatrix = worldMatrix;
+        drawItemData._instanceIds = std::move(instanceIds);
 
         // compate the new _instanceColors on stateToCommit to
         // the existing instance colors (if any) on drawItemData
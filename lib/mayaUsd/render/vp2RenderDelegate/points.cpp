@@ -62,27 +62,19 @@ VtArray<BaseType> _BuildInterpolatedArray(
     const VtArray<BaseType>& authoredData,
     const BaseType&          defaultValue)
 {
-    VtArray<BaseType> result(numVerts);
-    size_t            size = authoredData.size();
+    const size_t size = authoredData.size();
 
     if (size == 1) {
         // Uniform data
-        const BaseType& elem = authoredData[0];
-        for (size_t i = 0; i < numVerts; ++i) {
-            result[i] = elem;
-        }
+        return VtArray<BaseType>(numVerts, authoredData[0]);
     } else if (size == numVerts) {
         // Vertex data
-        result = authoredData;
-    } else {
-        // Fallback
-        for (size_t i = 0; i < numVerts; ++i) {
-            result[i] = defaultValue;
-        }
-        TF_WARN("Incorrect number of primvar data, using default value for rendering.");
+        return authoredData;
     }
 
-    return result;
+    // Fallback
+    TF_WARN("Incorrect number of primvar data, using default value for rendering.");
+    return VtArray<BaseType>(numVerts, defaultValue);
 }
 
 } // anonymous namespace
@@ -441,13 +433,7 @@ void HdVP2Points::_UpdateDrawItem(
                     // Due to the performance indication about transparency, we have to
                     // traverse the array and enable transparency only when needed.
                     if (!stateToCommit._isTransparent) {
-                        const size_t numAlphas = alphaArray.size();
-                        for (size_t i = 0; i < numAlphas; i++) {
-                            if (alphaArray[i] < 0.999f) {
-                                stateToCommit._isTransparent = true;
-                                break;
-                            }
-                        }
+                        stateToCommit._isTransparent = _HasTransparentAlpha(alphaArray);
                     }
                 }
             }
@@ -533,15 +519,7 @@ void HdVP2Points::_UpdateDrawItem(
                     _pointsSharedData._colorBuffer->acquire(numVertices, true));
 
                 if (bufferData) {
-                    unsigned int offset = 0;
-                    for (size_t v = 0; v < numVertices; v++) {
-                        const GfVec3f& color = colorArray[v];
-                        bufferData[offset++] = color[0];
-                        bufferData[offset++] = color[1];
-                        bufferData[offset++] = color[2];
-
-                        bufferData[offset++] = alphaArray[v];
-                    }
+                    _FillColorBuffer(bufferData, colorArray, alphaArray, numVertices);
 
                     _CommitMVertexBuffer(_pointsSharedData._colorBuffer.get(), bufferData);
                 }
@@ -251,6 +251,50 @@ void AppendSelectedPrimPaths(const HdSelectionSharedPtr& selection, SdfPathVecto
     }
 }
 
+//! \brief  Returns true if both selection states would produce the same highlight.
+bool SameSelectionState(
+    const HdSelection::PrimSelectionState* state1,
+    const HdSelection::PrimSelectionState* state2)
+{
+    if (!state1 || !state2) {
+        return state1 == state2;
+    }
+
+    return state1->fullySelected == state2->fullySelected
+        && state1->instanceIndices == state2->instanceIndices
+        && state1->elementIndices == state2->elementIndices
+        && state1->edgeIndices == state2->edgeIndices
+        && state1->pointIndices == state2->pointIndices;
+}
+
+//! \brief  Append the prim paths whose selection state differs between the old and the new
+//!         selection, i.e. prims added, removed or with different instance indices.
+void AppendChangedPrimPaths(
+    const HdSelectionSharedPtr& oldSelection,
+    const HdSelectionSharedPtr& newSelection,
+    SdfPathVector&              result)
+{
+    constexpr auto mode = HdSelection::HighlightModeSelect;
+
+    if (oldSelection) {
+        for (const SdfPath& path : oldSelection->GetSelectedPrimPaths(mode)) {
+            const HdSelection::PrimSelectionState* newState
+                = newSelection ? newSelection->GetPrimSelectionState(mode, path) : nullptr;
+            if (!SameSelectionState(oldSelection->GetPrimSelectionState(mode, path), newState)) {
+                result.push_back(path);
+            }
+        }
+    }
+
+    if (newSelection) {
+        for (const SdfPath& path : newSelection->GetSelectedPrimPaths(mode)) {
+            if (!oldSelection || !oldSelection->GetPrimSelectionState(mode, path)) {
+                result.push_back(path);
+            }
+        }
+    }
+}
+
 //! \brief  Configure repr descriptions
 void _ConfigureReprs()
 {
@@ -634,6 +678,7 @@ void ProxyRenderDelegate::_ClearRenderDelegate()
     _changeVersions.reset();
     _taskRenderTagsValid = false;
     _isPopulated = false;
+    _preparedReprs.clear();
 }
 
 //! \brief  Clear data which is now stale because proxy shape attributes have changed
@@ -1077,6 +1122,49 @@ void ProxyRenderDelegate::ComputeCombinedDisplayStyles(const unsigned int newDis
     }
 }
 
+//! \brief  Record the reprs of the selector as prepared. Returns true if any of them was never
+//!         built before, in which case every rprim needs to be synced.
+bool ProxyRenderDelegate::_AddPreparedReprs(const HdReprSelector& reprSelector)
+{
+    bool newRepr = false;
+    for (size_t i = 0; i < HdReprSelector::MAX_TOPOLOGY_REPRS; ++i) {
+        if (reprSelector.IsActiveRepr(i)) {
+            newRepr |= _preparedReprs.insert(reprSelector[i]).second;
+        }
+    }
+    return newRepr;
+}
+
+//! \brief  Switching back to already prepared reprs only requires a sync of the rprims which
+//!         changed while those reprs were not part of the selector, all the other render items
+//!         are up-to-date and VP2 filters them by draw mode.
+void ProxyRenderDelegate::_MarkStaleReprsDirty(const HdReprSelector& reprSelector)
+{
+    MProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorC_L1, "MarkStaleReprsDirty");
+
+    HdChangeTracker& changeTracker = _renderIndex->GetChangeTracker();
+    for (const SdfPath& path : _renderIndex->GetRprimIds()) {
+        const HdRprim* rprim = _renderIndex->GetRprim(path);
+        if (!rprim) {
+            continue;
+        }
+
+        for (size_t i = 0; i < HdReprSelector::MAX_TOPOLOGY_REPRS; ++i) {
+            if (!reprSelector.IsActiveRepr(i)) {
+                continue;
+            }
+
+            // Rprims added after the repr was prepared may not have it yet.
+            HdReprSharedPtr repr = rprim->GetRepr(reprSelector[i]);
+            if (!repr || MayaUsdRPrim::HasDirtyRenderItems(repr)) {
+                changeTracker.MarkRprimDirty(path, MayaUsdRPrim::DirtyDisplayMode);
+                break;
+            }
+        }
+    }
+}
+
 //! \brief  Execute Hydra engine to perform minimal VP2 draw data update based on change tracker.
 void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
 {
@@ -1158,11 +1246,16 @@ void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
     if (reprSelector != HdReprSelector()) {
         HdDirtyBits dirtyBits = HdChangeTracker::Clean;
 
-        // check to see if representation mode changed
+        // check to see if representation mode changed. Only reprs which were never built before
+        // require every rprim to be synced.
+        bool reprSelectorChanged = false;
         if (_defaultCollection->GetReprSelector() != reprSelector) {
             _defaultCollection->SetReprSelector(reprSelector);
             _taskController->SetCollection(*_defaultCollection);
-            dirtyBits |= MayaUsdRPrim::DirtyDisplayMode;
+            reprSelectorChanged = true;
+            if (_AddPreparedReprs(reprSelector)) {
+                dirtyBits |= MayaUsdRPrim::DirtyDisplayMode;
+            }
         }
 
         if (_colorPrefsChanged) {
@@ -1198,12 +1291,13 @@ void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
 
         if (dirtyBits != HdChangeTracker::Clean) {
             // Mark everything "dirty" so that sync is called on everything
-            // If there are multiple views up with different viewport modes then
-            // this is slow.
+            // This only happens the first time a repr is needed, or when colors change.
             auto& rprims = _renderIndex->GetRprimIds();
             for (auto path : rprims) {
                 changeTracker.MarkRprimDirty(path, dirtyBits);
             }
+        } else if (reprSelectorChanged) {
+            _MarkStaleReprsDirty(reprSelector);
         }
 
         _engine.Execute(_renderIndex.get(), &_dummyTasks);
@@ -1823,16 +1917,26 @@ void ProxyRenderDelegate::_UpdateSelectionStates()
         dirtyPaths = &_renderIndex->GetRprimIds();
         _PopulateSelection();
     } else {
-        // Append pre-update lead and active selection.
-        AppendSelectedPrimPaths(_leadSelection, rootPaths);
-        AppendSelectedPrimPaths(_activeSelection, rootPaths);
+        const HdSelectionSharedPtr previousLeadSelection = _leadSelection;
+        const HdSelectionSharedPtr previousActiveSelection = _activeSelection;
 
         // Update lead and active selection.
         _PopulateSelection();
 
-        // Append post-update lead and active selection.
-        AppendSelectedPrimPaths(_leadSelection, rootPaths);
-        AppendSelectedPrimPaths(_activeSelection, rootPaths);
+        // Only the prims whose selection state changed need to update their highlight.
+        // The selection mode affects every selected prim though.
+#ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
+        if (_selectionModeChanged) {
+            AppendSelectedPrimPaths(previousLeadSelection, rootPaths);
+            AppendSelectedPrimPaths(previousActiveSelection, rootPaths);
+            AppendSelectedPrimPaths(_leadSelection, rootPaths);
+            AppendSelectedPrimPaths(_activeSelection, rootPaths);
+        } else
+#endif
+        {
+            AppendChangedPrimPaths(previousLeadSelection, _leadSelection, rootPaths);
+            AppendChangedPrimPaths(previousActiveSelection, _activeSelection, rootPaths);
+        }
 
         dirtyPaths = &rootPaths;
     }
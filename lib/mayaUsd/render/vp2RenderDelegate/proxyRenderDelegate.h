@@ -20,6 +20,7 @@
 #include <mayaUsd/utils/util.h>
 
 #include <pxr/imaging/hd/engine.h>
+#include <pxr/imaging/hd/repr.h>
 #include <pxr/imaging/hd/selection.h>
 #include <pxr/imaging/hd/task.h>
 #include <pxr/pxr.h>
@@ -296,6 +297,8 @@ private:
     _GetFilteredRprims(HdRprimCollection const& collection, TfTokenVector const& renderTags);
 
     void ComputeCombinedDisplayStyles(const unsigned int newDisplayStyle);
+    bool _AddPreparedReprs(const HdReprSelector& reprSelector);
+    void _MarkStaleReprsDirty(const HdReprSelector& reprSelector);
 
     /*! \brief  Hold all data related to the proxy shape.
 
@@ -357,6 +360,7 @@ private:
     std::unique_ptr<UsdImagingDelegate> _sceneDelegate; //!< USD scene delegate
     const MHWRender::MFrameContext*     _currentFrameContext = nullptr;
     std::map<TfToken, uint64_t>         _combinedDisplayStyles;
+    TfToken::HashSet                    _preparedReprs; //!< Reprs built at least once
     bool                                _needTexturedMaterials = false;
 
     // maps from a path in USD prototype to the corresponding rprim paths
@@ -709,18 +709,40 @@ HdInstancer* HdVP2RenderDelegate::CreateInstancer(
 #if defined(HD_API_VERSION) && HD_API_VERSION >= 36
     const SdfPath& id)
 {
-    return new HdVP2Instancer(delegate, id);
+    auto* instancer = new HdVP2Instancer(delegate, id);
 #else
     const SdfPath& id,
     const SdfPath& instancerId)
 {
-    return new HdVP2Instancer(delegate, id, instancerId);
+    auto* instancer = new HdVP2Instancer(delegate, id, instancerId);
 #endif
+    _instancers[id] = instancer;
+    return instancer;
+}
+
+/*! \brief  Releases the cached instance transforms of a prototype that is
+            being removed from its instancer.
+ */
+void HdVP2RenderDelegate::_RemovePrototype(const SdfPath& instancerId, const SdfPath& prototypeId)
+{
+    if (instancerId.IsEmpty()) {
+        return;
+    }
+
+    auto it = _instancers.find(instancerId);
+    if (it != _instancers.end()) {
+        it->second->RemovePrototype(prototypeId);
+    }
 }
 
 /*! \brief  Destroy instancer instance
  */
-void HdVP2RenderDelegate::DestroyInstancer(HdInstancer* instancer) { delete instancer; }
+void HdVP2RenderDelegate::DestroyInstancer(HdInstancer* instancer)
+{
+    _instancers.erase(instancer->GetId());
+    _RemovePrototype(instancer->GetParentId(), instancer->GetId());
+    delete instancer;
+}
 
 /*! \brief  Request to Allocate and Construct a new, VP2 specialized Rprim.
 
@@ -774,7 +796,11 @@ HdRprim* HdVP2RenderDelegate::CreateRprim(
 
 /*! \brief  Destroy & deallocate Rprim instance
  */
-void HdVP2RenderDelegate::DestroyRprim(HdRprim* rPrim) { delete rPrim; }
+void HdVP2RenderDelegate::DestroyRprim(HdRprim* rPrim)
+{
+    _RemovePrototype(rPrim->GetInstancerId(), rPrim->GetId());
+    delete rPrim;
+}
 
 /*! \brief  Request to Allocate and Construct a new, VP2 specialized Sprim.
 
@@ -23,18 +23,21 @@
 #include <pxr/imaging/hd/renderDelegate.h>
 #include <pxr/imaging/hd/resourceRegistry.h>
 #include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
 
 #include <maya/MShaderManager.h>
 #include <maya/MString.h>
 
 #include <atomic>
 #include <mutex>
+#include <unordered_map>
 
 constexpr char VP2_RENDER_DELEGATE_SEPARATOR = ';';
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 class HdVP2BBoxGeom;
+class HdVP2Instancer;
 class ProxyRenderDelegate;
 
 /*! \brief    VP2 render delegate
@@ -169,6 +172,8 @@ private:
     HdVP2RenderDelegate(const HdVP2RenderDelegate&) = delete;
     HdVP2RenderDelegate& operator=(const HdVP2RenderDelegate&) = delete;
 
+    void _RemovePrototype(const SdfPath& instancerId, const SdfPath& prototypeId);
+
     static std::atomic_int
         _renderDelegateCounter; //!< Number of render delegates. First one creates shared resources
                                 //!< and last one deletes them.
@@ -179,6 +184,9 @@ private:
 
     std::unordered_set<HdSprim*> _materialSprims;
 
+    std::unordered_map<SdfPath, HdVP2Instancer*, SdfPath::Hash>
+        _instancers; //!< Instancers by id, to release what they cache for removed prototypes
+
     std::unique_ptr<HdVP2RenderParam>
             _renderParam; //!< Render param used to provided access to VP2 during prim synchronization
     SdfPath _id;          //!< Render delegate ID
@@ -19,6 +19,7 @@
 #include <mayaUsd/ufe/ProxyShapeHandler.h>
 #include <mayaUsd/ufe/UsdStageMap.h>
 
+#include <usdUfe/ufe/UsdHierarchy.h>
 #include <usdUfe/undo/UsdUndoManager.h>
 
 #include <maya/MMessage.h>
@@ -144,6 +145,10 @@ void MayaStagesSubject::clearListeners()
         });
     _stageListeners.clear();
 
+    // The proxy shapes and their stages may have changed, so the cached
+    // children are not reliable anymore.
+    UsdUfe::UsdHierarchy::clearCachedChildren();
+
     // Set up our stage to proxy shape UFE path (and reverse)
     // mapping.  We do this with the following steps:
     // - get all proxyShape nodes in the scene.
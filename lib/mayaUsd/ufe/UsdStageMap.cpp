@@ -26,6 +26,7 @@
 #include <maya/MGlobal.h>
 #include <ufe/pathString.h>
 
+#include <algorithm>
 #include <cassert>
 
 PXR_NAMESPACE_USING_DIRECTIVE
@@ -160,6 +161,74 @@ void UsdStageMap::addItem(const Ufe::Path& path)
     _stageToObject[stage] = proxyShape;
 }
 
+void UsdStageMap::addObject(const MObjectHandle& proxyShape)
+{
+    if (!proxyShape.isValid()) {
+        return;
+    }
+
+    // If a proxy shape doesn't yet have a stage, don't add it.
+    // We will add it later, when the stage is initialized
+    auto obj = proxyShape.object();
+    auto stage = objToStage(obj);
+    if (!stage) {
+        return;
+    }
+
+    Ufe::Path path = firstPath(proxyShape);
+    if (path.empty()) {
+        return;
+    }
+
+    _pathToObject[path] = proxyShape;
+    _stageToObject[stage] = proxyShape;
+}
+
+void UsdStageMap::removeObject(const MObject& proxyShape, bool keepStage)
+{
+    for (auto it = _pathToObject.begin(); it != _pathToObject.end();) {
+        if (it->second.object() == proxyShape) {
+            it = _pathToObject.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    _pendingObjects.erase(
+        std::remove_if(
+            _pendingObjects.begin(),
+            _pendingObjects.end(),
+            [&proxyShape](const MObjectHandle& pending) { return pending.object() == proxyShape; }),
+        _pendingObjects.end());
+
+    if (!keepStage) {
+        for (auto it = _stageToObject.begin(); it != _stageToObject.end();) {
+            if (it->second.object() != proxyShape) {
+                ++it;
+                continue;
+            }
+
+            // Another proxy shape may share the stage, in which case the stage
+            // now maps to that proxy shape instead.
+            MObjectHandle otherProxyShape;
+            for (const auto& pathAndObject : _pathToObject) {
+                MObject obj = pathAndObject.second.object();
+                if (pathAndObject.second.isValid() && objToStage(obj) == it->first) {
+                    otherProxyShape = pathAndObject.second;
+                    break;
+                }
+            }
+
+            if (otherProxyShape.isValid()) {
+                it->second = otherProxyShape;
+                ++it;
+            } else {
+                it = _stageToObject.erase(it);
+            }
+        }
+    }
+}
+
 UsdStageWeakPtr UsdStageMap::stage(const Ufe::Path& path, bool rebuildCacheIfNeeded)
 {
     // Non-const MObject& requires an lvalue.
@@ -280,14 +349,29 @@ void UsdStageMap::setDirty()
 {
     _pathToObject.clear();
     _stageToObject.clear();
+    _pendingObjects.clear();
     _dirty = true;
 }
 
 bool UsdStageMap::rebuildIfDirty()
 {
-    if (!_dirty)
+    if (!_dirty) {
+        // Enter the proxy shapes added, renamed or reparented since the last
+        // lookup under their current path. This does not count as a rebuild,
+        // so that a lookup miss still falls back to scanning the proxy shapes.
+        if (!_pendingObjects.empty()) {
+            std::vector<MObjectHandle> pendingObjects;
+            pendingObjects.swap(_pendingObjects);
+            for (const MObjectHandle& proxyShape : pendingObjects) {
+                addObject(proxyShape);
+            }
+            TF_DEBUG(MAYAUSD_STAGEMAP)
+                .Msg("Updated %d proxy shapes in stage map\n", int(pendingObjects.size()));
+        }
         return false;
+    }
 
+    _pendingObjects.clear();
     for (const auto& psn : ProxyShapeHandler::getAllNames()) {
         addItem(toPath(psn));
     }
@@ -305,10 +389,13 @@ void UsdStageMap::updateProxyShapeName(
 {
     TF_DEBUG(MAYAUSD_STAGEMAP)
         .Msg("ProxyShape rename %s to %s\n", oldName.asChar(), newName.asChar());
-    // Note: we could try to do more precise updates than just setting dirty,
-    //       but this way we make eh cache self-correcting and rely less on
-    //       which notification comes first.
-    setDirty();
+    // Note: the new path is only computed on the next lookup, so that the
+    //       update does not depend on which notification comes first. The
+    //       lookup itself still verifies cached paths, which keeps the cache
+    //       self-correcting when an ancestor is renamed or reparented.
+    MObjectHandle object(proxyShape.thisMObject());
+    removeObject(object.object(), /*keepStage=*/true);
+    _pendingObjects.push_back(object);
 }
 
 void UsdStageMap::updateProxyShapePath(
@@ -317,28 +404,24 @@ void UsdStageMap::updateProxyShapePath(
 {
     TF_DEBUG(MAYAUSD_STAGEMAP)
         .Msg("ProxyShape new parent %s\n", newParentPath.partialPathName().asChar());
-    // Note: we could try to do more precise updates than just setting dirty,
-    //       but this way we make eh cache self-correcting and rely less on
-    //       which notification comes first.
-    setDirty();
+    // Note: see updateProxyShapeName().
+    MObjectHandle object(proxyShape.thisMObject());
+    removeObject(object.object(), /*keepStage=*/true);
+    _pendingObjects.push_back(object);
 }
 
 void UsdStageMap::addProxyShapeNode(const MayaUsdProxyShapeBase& proxyShape, MObject& node)
 {
     TF_DEBUG(MAYAUSD_STAGEMAP).Msg("MayaUsd proxy shape added\n");
-    // Note: we could try to do more precise updates than just setting dirty,
-    //       but this way we make eh cache self-correcting and rely less on
-    //       which notification comes first.
-    setDirty();
+    // Note: the proxy shape may not have a path nor a stage yet, so it is
+    //       only entered in the maps on the next lookup.
+    _pendingObjects.emplace_back(node);
 }
 
 void UsdStageMap::removeProxyShapeNode(const MayaUsdProxyShapeBase& proxyShape, MObject& node)
 {
     TF_DEBUG(MAYAUSD_STAGEMAP).Msg("MayaUsd proxy shape removed\n");
-    // Note: we could try to do more precise updates than just setting dirty,
-    //       but this way we make eh cache self-correcting and rely less on
-    //       which notification comes first.
-    setDirty();
+    removeObject(node, /*keepStage=*/false);
 }
 
 void UsdStageMap::processNodeAdded(MObject& node)
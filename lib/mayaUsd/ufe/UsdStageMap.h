@@ -28,6 +28,7 @@
 #include <ufe/path.h>
 
 #include <unordered_map>
+#include <vector>
 
 // Pending rework of mayaUsd namespaces, MayaUsdProxyShapeBase is in the Pixar
 // namespace.  PPT, 9-Mar-2021.
@@ -47,7 +48,10 @@ namespace ufe {
     underlying node, we store an MObjectHandle in the maps.
 
     The cache is refreshed on access to a stage given a path which cannot be
-    found.  In this way, the cache does not need to observe the Maya data
+    found. Proxy shape additions, removals, renames and reparents are applied
+    incrementally: removed proxy shapes are dropped right away, while added,
+    renamed and reparented ones are re-entered under their current path on the
+    next access.  In this way, the cache does not need to observe the Maya data
     model, and we avoid order of notification problems where one observer would
     need to access the cache before it is refreshed, since there is no
     guarantee on the order of notification of Ufe observers.  An earlier
@@ -97,6 +101,8 @@ private:
     MAYAUSD_DISALLOW_COPY_MOVE_AND_ASSIGNMENT(UsdStageMap);
 
     void addItem(const Ufe::Path& path);
+    void addObject(const MObjectHandle& proxyShape);
+    void removeObject(const MObject& proxyShape, bool keepStage);
     bool rebuildIfDirty();
 
     // MayaNodeTypeObserver::Listener
@@ -132,6 +138,11 @@ private:
     StageToObject _stageToObject;
     bool          _dirty { true };
 
+    // Proxy shapes added, renamed or reparented since the last lookup. They
+    // are (re-)entered in the maps under their current path on the next
+    // lookup, rather than rebuilding the maps from all proxy shape names.
+    std::vector<MObjectHandle> _pendingObjects;
+
 }; // UsdStageMap
 
 } // namespace ufe
@@ -17,10 +17,12 @@
 
 #include <mayaUsd/ufe/Utils.h>
 
+#include <usdUfe/ufe/Utils.h>
 #include <usdUfe/undo/UsdUndoBlock.h>
 #include <usdUfe/utils/usdUtils.h>
 
 #include <pxr/base/tf/token.h>
+#include <pxr/usd/sdf/changeBlock.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usd/prim.h>
@@ -85,6 +87,10 @@ void UsdUndoDuplicateSelectionCommand::execute()
 {
     UsdUfe::UsdUndoBlock undoBlock(&_undoableItem);
 
+    // Index the children names of each destination parent once for the whole
+    // selection, rather than once per duplicated item.
+    UsdUfe::UniqueChildNameBatch uniqueNameBatch;
+
     for (auto&& usdItem : _sourceItems) {
         // Need to create and execute. If we create all before executing any, then the collision
         // resolution on names will merge bob1 and bob2 into a single bob3 instead of creating a
@@ -112,7 +118,9 @@ void UsdUndoDuplicateSelectionCommand::execute()
     // We no longer require the source selection:
     _sourceItems.clear();
 
-    // Fixups were grouped by stage.
+    // Fixups were grouped by stage. They only edit properties of the
+    // duplicates, so their notifications can be sent all at once.
+    PXR_NS::SdfChangeBlock changeBlock;
     for (const auto& stageData : _duplicatesMap) {
         PXR_NS::UsdStageWeakPtr stage(getStage(stageData.first));
         if (!stage) {
@@ -175,6 +175,8 @@ void doUsdRename(
     {
         auto fromPath = SdfPath(srcPath.getSegments()[1].string());
         auto destPath = SdfPath(dstPath.getSegments()[1].string());
+
+        UsdUfe::LoadRulesTransaction transaction;
         UsdUfe::duplicateLoadRules(*stage, fromPath, destPath);
         UsdUfe::removeRulesForPath(*stage, fromPath);
     }
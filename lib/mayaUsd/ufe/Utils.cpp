@@ -14,6 +14,7 @@
 // limitations under the License.
 //
 #include <mayaUsd/fileio/jobs/jobArgs.h>
+#include <mayaUsd/listeners/notice.h>
 #include <mayaUsd/nodes/proxyShapeBase.h>
 #include <mayaUsd/ufe/Global.h>
 #include <mayaUsd/ufe/ProxyShapeHandler.h>
@@ -30,9 +31,12 @@
 #include <usdUfe/utils/usdUtils.h>
 
 #include <pxr/base/tf/hashset.h>
+#include <pxr/base/tf/notice.h>
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/tf/weakBase.h>
 #include <pxr/usd/sdf/tokens.h>
 #include <pxr/usd/sdr/shaderProperty.h>
+#include <pxr/usd/usd/notice.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/primCompositionQuery.h>
 #include <pxr/usd/usd/stage.h>
@@ -61,6 +65,7 @@
 #include <cassert>
 #include <cctype>
 #include <memory>
+#include <mutex>
 #include <regex>
 #include <stdexcept>
 #include <string>
@@ -72,6 +77,119 @@ namespace {
 
 constexpr auto kIllegalUFEPath = "Illegal UFE run-time path %s.";
 
+// Cache of the prims resolved by ufePathToPrim(), per stage and keyed by the
+// USD path segment string, so that the segment is not parsed into an SdfPath
+// and looked up on the stage on every call. Entries at or below a resynced
+// path are dropped when their stage sends an ObjectsChanged notice, and the
+// whole cache is dropped when the Maya scene is reset.
+class UfePathToPrimCache : public TfWeakBase
+{
+public:
+    UfePathToPrimCache()
+    {
+        TfWeakPtr<UfePathToPrimCache> me(this);
+        TfNotice::Register(me, &UfePathToPrimCache::onObjectsChanged);
+        TfNotice::Register(me, &UfePathToPrimCache::onSceneReset);
+    }
+
+    UsdPrim getPrim(const UsdStageWeakPtr& stage, const Ufe::PathSegment& usdSegment)
+    {
+        const std::string usdPathString = usdSegment.string();
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto                        stageIt = _stages.find(stage);
+            if (stageIt != _stages.end()) {
+                auto primIt = stageIt->second.find(usdPathString);
+                if (primIt != stageIt->second.end() && primIt->second.prim.IsValid()) {
+                    return primIt->second.prim;
+                }
+            }
+        }
+
+        const SdfPath primPath = SdfPath(usdPathString).GetPrimPath();
+        UsdPrim       prim = stage->GetPrimAtPath(primPath);
+        if (!prim) {
+            // Don't cache misses, the prim may be created at any time.
+            return prim;
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto                        stageIt = _stages.find(stage);
+        if (stageIt == _stages.end()) {
+            // Forget the stages that have been destroyed.
+            for (auto it = _stages.begin(); it != _stages.end();) {
+                it = it->first ? std::next(it) : _stages.erase(it);
+            }
+            stageIt = _stages.emplace(stage, PrimCache()).first;
+        } else if (stageIt->second.size() >= kMaxPrimsPerStage) {
+            stageIt->second.clear();
+        }
+        stageIt->second[usdPathString] = { primPath, prim };
+        return prim;
+    }
+
+private:
+    void onObjectsChanged(const UsdNotice::ObjectsChanged& notice)
+    {
+        const auto resyncedPaths = notice.GetResyncedPaths();
+        if (resyncedPaths.empty()) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto                        stageIt = _stages.find(notice.GetStage());
+        if (stageIt == _stages.end()) {
+            return;
+        }
+
+        // For large change blocks, dropping the stage is cheaper than
+        // matching every cached path against every resynced path.
+        PrimCache& primCache = stageIt->second;
+        if (resyncedPaths.size() > kMaxResyncedPathsToMatch) {
+            primCache.clear();
+            return;
+        }
+
+        for (auto it = primCache.begin(); it != primCache.end();) {
+            bool resynced = false;
+            for (const SdfPath& resyncedPath : resyncedPaths) {
+                if (it->second.path.HasPrefix(resyncedPath)) {
+                    resynced = true;
+                    break;
+                }
+            }
+            it = resynced ? primCache.erase(it) : std::next(it);
+        }
+    }
+
+    void onSceneReset(const UsdMayaSceneResetNotice&)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stages.clear();
+    }
+
+    static constexpr size_t kMaxPrimsPerStage = 1u << 20;
+    static constexpr size_t kMaxResyncedPathsToMatch = 64u;
+
+    struct CachedPrim
+    {
+        SdfPath path;
+        UsdPrim prim;
+    };
+    using PrimCache = std::unordered_map<std::string, CachedPrim>;
+
+    std::mutex                                             _mutex;
+    std::unordered_map<UsdStageWeakPtr, PrimCache, TfHash> _stages;
+};
+
+UfePathToPrimCache& getUfePathToPrimCache()
+{
+    // Note: C++ guarantees correct multi-thread protection for static
+    //       variables initialization in functions.
+    static UfePathToPrimCache cache;
+    return cache;
+}
+
 } // anonymous namespace
 
 namespace MAYAUSD_NS_DEF {
@@ -123,9 +241,8 @@ UsdPrim ufePathToPrim(const Ufe::Path& path)
     // If there is only a single segment in the path, it must point to the
     // proxy shape, otherwise we would not have retrieved a valid stage.
     // The second path segment is the USD path.
-    return (segments.size() == 1u)
-        ? stage->GetPseudoRoot()
-        : stage->GetPrimAtPath(SdfPath(segments[1].string()).GetPrimPath());
+    return (segments.size() == 1u) ? stage->GetPseudoRoot()
+                                   : getUfePathToPrimCache().getPrim(stage, segments[1]);
 }
 
 UsdUfe::UsdSceneItem::Ptr
@@ -141,43 +258,35 @@ std::string uniqueChildNameMayaStandard(const PXR_NS::UsdPrim& usdParent, const
         return std::string();
 
     // See uniqueChildNameDefault() in lib\usdUfe\ufe\Utils.cpp for details.
-    TfToken::HashSet allChildrenNames;
-    for (auto child : usdParent.GetFilteredChildren(
-             UsdTraverseInstanceProxies(UsdPrimIsDefined && !UsdPrimIsAbstract))) {
-        allChildrenNames.insert(child.GetName());
-    }
+    UsdUfe::ChildrenNames        storage;
+    const UsdUfe::ChildrenNames& allChildrenNames = UsdUfe::getChildrenNames(usdParent, storage);
 
     // When setting unique name Maya will look at the numerical suffix of all
     // matching names and set the unique name to +1 on the greatest suffix.
     // Example: with siblings Capsule001 & Capsule006, duplicating Capsule001
     //          will set new unique name to Capsule007.
     std::string childName { name };
-    if (allChildrenNames.find(TfToken(childName)) != allChildrenNames.end()) {
+    if (allChildrenNames.contains(childName)) {
         // Get the base name (removing the numerical suffix) so that we can compare
         // that to all the sibling names.
         std::string baseName, suffix;
         UsdUfe::splitNumericalSuffix(childName, baseName, suffix);
         int suffixValue = !suffix.empty() ? std::stoi(suffix) : 0;
 
-        std::string                 childBaseName;
+        // The children names index the sibling with the greatest numerical
+        // suffix for each base name.
         std::pair<std::string, int> largestMatching(childName, suffixValue);
-        for (const auto& child : allChildrenNames) {
-            // While iterating thru all the children look for ones that match
-            // the base name of the input. When we find one check its numerical
-            // suffix and store the greatest one.
-            UsdUfe::splitNumericalSuffix(child.GetString(), childBaseName, suffix);
-            if (baseName == childBaseName) {
-                int suffixValue = !suffix.empty() ? std::stoi(suffix) : 0;
-                if (suffixValue > largestMatching.second) {
-                    largestMatching = std::make_pair(child.GetString(), suffixValue);
-                }
-            }
+        int                         largestSuffix = 0;
+        const std::string&          largestName
+            = allChildrenNames.largestSuffixName(baseName, largestSuffix);
+        if (!largestName.empty() && largestSuffix > largestMatching.second) {
+            largestMatching = std::make_pair(largestName, largestSuffix);
         }
 
         // By sending in the largest matching name (instead of the input name)
         // the unique name function will increment its numerical suffix by 1
         // and thus it will be unique and follow Maya naming standard.
-        childName = UsdUfe::uniqueName(allChildrenNames, largestMatching.first);
+        childName = UsdUfe::uniqueName(allChildrenNames.names(), largestMatching.first);
     }
     return childName;
 }
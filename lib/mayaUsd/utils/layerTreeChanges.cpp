@@ -0,0 +1,142 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "layerTreeChanges.h"
+
+#include <pxr/usd/sdf/schema.h>
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace {
+
+bool hasDuplicates(const std::vector<std::string>& paths, std::unordered_set<std::string>& unique)
+{
+    unique.reserve(paths.size());
+    for (const std::string& path : paths)
+        if (!unique.insert(path).second)
+            return true;
+    return false;
+}
+
+} // namespace
+
+namespace MAYAUSD_NS_DEF {
+
+unsigned classifyLayerTreeChanges(const PXR_NS::SdfChangeList& changeList)
+{
+    unsigned changes = LayerTreeChange_None;
+
+    for (const auto& pathAndEntry : changeList.GetEntryList()) {
+        // Changes to prims and properties do not affect the tree of layers.
+        if (pathAndEntry.first != PXR_NS::SdfPath::AbsoluteRootPath()) {
+            changes |= LayerTreeChange_Content;
+            continue;
+        }
+
+        const PXR_NS::SdfChangeList::Entry& entry = pathAndEntry.second;
+
+        unsigned layerChanges = LayerTreeChange_None;
+
+        if (entry.flags.didReplaceContent || entry.flags.didReloadContent)
+            layerChanges |= LayerTreeChange_Reload;
+
+        if (entry.flags.didChangeIdentifier)
+            layerChanges |= LayerTreeChange_Identifier;
+
+        // The custom layer data is where the referenced layers of the stage are
+        // kept. Other layer-level changes are considered sublayer changes since
+        // not every way of editing the sublayers is reported as such, and
+        // verifying the sublayers of a single layer is cheap.
+        bool otherLayerChanges = !entry.subLayerChanges.empty();
+        for (const auto& info : entry.infoChanged) {
+            if (info.first == PXR_NS::SdfFieldKeys->CustomLayerData)
+                layerChanges |= LayerTreeChange_CustomLayerData;
+            else
+                otherLayerChanges = true;
+        }
+
+        if (otherLayerChanges || layerChanges == LayerTreeChange_None)
+            layerChanges |= LayerTreeChange_SubLayers;
+
+        changes |= layerChanges;
+    }
+
+    return changes;
+}
+
+bool computeSubLayerEdits(
+    const std::vector<std::string>& oldPaths,
+    const std::vector<std::string>& newPaths,
+    SubLayerEdits&                  edits)
+{
+    edits.clear();
+
+    std::unordered_set<std::string> oldSet;
+    std::unordered_set<std::string> newSet;
+    if (hasDuplicates(oldPaths, oldSet) || hasDuplicates(newPaths, newSet))
+        return false;
+
+    // Remove the paths that are gone, starting from the end so that the
+    // indices of the remaining paths to remove are not affected.
+    std::vector<std::string> paths = oldPaths;
+    for (size_t i = paths.size(); i > 0; --i) {
+        const size_t index = i - 1;
+        if (newSet.count(paths[index]) > 0)
+            continue;
+
+        edits.push_back({ SubLayerEdit::Type::Remove, index, index, paths[index] });
+        paths.erase(paths.begin() + index);
+    }
+
+    // Then fill each position in order, either by moving up a path that was
+    // already there or by inserting a new path. The paths before the current
+    // position are final, so a path that is already there is always found
+    // after the current position.
+    for (size_t index = 0; index < newPaths.size(); ++index) {
+        const std::string& path = newPaths[index];
+        if (index < paths.size() && paths[index] == path)
+            continue;
+
+        if (oldSet.count(path) > 0) {
+            const auto   found = std::find(paths.begin() + index, paths.end(), path);
+            const size_t from = static_cast<size_t>(found - paths.begin());
+            edits.push_back({ SubLayerEdit::Type::Move, from, index, path });
+            paths.erase(found);
+        } else {
+            edits.push_back({ SubLayerEdit::Type::Insert, index, index, path });
+        }
+
+        paths.insert(paths.begin() + index, path);
+    }
+
+    return true;
+}
+
+void applySubLayerEdits(const SubLayerEdits& edits, std::vector<std::string>& paths)
+{
+    for (const SubLayerEdit& edit : edits) {
+        switch (edit.type) {
+        case SubLayerEdit::Type::Remove: paths.erase(paths.begin() + edit.from); break;
+        case SubLayerEdit::Type::Insert: paths.insert(paths.begin() + edit.to, edit.path); break;
+        case SubLayerEdit::Type::Move:
+            paths.erase(paths.begin() + edit.from);
+            paths.insert(paths.begin() + edit.to, edit.path);
+            break;
+        }
+    }
+}
+
+} // namespace MAYAUSD_NS_DEF
@@ -0,0 +1,98 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef MAYAUSD_LAYERTREECHANGES_H
+#define MAYAUSD_LAYERTREECHANGES_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/usd/sdf/changeList.h>
+
+#include <string>
+#include <vector>
+
+// Helpers to update a tree of layers and their sublayers from the layer change
+// notifications instead of rebuilding the tree. They do not depend on the UI so
+// that they can be tested on their own.
+namespace MAYAUSD_NS_DEF {
+
+/*! \brief the kinds of changes made to a layer that affect a tree of layers.
+ */
+enum LayerTreeChange : unsigned
+{
+    // Nothing changed.
+    LayerTreeChange_None = 0u,
+    // Only the prims and properties of the layer changed.
+    LayerTreeChange_Content = (1u << 0),
+    // The sublayers or some other layer-level data changed.
+    LayerTreeChange_SubLayers = (1u << 1),
+    // The layer identifier changed.
+    LayerTreeChange_Identifier = (1u << 2),
+    // The custom layer data changed.
+    LayerTreeChange_CustomLayerData = (1u << 3),
+    // The whole content of the layer was replaced or reloaded.
+    LayerTreeChange_Reload = (1u << 4),
+};
+
+/*! \brief classify the changes made to a layer.
+ * \return a combination of the LayerTreeChange flags.
+ */
+MAYAUSD_CORE_PUBLIC
+unsigned classifyLayerTreeChanges(const PXR_NS::SdfChangeList& changeList);
+
+/*! \brief one edit turning a list of sublayer paths into another.
+ *
+ * The indices refer to the list as modified by the preceding edits. A move
+ * removes the path at the "from" index, then inserts it at the "to" index.
+ */
+struct SubLayerEdit
+{
+    enum class Type
+    {
+        Remove,
+        Insert,
+        Move
+    };
+
+    Type        type;
+    size_t      from;
+    size_t      to;
+    std::string path;
+};
+
+using SubLayerEdits = std::vector<SubLayerEdit>;
+
+/*! \brief compute the edits turning the old sublayer paths into the new ones.
+ *
+ * The paths that are in both lists are moved instead of being removed and
+ * re-inserted, so that what was built for them can be kept.
+ *
+ * \return false if a list contains the same path more than once, in which case
+ *         the edits cannot identify the paths and are not computed.
+ */
+MAYAUSD_CORE_PUBLIC
+bool computeSubLayerEdits(
+    const std::vector<std::string>& oldPaths,
+    const std::vector<std::string>& newPaths,
+    SubLayerEdits&                  edits);
+
+/*! \brief apply the edits to the list of sublayer paths.
+ */
+MAYAUSD_CORE_PUBLIC
+void applySubLayerEdits(const SubLayerEdits& edits, std::vector<std::string>& paths);
+
+} // namespace MAYAUSD_NS_DEF
+
+#endif
@@ -56,6 +56,13 @@ MStatus copyLoadRulesToAttribute(const PXR_NS::UsdStage& stage, MayaUsdProxyShap
 
     auto loadRulesText = UsdUfe::convertLoadRulesToText(stage);
 
+    // The load rules of all stages are saved before every file save, often
+    // unchanged. Avoid dirtying the attribute in that case.
+    MString currentText;
+    if (getDynamicAttribute(depNode, kLoadRulesAttrName, currentText)
+        && loadRulesText == currentText.asChar())
+        return MS::kSuccess;
+
     MStatus status = setDynamicAttribute(depNode, kLoadRulesAttrName, loadRulesText.c_str());
 
     return status;
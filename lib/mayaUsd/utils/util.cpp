@@ -1809,7 +1809,8 @@ VtDictionary UsdMayaUtil::GetDictionaryFromArgDatabase(
     //     are false if omitted, true if present (simple flags).
     // 2 - strings: Just strings!
     // 3 - doubles: A simple double
-    // 4 - vectors (multi-use args): Try to mimic the way they're passed in the
+    // 4 - ints: A simple int
+    // 5 - vectors (multi-use args): Try to mimic the way they're passed in the
     //     Python command API. If single arg per flag, make it a vector of
     //     strings. Multi arg per flag, vector of vector of strings.
     VtDictionary args;
@@ -1836,6 +1837,10 @@ VtDictionary UsdMayaUtil::GetDictionaryFromArgDatabase(
             double val = 0.0;
             argData.getFlagArgument(key.c_str(), 0, val);
             args[key] = val;
+        } else if (guideValue.IsHolding<int>()) {
+            int val = 0;
+            argData.getFlagArgument(key.c_str(), 0, val);
+            args[key] = val;
         } else if (guideValue.IsHolding<std::vector<VtValue>>()) {
             unsigned int count = argData.numberOfFlagUses(entry.first.c_str());
             if (!TF_VERIFY(count > 0)) {
@@ -47,6 +47,13 @@ double extractDouble(
     const PXR_NS::TfToken&      key,
     double                      defaultValue);
 
+/// \brief Extracts an int at \p key from \p userArgs, or defaultValue if it can't extract.
+MAYAUSD_CORE_PUBLIC
+int extractInt(
+    const PXR_NS::VtDictionary& userArgs,
+    const PXR_NS::TfToken&      key,
+    int                         defaultValue);
+
 /// \brief Extracts a string at \p key from \p userArgs, or "" if it can't extract.
 MAYAUSD_CORE_PUBLIC
 std::string extractString(const PXR_NS::VtDictionary& userArgs, const PXR_NS::TfToken& key);
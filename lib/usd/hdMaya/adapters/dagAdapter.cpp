@@ -147,9 +147,24 @@ GfMatrix4d HdMayaDagAdapter::GetTransform()
 
 size_t HdMayaDagAdapter::SampleTransform(size_t maxSampleCount, float* times, GfMatrix4d* samples)
 {
-    return GetDelegate()->SampleValues(maxSampleCount, times, samples, [&]() -> GfMatrix4d {
-        return GetGfMatrixFromMaya(_dagPath.inclusiveMatrix());
-    });
+    return GetDelegate()->SampleValues(
+        GetID(),
+        HdTokens->transform,
+        maxSampleCount,
+        times,
+        samples,
+        [&]() -> GfMatrix4d { return GetGfMatrixFromMaya(_dagPath.inclusiveMatrix()); });
+}
+
+void HdMayaDagAdapter::GetSampleGetters(
+    HdDirtyBits                    dirtyBits,
+    HdMayaDelegate::SampleGetters& sampleGetters)
+{
+    if (dirtyBits & HdChangeTracker::DirtyTransform) {
+        sampleGetters.emplace_back(GetID(), HdTokens->transform, [this]() -> VtValue {
+            return VtValue(GetGfMatrixFromMaya(_dagPath.inclusiveMatrix()));
+        });
+    }
 }
 
 void HdMayaDagAdapter::CreateCallbacks()
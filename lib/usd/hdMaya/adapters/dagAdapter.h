@@ -60,6 +60,11 @@ public:
     GfMatrix4d GetTransform();
     HDMAYA_API
     size_t SampleTransform(size_t maxSampleCount, float* times, GfMatrix4d* samples);
+    /// Adds the values of this adapter to be evaluated by the motion sample prepass, based on
+    /// the \p dirtyBits of its prim.
+    HDMAYA_API
+    virtual void
+    GetSampleGetters(HdDirtyBits dirtyBits, HdMayaDelegate::SampleGetters& sampleGetters);
     HDMAYA_API
     bool            UpdateVisibility();
     bool            IsVisible(bool checkDirty = true);
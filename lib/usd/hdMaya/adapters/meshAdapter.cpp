@@ -30,7 +30,6 @@
 #include <maya/MFloatArray.h>
 #include <maya/MFnMesh.h>
 #include <maya/MIntArray.h>
-#include <maya/MItMeshPolygon.h>
 #include <maya/MNodeMessage.h>
 #include <maya/MObjectHandle.h>
 #include <maya/MPlug.h>
@@ -145,15 +144,36 @@ public:
         if (ARCH_UNLIKELY(!status)) {
             return {};
         }
-        VtArray<GfVec2f> uvs;
-        uvs.reserve(static_cast<size_t>(mesh.numFaceVertices()));
-        for (MItMeshPolygon pit(GetDagPath()); !pit.isDone(); pit.next()) {
-            const auto vertexCount = pit.polygonVertexCount();
-            for (auto i = decltype(vertexCount) { 0 }; i < vertexCount; ++i) {
-                float2 uv = { 0.0f, 0.0f };
-                pit.getUV(i, uv);
-                uvs.push_back(GfVec2f(uv[0], uv[1]));
+
+        MFloatArray us;
+        MFloatArray vs;
+        MIntArray   uvCounts;
+        MIntArray   uvIds;
+        if (!mesh.getUVs(us, vs) || !mesh.getAssignedUVs(uvCounts, uvIds)) {
+            return {};
+        }
+        if (!_UpdateTopologyCache(mesh)
+            || uvCounts.length() != static_cast<unsigned int>(_faceVertexCounts.size())) {
+            return {};
+        }
+
+        // Faces without uvs get (0, 0) on all their face vertices.
+        VtArray<GfVec2f> uvs(_faceVertexIndices.size(), GfVec2f(0.0f, 0.0f));
+        const auto       numUVs = static_cast<int>(us.length());
+        size_t           faceVertex = 0;
+        unsigned int     uvIdIndex = 0;
+        for (unsigned int face = 0; face < uvCounts.length(); ++face) {
+            const int vertexCount = _faceVertexCounts[face];
+            if (uvCounts[face] == vertexCount) {
+                for (int i = 0; i < vertexCount; ++i) {
+                    const int uvId = uvIds[uvIdIndex + i];
+                    if (uvId >= 0 && uvId < numUVs) {
+                        uvs[faceVertex + i] = GfVec2f(us[uvId], vs[uvId]);
+                    }
+                }
             }
+            uvIdIndex += uvCounts[face];
+            faceVertex += vertexCount;
         }
 
         return VtValue(uvs);
@@ -206,7 +226,12 @@ public:
                 return 0;
             }
             return GetDelegate()->SampleValues(
-                maxSampleCount, times, samples, [&]() -> VtValue { return GetPoints(mesh); });
+                GetID(),
+                key,
+                maxSampleCount,
+                times,
+                samples,
+                [&]() -> VtValue { return GetPoints(mesh); });
         } else if (key == HdMayaAdapterTokens->st) {
             times[0] = 0.0f;
             samples[0] = GetUVs();
@@ -215,20 +240,28 @@ public:
         return 0;
     }
 
+    void
+    GetSampleGetters(HdDirtyBits dirtyBits, HdMayaDelegate::SampleGetters& sampleGetters) override
+    {
+        HdMayaShapeAdapter::GetSampleGetters(dirtyBits, sampleGetters);
+        if (dirtyBits & HdChangeTracker::DirtyPoints) {
+            sampleGetters.emplace_back(GetID(), HdTokens->points, [this]() -> VtValue {
+                MStatus status;
+                MFnMesh mesh(GetDagPath(), &status);
+                if (ARCH_UNLIKELY(!status)) {
+                    return {};
+                }
+                return GetPoints(mesh);
+            });
+        }
+    }
+
     HdMeshTopology GetMeshTopology() override
     {
-        MFnMesh    mesh(GetDagPath());
-        const auto numPolygons = mesh.numPolygons();
-        VtIntArray faceVertexCounts;
-        faceVertexCounts.reserve(static_cast<size_t>(numPolygons));
-        VtIntArray faceVertexIndices;
-        faceVertexIndices.reserve(static_cast<size_t>(mesh.numFaceVertices()));
-        for (MItMeshPolygon pit(GetDagPath()); !pit.isDone(); pit.next()) {
-            const auto vc = pit.polygonVertexCount();
-            faceVertexCounts.push_back(vc);
-            for (auto i = decltype(vc) { 0 }; i < vc; ++i) {
-                faceVertexIndices.push_back(pit.vertexIndex(i));
-            }
+        MFnMesh mesh(GetDagPath());
+        if (!_UpdateTopologyCache(mesh)) {
+            _faceVertexCounts.clear();
+            _faceVertexIndices.clear();
         }
 
         // TODO: Maybe we could use the flat shading of the display style?
@@ -237,8 +270,8 @@ public:
                 ? PxOsdOpenSubdivTokens->catmullClark
                 : PxOsdOpenSubdivTokens->none,
             UsdGeomTokens->rightHanded,
-            faceVertexCounts,
-            faceVertexIndices);
+            _faceVertexCounts,
+            _faceVertexIndices);
     }
 
     HdDisplayStyle GetDisplayStyle() override
@@ -359,7 +392,37 @@ public:
 
     bool HasType(const TfToken& typeId) const override { return typeId == HdPrimTypeTokens->mesh; }
 
+    void MarkDirty(HdDirtyBits dirtyBits) override
+    {
+        if (dirtyBits & HdChangeTracker::DirtyTopology) {
+            _topologyCached = false;
+        }
+        HdMayaShapeAdapter::MarkDirty(dirtyBits);
+    }
+
 private:
+    // Reads the face vertex counts and indices of the mesh in bulk. They are
+    // cached until the topology is dirtied, so that points or uv edits don't
+    // read them again.
+    bool _UpdateTopologyCache(const MFnMesh& mesh)
+    {
+        if (_topologyCached) {
+            return true;
+        }
+
+        MIntArray faceVertexCounts;
+        MIntArray faceVertexIndices;
+        if (!mesh.getVertices(faceVertexCounts, faceVertexIndices)) {
+            return false;
+        }
+        _faceVertexCounts.resize(faceVertexCounts.length());
+        faceVertexCounts.get(_faceVertexCounts.data());
+        _faceVertexIndices.resize(faceVertexIndices.length());
+        faceVertexIndices.get(_faceVertexIndices.data());
+        _topologyCached = true;
+        return true;
+    }
+
     static void NodeDirtiedCallback(MObject& node, MPlug& plug, void* clientData)
     {
         auto* adapter = reinterpret_cast<HdMayaMeshAdapter*>(clientData);
@@ -440,6 +503,10 @@ private:
     // To work around this, we register these callbacks specially, and only
     // remove them if the underlying node is currently valid.
     MCallbackIdArray _buggyCallbacks;
+
+    VtIntArray _faceVertexCounts;
+    VtIntArray _faceVertexIndices;
+    bool       _topologyCached = false;
 };
 
 TF_REGISTRY_FUNCTION(TfType)
@@ -40,4 +40,65 @@ GfInterval HdMayaDelegate::GetCurrentTimeSamplingInterval() const
     return GfInterval(_params.motionSampleStart, _params.motionSampleEnd);
 }
 
+void HdMayaDelegate::PrefetchSamples(const SampleGetters& getters)
+{
+    ClearPrefetchedSamples();
+
+    const size_t maxSampleCount = _requestedSampleCount;
+    if (getters.empty() || maxSampleCount <= 1
+        || (!_params.motionSamplesEnabled() && _params.motionSampleStart == 0)) {
+        return;
+    }
+
+    std::vector<_PrefetchedSamples*> prefetched;
+    prefetched.reserve(getters.size());
+    for (const auto& getter : getters) {
+        auto& samples = _prefetchedSamples[std::get<0>(getter)][std::get<1>(getter)];
+        samples.maxSampleCount = maxSampleCount;
+        samples.times.clear();
+        samples.values.clear();
+        prefetched.push_back(&samples);
+    }
+
+    // Same sampling as SampleValues.
+    const GfInterval shutter = GetCurrentTimeSamplingInterval();
+    const double     tStep = shutter.GetSize() / (maxSampleCount - 1);
+    const MTime      mayaTime = MAnimControl::currentTime();
+    double           relTime = shutter.GetMin();
+
+    for (size_t i = 0; i < maxSampleCount; ++i) {
+        {
+            MDGContextGuard guard(mayaTime + relTime);
+            for (size_t j = 0; j < getters.size(); ++j) {
+                VtValue sample = std::get<2>(getters[j])();
+                // Like SampleValues, only keep the samples that differ from the previous one.
+                auto& samples = *prefetched[j];
+                if (samples.values.empty() || sample != samples.values.back()) {
+                    samples.values.push_back(std::move(sample));
+                    samples.times.push_back(relTime);
+                }
+            }
+        }
+        relTime += tStep;
+    }
+}
+
+void HdMayaDelegate::ClearPrefetchedSamples() { _prefetchedSamples.clear(); }
+
+const HdMayaDelegate::_PrefetchedSamples* HdMayaDelegate::_FindPrefetchedSamples(
+    const SdfPath& id,
+    const TfToken& key,
+    size_t         maxSampleCount) const
+{
+    const auto byKey = _prefetchedSamples.find(id);
+    if (byKey == _prefetchedSamples.end()) {
+        return nullptr;
+    }
+    const auto samples = byKey->second.find(key);
+    if (samples == byKey->second.end() || samples->second.maxSampleCount != maxSampleCount) {
+        return nullptr;
+    }
+    return &samples->second;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
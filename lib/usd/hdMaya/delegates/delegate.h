@@ -21,6 +21,8 @@
 
 #include <pxr/base/arch/hints.h>
 #include <pxr/base/gf/interval.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/vt/value.h>
 #include <pxr/imaging/hd/engine.h>
 #include <pxr/imaging/hd/renderIndex.h>
 #include <pxr/imaging/hd/rendererPlugin.h>
@@ -38,7 +40,12 @@
 #include <maya/MSelectionList.h>
 #include <ufe/selection.h>
 
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -132,6 +139,56 @@ public:
     HDMAYA_API
     GfInterval GetCurrentTimeSamplingInterval() const;
 
+    /// A value to be motion sampled by the prepass: the id and key it is sampled for, and a
+    /// function evaluating it in the current DG context.
+    using SampleGetter = std::tuple<SdfPath, TfToken, std::function<VtValue()>>;
+    using SampleGetters = std::vector<SampleGetter>;
+
+    /// Motion sample prepass. Evaluates every getter at each shutter time, switching the DG
+    /// context once per shutter time rather than once per value and shutter time. The samples
+    /// are then returned by SampleValues for the matching id and key, until
+    /// ClearPrefetchedSamples is called. The number of samples is the largest one requested
+    /// through SampleValues so far, as Hydra only tells it while syncing.
+    HDMAYA_API
+    void PrefetchSamples(const SampleGetters& getters);
+
+    /// Drops the samples evaluated by PrefetchSamples.
+    HDMAYA_API
+    void ClearPrefetchedSamples();
+
+    /// Returns the largest number of samples requested through SampleValues so far.
+    size_t GetRequestedSampleCount() const { return _requestedSampleCount; }
+
+    /// Same as below, but returns the samples evaluated by PrefetchSamples for \p id and
+    /// \p key, if any, instead of evaluating \p getValue.
+    template <typename T, typename Getter>
+    size_t SampleValues(
+        const SdfPath& id,
+        const TfToken& key,
+        size_t         maxSampleCount,
+        float*         times,
+        T*             samples,
+        Getter         getValue)
+    {
+        // Rprims sync in parallel, keep the largest of the concurrently requested counts.
+        size_t requestedSampleCount = _requestedSampleCount;
+        while (maxSampleCount > requestedSampleCount) {
+            if (_requestedSampleCount.compare_exchange_weak(requestedSampleCount, maxSampleCount)) {
+                break;
+            }
+        }
+        const auto* prefetched = _FindPrefetchedSamples(id, key, maxSampleCount);
+        if (prefetched == nullptr) {
+            return SampleValues(maxSampleCount, times, samples, getValue);
+        }
+        const size_t nSamples = prefetched->times.size();
+        for (size_t i = 0; i < nSamples; ++i) {
+            times[i] = prefetched->times[i];
+            _GetSample(prefetched->values[i], samples[i]);
+        }
+        return nSamples;
+    }
+
     /// Common function to return templated sample types
     template <typename T, typename Getter>
     size_t SampleValues(size_t maxSampleCount, float* times, T* samples, Getter getValue)
@@ -175,8 +232,30 @@ public:
     }
 
 private:
+    struct _PrefetchedSamples
+    {
+        size_t               maxSampleCount = 0;
+        std::vector<float>   times;
+        std::vector<VtValue> values;
+    };
+
+    HDMAYA_API
+    const _PrefetchedSamples*
+    _FindPrefetchedSamples(const SdfPath& id, const TfToken& key, size_t maxSampleCount) const;
+
+    static void _GetSample(const VtValue& value, VtValue& sample) { sample = value; }
+    template <typename T> static void _GetSample(const VtValue& value, T& sample)
+    {
+        sample = value.UncheckedGet<T>();
+    }
+
     HdMayaParams _params;
 
+    using _PrefetchedSamplesByKey
+        = std::unordered_map<TfToken, _PrefetchedSamples, TfToken::HashFunctor>;
+    std::unordered_map<SdfPath, _PrefetchedSamplesByKey, SdfPath::Hash> _prefetchedSamples;
+    std::atomic<size_t>                                                 _requestedSampleCount { 0 };
+
     // Note that because there may not be a 1-to-1 relationship between
     // a HdMayaDelegate and a HdSceneDelegate, this may be different than
     // "the" scene delegate id.  In the case of HdMayaSceneDelegate,
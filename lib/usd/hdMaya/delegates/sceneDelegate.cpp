@@ -332,6 +332,19 @@ void HdMayaSceneDelegate::PreFrame(const MHWRender::MDrawContext& context)
         }
         _adaptersToRebuild.clear();
     }
+    // Evaluate the motion samples of all the dirty shapes up front, one DG context per shutter
+    // time, instead of one per shape and shutter time when Hydra samples them.
+    if (GetParams().motionSamplesEnabled()) {
+        auto&                         changeTracker = GetRenderIndex().GetChangeTracker();
+        HdMayaDelegate::SampleGetters sampleGetters;
+        for (const auto& shape : _shapeAdapters) {
+            const HdDirtyBits dirtyBits = changeTracker.GetRprimDirtyBits(shape.first);
+            if (dirtyBits != HdChangeTracker::Clean) {
+                shape.second->GetSampleGetters(dirtyBits, sampleGetters);
+            }
+        }
+        PrefetchSamples(sampleGetters);
+    }
     if (!IsHdSt()) {
         return;
     }
@@ -369,6 +382,8 @@ void HdMayaSceneDelegate::PreFrame(const MHWRender::MDrawContext& context)
     }
 }
 
+void HdMayaSceneDelegate::PostFrame() { ClearPrefetchedSamples(); }
+
 void HdMayaSceneDelegate::RemoveAdapter(const SdfPath& id)
 {
     if (!_RemoveAdapter<HdMayaAdapter>(
@@ -65,6 +65,9 @@ public:
     HDMAYA_API
     void PreFrame(const MHWRender::MDrawContext& context) override;
 
+    HDMAYA_API
+    void PostFrame() override;
+
     HDMAYA_API
     void RemoveAdapter(const SdfPath& id) override;
 
@@ -426,6 +426,14 @@ void PxrUsdTranslators_InstancerWriter::PostExport()
 /* virtual */
 bool PxrUsdTranslators_InstancerWriter::ShouldPruneChildren() const { return true; }
 
+/* virtual */
+bool PxrUsdTranslators_InstancerWriter::IsAnimated() const
+{
+    // Instance transforms and prototype indices are computed by the instancer
+    // at each time sample.
+    return true;
+}
+
 /* virtual */
 const SdfPathVector& PxrUsdTranslators_InstancerWriter::GetModelPaths() const
 {
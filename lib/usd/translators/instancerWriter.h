@@ -58,6 +58,7 @@ public:
     void                 Write(const UsdTimeCode& usdTime) override;
     void                 PostExport() override;
     bool                 ShouldPruneChildren() const override;
+    bool                 IsAnimated() const override;
     const SdfPathVector& GetModelPaths() const override;
 
 protected:
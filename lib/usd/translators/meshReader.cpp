@@ -30,6 +30,8 @@
 
 #include <maya/MFnBlendShapeDeformer.h>
 
+#include <memory>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 namespace {
@@ -58,6 +60,14 @@ public:
     ~MayaUsdPrimReaderMesh() override { }
 
     bool Read(UsdMayaPrimReaderContext& context) override;
+
+    bool HasPrefetch() const override { return true; }
+    void Prefetch() override;
+
+    bool MayPruneChildren() const override { return false; }
+
+private:
+    std::unique_ptr<MayaUsd::TranslatorMeshRead::UsdData> _prefetchedData;
 };
 
 TF_REGISTRY_FUNCTION_WITH_TAG(UsdMayaPrimReaderRegistry, UsdGeomMesh)
@@ -67,6 +77,18 @@ TF_REGISTRY_FUNCTION_WITH_TAG(UsdMayaPrimReaderRegistry, UsdGeomMesh)
     });
 }
 
+void MayaUsdPrimReaderMesh::Prefetch()
+{
+    const auto mesh = UsdGeomMesh(_GetArgs().GetUsdPrim());
+    if (!mesh) {
+        return;
+    }
+
+    _prefetchedData.reset(new MayaUsd::TranslatorMeshRead::UsdData);
+    MayaUsd::TranslatorMeshRead::ReadUsdData(
+        mesh, _GetArgs().GetTimeInterval(), _prefetchedData.get());
+}
+
 bool MayaUsdPrimReaderMesh::Read(UsdMayaPrimReaderContext& context)
 {
     MStatus status { MS::kSuccess };
@@ -107,7 +129,9 @@ bool MayaUsdPrimReaderMesh::Read(UsdMayaPrimReaderContext& context)
         _GetArgs().GetTimeInterval(),
         _GetArgs().GetUseAsAnimationCache(),
         &context,
-        &status);
+        &status,
+        _prefetchedData.get());
+    _prefetchedData.reset();
     CHECK_MSTATUS_AND_RETURN(status, false);
 
     // mesh is a shape, so read Gprim properties
@@ -382,7 +382,10 @@ bool PxrUsdTranslators_MeshWriter::writeMeshAttrs(
                 GetDagPath(),
                 skelPath,
                 exportArgs.stripNamespaces,
-                _GetSparseValueWriter());
+                _GetSparseValueWriter(),
+                exportArgs.skinWeightEpsilon,
+                exportArgs.maxSkinInfluences,
+                exportArgs.verbose);
 
             if (!_skelInputMesh.isNull()) {
                 // Add all skel primvars to the exclude set.
@@ -834,6 +837,13 @@ bool PxrUsdTranslators_MeshWriter::writeMeshAttrs(
 
 bool PxrUsdTranslators_MeshWriter::ExportsGprims() const { return true; }
 
+bool PxrUsdTranslators_MeshWriter::IsAnimated() const
+{
+    // _HasAnimCurves() covers the deformers, including skin clusters and blend
+    // shapes whose extents and weights are written at each time sample.
+    return _HasAnimCurves() || _IsVisibilityAnimated();
+}
+
 bool PxrUsdTranslators_MeshWriter::isMeshAnimated() const
 {
     // Note that _HasAnimCurves() as computed by UsdMayaTransformWriter is
@@ -56,6 +56,7 @@ public:
 
     void Write(const UsdTimeCode& usdTime) override;
     bool ExportsGprims() const override;
+    bool IsAnimated() const override;
     void PostExport() override;
 
 private:
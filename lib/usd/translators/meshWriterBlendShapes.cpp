@@ -24,6 +24,7 @@
 #include <pxr/base/tf/diagnostic.h>
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/vt/types.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usdGeom/pointBased.h>
 #include <pxr/usd/usdSkel/bindingAPI.h>
@@ -71,6 +72,8 @@ struct MayaBlendShapeTargetDatum
                                 // inherently support blendshape normal offsets.)
     VtIntArray indices; // The indices of the components that are offset. This will be the equal to
                         // the size of `ptOffsets` and `normalOffsets`.
+    bool fullyPruned = false; // Whether all the components were pruned because their offsets were
+                              // below the tolerance. Such targets do not move any point.
 };
 
 /// The information about the set of targets associated with a given `weightIndex` (i.e. one of the
@@ -116,67 +119,164 @@ float mayaGetBlendShapeTargetWeightFromIndex(const unsigned int index)
     return targetWeight;
 }
 
-MStatus mayaFindPtAndNormalOffsetsBetweenMeshes(
-    const MObject&    a,
-    const MObject&    b,
+void mayaFindPtAndNormalOffsets(
+    const GfVec3f*    ptsA,
+    const GfVec3f*    nrmsA,
+    const GfVec3f*    ptsB,
+    const GfVec3f*    nrmsB,
     VtVec3fArray&     ptOffsets,
     VtVec3fArray&     nrmOffsets,
     const VtIntArray& indices)
 {
-    MStatus status;
-    TF_VERIFY(MObjectHandle(a).isAlive() && MObjectHandle(b).isAlive());
-    if (!a.hasFn(MFn::kMesh) || !b.hasFn(MFn::kMesh)) {
-        return MStatus::kInvalidParameter;
-    }
-
-    size_t numIndices = indices.size();
-    if (numIndices == 0) {
-        return MStatus::kInvalidParameter;
-    }
-
+    const size_t numIndices = indices.size();
     ptOffsets.resize(numIndices);
     nrmOffsets.resize(numIndices);
 
-    MFnMesh fnMesh(a, &status);
-    CHECK_MSTATUS_AND_RETURN_IT(status);
+    // NOTE: Work on raw pointers so that the loop does not go through the copy-on-write checks of
+    // `VtArray` for every element, which also lets the compiler vectorize it.
+    const int* pIndices = indices.cdata();
+    GfVec3f*   pPtOffsets = ptOffsets.data();
+    GfVec3f*   pNrmOffsets = nrmOffsets.data();
+    for (size_t i = 0; i < numIndices; ++i) {
+        const int componentIdx = pIndices[i];
+        pPtOffsets[i] = ptsB[componentIdx] - ptsA[componentIdx];
+        pNrmOffsets[i] = nrmsB[componentIdx] - nrmsA[componentIdx];
+    }
+}
 
-    const float* nrmsA = fnMesh.getRawNormals(&status);
-    CHECK_MSTATUS_AND_RETURN_IT(status);
+/// Removes the components of \p target whose point and normal offsets are both at or below
+/// \p tolerance, so that the exported `pointIndices` only hold the components that the target
+/// actually moves.
+void mayaPruneBlendShapeTargetOffsets(MayaBlendShapeTargetDatum& target, const float tolerance)
+{
+    const size_t numIndices = target.indices.size();
+    if (target.ptOffsets.size() != numIndices || target.normalOffsets.size() != numIndices) {
+        return;
+    }
 
-    const GfVec3f* pVtNrmsA = reinterpret_cast<const GfVec3f*>(nrmsA);
+    const float toleranceSq = tolerance * tolerance;
 
-    // TODO: (yliangsiew) Need to account for float/double meshes.
-    const float* ptsA = fnMesh.getRawPoints(&status);
-    CHECK_MSTATUS_AND_RETURN_IT(status);
+    int*     pIndices = target.indices.data();
+    GfVec3f* pPtOffsets = target.ptOffsets.data();
+    GfVec3f* pNrmOffsets = target.normalOffsets.data();
+    size_t   numKept = 0;
+    for (size_t i = 0; i < numIndices; ++i) {
+        if (pPtOffsets[i].GetLengthSq() <= toleranceSq
+            && pNrmOffsets[i].GetLengthSq() <= toleranceSq) {
+            continue;
+        }
+        pIndices[numKept] = pIndices[i];
+        pPtOffsets[numKept] = pPtOffsets[i];
+        pNrmOffsets[numKept] = pNrmOffsets[i];
+        ++numKept;
+    }
 
-    const GfVec3f* pVtPtsA = reinterpret_cast<const GfVec3f*>(ptsA);
+    if (numKept != numIndices) {
+        target.fullyPruned = (numKept == 0);
+        target.indices.resize(numKept);
+        target.ptOffsets.resize(numKept);
+        target.normalOffsets.resize(numKept);
+    }
+}
 
-    status = fnMesh.setObject(b);
-    CHECK_MSTATUS_AND_RETURN_IT(status);
+/**
+ * Computes the point and normal offsets of all the targets of a blendshape deformer that are
+ * driven by a target mesh.
+ *
+ * The meshes are queried on the calling thread first, since reading their points may trigger a
+ * DG evaluation. The offsets of all the targets are then computed and pruned in parallel.
+ *
+ * @param baseMesh      The original base mesh shape the offsets are relative to.
+ *
+ * @param info          The blendshape deformer information whose targets will be filled in.
+ *
+ * @param tolerance     The offset length at or below which the components are pruned.
+ *
+ * @return              A status code.
+ */
+MStatus mayaComputeBlendShapeTargetOffsets(
+    const MObject&       baseMesh,
+    MayaBlendShapeDatum& info,
+    const float          tolerance)
+{
+    MStatus stat;
+    TF_VERIFY(MObjectHandle(baseMesh).isAlive());
+    if (!baseMesh.hasFn(MFn::kMesh)) {
+        return MStatus::kInvalidParameter;
+    }
 
-    const float* nrmsB = fnMesh.getRawNormals(&status);
-    CHECK_MSTATUS_AND_RETURN_IT(status);
+    MFnMesh fnMesh(baseMesh, &stat);
+    CHECK_MSTATUS_AND_RETURN_IT(stat);
 
-    const GfVec3f* pVtNrmsB = reinterpret_cast<const GfVec3f*>(nrmsB);
+    const int numVertices = fnMesh.numVertices();
 
     // TODO: (yliangsiew) Need to account for float/double meshes.
-    const float* ptsB = fnMesh.getRawPoints(&status);
-    CHECK_MSTATUS_AND_RETURN_IT(status);
+    const GfVec3f* pBasePts = reinterpret_cast<const GfVec3f*>(fnMesh.getRawPoints(&stat));
+    CHECK_MSTATUS_AND_RETURN_IT(stat);
+    const GfVec3f* pBaseNrms = reinterpret_cast<const GfVec3f*>(fnMesh.getRawNormals(&stat));
+    CHECK_MSTATUS_AND_RETURN_IT(stat);
+
+    struct PendingTarget
+    {
+        MayaBlendShapeTargetDatum* target;
+        const GfVec3f*             pts;
+        const GfVec3f*             nrms;
+    };
+    std::vector<PendingTarget> pendingTargets;
+
+    for (MayaBlendShapeWeightDatum& weightInfo : info.weightDatas) {
+        for (MayaBlendShapeTargetDatum& target : weightInfo.targets) {
+            if (target.targetMesh.isNull() || target.indices.empty()) {
+                continue;
+            }
 
-    const GfVec3f* pVtPtsB = reinterpret_cast<const GfVec3f*>(ptsB);
+            TF_VERIFY(MObjectHandle(target.targetMesh).isAlive());
+            if (!target.targetMesh.hasFn(MFn::kMesh)) {
+                continue;
+            }
 
-    for (unsigned int i = 0; i < numIndices; ++i) {
-        const int     componentIdx = indices[i];
-        const GfVec3f ptA = pVtPtsA[componentIdx];
-        const GfVec3f ptB = pVtPtsB[componentIdx];
-        ptOffsets[i] = ptB - ptA;
+            stat = fnMesh.setObject(target.targetMesh);
+            CHECK_MSTATUS_AND_RETURN_IT(stat);
+            if (fnMesh.numVertices() != numVertices) {
+                TF_RUNTIME_ERROR(
+                    "Blendshape target %s does not have the same number of vertices as its base "
+                    "mesh; its offsets cannot be determined.",
+                    fnMesh.fullPathName().asChar());
+                // NOTE: Treat the target as not moving any point, so that no point indices get
+                // written without their offsets.
+                target.indices.clear();
+                target.ptOffsets.clear();
+                target.normalOffsets.clear();
+                target.fullyPruned = true;
+                continue;
+            }
 
-        const GfVec3f nrmA = pVtNrmsA[componentIdx];
-        const GfVec3f nrmB = pVtNrmsB[componentIdx];
-        nrmOffsets[i] = nrmB - nrmA;
+            PendingTarget pending;
+            pending.target = &target;
+            pending.pts = reinterpret_cast<const GfVec3f*>(fnMesh.getRawPoints(&stat));
+            CHECK_MSTATUS_AND_RETURN_IT(stat);
+            pending.nrms = reinterpret_cast<const GfVec3f*>(fnMesh.getRawNormals(&stat));
+            CHECK_MSTATUS_AND_RETURN_IT(stat);
+            pendingTargets.push_back(pending);
+        }
     }
 
-    return status;
+    WorkParallelForN(pendingTargets.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const PendingTarget& pending = pendingTargets[i];
+            mayaFindPtAndNormalOffsets(
+                pBasePts,
+                pBaseNrms,
+                pending.pts,
+                pending.nrms,
+                pending.target->ptOffsets,
+                pending.target->normalOffsets,
+                pending.target->indices);
+            mayaPruneBlendShapeTargetOffsets(*pending.target, tolerance);
+        }
+    });
+
+    return stat;
 }
 
 #if MAYA_BLENDSHAPE_EVAL_HOTFIX
@@ -259,12 +359,16 @@ MStatus mayaBlendShapeTriggerAllTargets(MObject& blendShape)
  *                               and retrieve them. If not, empty targets will be skipped in the
  *                               final result.
  *
+ * @param offsetTolerance        The offset length at or below which the components of the
+ *                               targets are pruned.
+ *
  * @return                       A status code.
  */
 MStatus mayaGetBlendShapeInfosForMesh(
     const MObject&                    deformedMesh,
     std::vector<MayaBlendShapeDatum>& outInfos,
-    const bool                        getEmptyBlendShapes)
+    const bool                        getEmptyBlendShapes,
+    const float                       offsetTolerance)
 {
     // TODO: (yliangsiew) Eh, find a way to avoid incremental allocations like these and just
     // allocate upfront. But hard to do with the iterative search functions of the DG...
@@ -450,13 +554,10 @@ MStatus mayaGetBlendShapeInfosForMesh(
                     MObject meshInGeomTgt = plgInGeomTgtSrc.node();
                     TF_VERIFY(meshInGeomTgt.hasFn(MFn::kMesh));
 
+                    // NOTE: The offsets are computed for all the targets of the deformer at
+                    // once, after they have all been found. See
+                    // `mayaComputeBlendShapeTargetOffsets`.
                     meshTargetDatum.targetMesh = meshInGeomTgt;
-                    mayaFindPtAndNormalOffsetsBetweenMeshes(
-                        inputGeo,
-                        meshInGeomTgt,
-                        meshTargetDatum.ptOffsets,
-                        meshTargetDatum.normalOffsets,
-                        meshTargetDatum.indices);
                 } else {
                     // NOTE: (yliangsiew) If there is no geometry target, then we have to assume
                     // the target has already been "baked" into the blendshape deformer. In this
@@ -476,6 +577,7 @@ MStatus mayaGetBlendShapeInfosForMesh(
                         MPoint pt = ptDeltas[m];
                         meshTargetDatum.ptOffsets.push_back(GfVec3f(pt.x, pt.y, pt.z));
                     }
+                    mayaPruneBlendShapeTargetOffsets(meshTargetDatum, offsetTolerance);
                 }
                 weightInfo.targets.push_back(meshTargetDatum);
             }
@@ -492,6 +594,10 @@ MStatus mayaGetBlendShapeInfosForMesh(
 
             info.weightDatas.push_back(weightInfo);
         }
+
+        stat = mayaComputeBlendShapeTargetOffsets(inputGeo, info, offsetTolerance);
+        CHECK_MSTATUS_AND_RETURN_IT(stat);
+
         outInfos.push_back(info);
     }
     return stat;
@@ -602,10 +708,14 @@ MObject PxrUsdTranslators_MeshWriter::writeBlendShapeData(UsdGeomMesh& primSchem
     // TODO: (yliangsiew) Figure out if this can be isolated. It's kind of hard
     // because we want to avoid repeated walks through the DG.
     std::vector<MayaBlendShapeDatum> blendShapeDeformerInfos;
+
+    const float offsetTolerance = static_cast<float>(exportArgs.blendShapeOffsetTolerance);
     if (exportArgs.ignoreWarnings) {
-        stat = mayaGetBlendShapeInfosForMesh(deformedMesh, blendShapeDeformerInfos, true);
+        stat = mayaGetBlendShapeInfosForMesh(
+            deformedMesh, blendShapeDeformerInfos, true, offsetTolerance);
     } else {
-        stat = mayaGetBlendShapeInfosForMesh(deformedMesh, blendShapeDeformerInfos, false);
+        stat = mayaGetBlendShapeInfosForMesh(
+            deformedMesh, blendShapeDeformerInfos, false, offsetTolerance);
     }
     if (stat != MStatus::kSuccess) {
         TF_WARN(
@@ -661,9 +771,12 @@ MObject PxrUsdTranslators_MeshWriter::writeBlendShapeData(UsdGeomMesh& primSchem
                 size_t numOfTargets = weightInfo.targets.size();
                 for (size_t k = 0; k < numOfTargets; ++k) {
                     MayaBlendShapeTargetDatum targetDatum = weightInfo.targets[k];
-                    MObject                   targetMesh = targetDatum.targetMesh;
-                    MString                   curTargetNameMStr;
-                    MString                   curTargetLongNameMStr;
+                    if (targetDatum.fullyPruned) {
+                        continue;
+                    }
+                    MObject targetMesh = targetDatum.targetMesh;
+                    MString curTargetNameMStr;
+                    MString curTargetLongNameMStr;
                     if (!targetMesh.isNull()) {
                         MFnDagNode dagNode(targetMesh);
                         MString    nodeName;
@@ -792,6 +905,17 @@ MObject PxrUsdTranslators_MeshWriter::writeBlendShapeData(UsdGeomMesh& primSchem
                     }
                 }
 
+                // The in-betweens share the point indices of their blendshape, so it is only
+                // skipped when none of its targets move any point.
+                if (std::all_of(
+                        weightInfo.targets.begin(),
+                        weightInfo.targets.end(),
+                        [](const MayaBlendShapeTargetDatum& target) {
+                            return target.fullyPruned;
+                        })) {
+                    break;
+                }
+
                 // NOTE: (yliangsiew) Because of just how USD works; need to create
                 // the base shape first before we create the inbetween shapes.
                 // For this, we will use the name of the plug at the corresponding weight index.
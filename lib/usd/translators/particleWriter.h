@@ -44,6 +44,7 @@ public:
         UsdMayaWriteJobContext&  jobCtx);
 
     void Write(const UsdTimeCode& usdTime) override;
+    bool IsAnimated() const override { return true; }
 
 private:
     void writeParams(const UsdTimeCode& usdTime, UsdGeomPoints& points);
@@ -18,20 +18,44 @@
 
 #include <pxr/pxr.h>
 #include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usdGeom/xform.h>
 
 #include <maya/MObject.h>
 
+#include <memory>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
-PXRUSDMAYA_DEFINE_READER(UsdGeomXform, args, context)
+// prim reader for xform
+class MayaUsdPrimReaderXform final : public UsdMayaPrimReader
+{
+public:
+    MayaUsdPrimReaderXform(const UsdMayaPrimReaderArgs& args)
+        : UsdMayaPrimReader(args)
+    {
+    }
+
+    bool Read(UsdMayaPrimReaderContext& context) override;
+
+    bool MayPruneChildren() const override { return false; }
+};
+
+TF_REGISTRY_FUNCTION_WITH_TAG(UsdMayaPrimReaderRegistry, UsdGeomXform)
+{
+    UsdMayaPrimReaderRegistry::Register<UsdGeomXform>([](const UsdMayaPrimReaderArgs& args) {
+        return std::make_shared<MayaUsdPrimReaderXform>(args);
+    });
+}
+
+bool MayaUsdPrimReaderXform::Read(UsdMayaPrimReaderContext& context)
 {
-    const UsdPrim& usdPrim = args.GetUsdPrim();
+    const UsdPrim& usdPrim = _GetArgs().GetUsdPrim();
     MObject        parentNode = context.GetMayaNode(usdPrim.GetPath().GetParentPath(), true);
 
     MStatus status;
     MObject mayaNode;
     return UsdMayaTranslatorUtil::CreateTransformNode(
-        usdPrim, parentNode, args, &context, &status, &mayaNode);
+        usdPrim, parentNode, _GetArgs(), &context, &status, &mayaNode);
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
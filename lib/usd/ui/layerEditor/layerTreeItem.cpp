@@ -11,6 +11,7 @@
 
 #include <mayaUsd/base/tokens.h>
 #include <mayaUsd/utils/layerLocking.h>
+#include <mayaUsd/utils/layerTreeChanges.h>
 #include <mayaUsd/utils/utilFileSystem.h>
 #include <mayaUsd/utils/utilSerialization.h>
 
@@ -156,6 +157,89 @@ void LayerTreeItem::populateChildren(RecursionDetector* recursionDetector)
     recursionDetector->pop();
 }
 
+bool LayerTreeItem::updateSubLayers()
+{
+    if (isInvalidLayer())
+        return false;
+
+    // Detect recursion through the ancestors, as populateChildren() does when
+    // the whole hierarchy is built.
+    std::vector<const LayerTreeItem*> ancestors;
+    for (auto item = parentLayerItem(); item != nullptr; item = item->parentLayerItem())
+        ancestors.push_back(item);
+
+    RecursionDetector recursionDetector;
+    for (auto ancestor = ancestors.crbegin(); ancestor != ancestors.crend(); ++ancestor) {
+        if (!(*ancestor)->isInvalidLayer())
+            recursionDetector.push((*ancestor)->_layer->GetRealPath());
+    }
+
+    std::vector<std::string> oldPaths;
+    oldPaths.reserve(rowCount());
+    for (auto child : childrenVector())
+        oldPaths.push_back(child->subLayerPath());
+
+    recursionDetector.push(_layer->GetRealPath());
+
+    std::vector<std::string>              newPaths;
+    std::map<std::string, SdfLayerRefPtr> newLayers;
+    for (auto const& path : _layer->GetSubLayerPaths()) {
+        std::string actualPath = SdfComputeAssetPathRelativeToLayer(_layer, path);
+        auto        subLayer = SdfLayer::FindOrOpen(actualPath);
+        if (!subLayer || !recursionDetector.contains(subLayer->GetRealPath())) {
+            newPaths.push_back(path);
+            newLayers[path] = subLayer;
+        }
+    }
+
+    MayaUsd::SubLayerEdits edits;
+    if (!MayaUsd::computeSubLayerEdits(oldPaths, newPaths, edits)) {
+        recursionDetector.pop();
+        populateChildren(&recursionDetector);
+        return true;
+    }
+
+    auto createItem = [&](const std::string& path) {
+        return new LayerTreeItem(
+            newLayers[path],
+            LayerType::SubLayer,
+            path,
+            &_incomingLayers,
+            _isSharedStage,
+            &_sharedLayers,
+            &recursionDetector);
+    };
+
+    for (const auto& edit : edits) {
+        const int from = static_cast<int>(edit.from);
+        const int to = static_cast<int>(edit.to);
+        switch (edit.type) {
+        case MayaUsd::SubLayerEdit::Type::Remove: removeRow(from); break;
+        case MayaUsd::SubLayerEdit::Type::Insert: insertRow(to, createItem(edit.path)); break;
+        case MayaUsd::SubLayerEdit::Type::Move: insertRow(to, takeRow(from)); break;
+        }
+    }
+
+    // The same path may now resolve to another layer, for example a sublayer
+    // that was missing and now exists, or a relative path once the parent has
+    // been saved elsewhere, so the kept children of another layer are re-created.
+    bool replacedChildren = false;
+    for (int row = 0; row < rowCount(); ++row) {
+        auto item = dynamic_cast<LayerTreeItem*>(child(row, 0));
+        if (!item || item->layer() == newLayers[item->subLayerPath()])
+            continue;
+
+        const std::string path = item->subLayerPath();
+        removeRow(row);
+        insertRow(row, createItem(path));
+        replacedChildren = true;
+    }
+
+    recursionDetector.pop();
+
+    return !edits.empty() || replacedChildren;
+}
+
 LayerItemVector LayerTreeItem::childrenVector() const
 {
     LayerItemVector result;
@@ -106,6 +106,9 @@ public:
 
     // refresh our data from the USD Layer
     void fetchData(RebuildChildren in_rebuild, RecursionDetector* in_recursionDetector = nullptr);
+    // update the children to match the sublayers of the USD layer, keeping the
+    // items of the sublayers that are still there. Returns true if the children changed.
+    bool updateSubLayers();
 
     enum Roles
     {
@@ -24,6 +24,7 @@
 
 #include <mayaUsd/base/tokens.h>
 #include <mayaUsd/utils/customLayerData.h>
+#include <mayaUsd/utils/layerTreeChanges.h>
 #include <mayaUsd/utils/layers.h>
 #include <mayaUsd/utils/utilSerialization.h>
 
@@ -299,8 +300,14 @@ void LayerTreeModel::rebuildModel(bool refreshLockState /*= false*/)
     _rebuildOnIdlePending = false;
     _lastAskedAnonLayerNameSinceRebuild = 0;
 
+    // The rebuild takes care of all the pending layer changes.
+    _pendingLayerChanges.clear();
+    _sharedLayers.clear();
+    _incomingLayers.clear();
+
     beginResetModel();
     clear();
+    invalidateLayerItems();
 
     if (_sessionState->isValid()) {
         auto rootLayer = _sessionState->stage()->GetRootLayer();
@@ -311,26 +318,24 @@ void LayerTreeModel::rebuildModel(bool refreshLockState /*= false*/)
                 = sessionLayer->IsDirty() || sessionLayer == _sessionState->targetLayer();
         }
 
-        std::set<std::string> sharedLayers;
-        auto                  sharedStage = _sessionState->commandHook()->isProxyShapeSharedStage(
+        auto sharedStage = _sessionState->commandHook()->isProxyShapeSharedStage(
             _sessionState->stageEntry()._proxyShapePath);
         if (!sharedStage) {
             auto layers = MayaUsd::CustomLayerData::getStringArray(
                 rootLayer, MayaUsdMetadata->ReferencedLayers);
             std::vector<std::string> layerIds;
             std::move(layers.begin(), layers.end(), inserter(layerIds, layerIds.begin()));
-            sharedLayers = MayaUsd::getAllSublayers(layerIds, true);
+            _sharedLayers = MayaUsd::getAllSublayers(layerIds, true);
         }
 
-        std::set<std::string> incomingLayers;
         if (_sessionState->commandHook()->isProxyShapeStageIncoming(
                 _sessionState->stageEntry()._proxyShapePath)) {
             if (!sharedStage) {
-                incomingLayers = sharedLayers;
+                _incomingLayers = _sharedLayers;
             } else {
                 std::vector<std::string> layerIds;
                 layerIds.push_back(rootLayer->GetIdentifier());
-                incomingLayers = MayaUsd::getAllSublayers(layerIds, true);
+                _incomingLayers = MayaUsd::getAllSublayers(layerIds, true);
             }
         }
 
@@ -339,13 +344,13 @@ void LayerTreeModel::rebuildModel(bool refreshLockState /*= false*/)
                 sessionLayer,
                 LayerType::SessionLayer,
                 "",
-                &incomingLayers,
+                &_incomingLayers,
                 sharedStage,
-                &sharedLayers));
+                &_sharedLayers));
         }
 
         appendRow(new LayerTreeItem(
-            rootLayer, LayerType::RootLayer, "", &incomingLayers, sharedStage, &sharedLayers));
+            rootLayer, LayerType::RootLayer, "", &_incomingLayers, sharedStage, &_sharedLayers));
 
         updateTargetLayer(InRebuildModel::Yes);
 
@@ -360,12 +365,36 @@ void LayerTreeModel::rebuildModel(bool refreshLockState /*= false*/)
 
 LayerTreeItem* LayerTreeModel::findUSDLayerItem(const SdfLayerRefPtr& usdLayer) const
 {
-    const auto allItems = getAllItems();
-    for (auto item : allItems) {
-        if (item->layer() == usdLayer)
-            return item;
+    const LayerItemVector& items = findUSDLayerItems(usdLayer);
+    return items.empty() ? nullptr : items.front();
+}
+
+const LayerItemVector& LayerTreeModel::findUSDLayerItems(const SdfLayerHandle& usdLayer) const
+{
+    static const LayerItemVector noItems;
+
+    updateLayerItems();
+
+    const auto found = _layerItems.find(usdLayer);
+    return found == _layerItems.end() ? noItems : found->second;
+}
+
+void LayerTreeModel::updateLayerItems() const
+{
+    if (_layerItemsValid)
+        return;
+
+    _layerItems.clear();
+    _hasInvalidLayerItems = false;
+    for (auto item : getAllItems()) {
+        if (item->isInvalidLayer()) {
+            _hasInvalidLayerItems = true;
+        } else {
+            _layerItems[item->layer()].push_back(item);
+        }
     }
-    return nullptr;
+
+    _layerItemsValid = true;
 }
 
 void LayerTreeModel::updateTargetLayer(InRebuildModel inRebuild)
@@ -402,12 +431,120 @@ void LayerTreeModel::updateTargetLayer(InRebuildModel inRebuild)
     }
 }
 
+void LayerTreeModel::applyLayerChangesOnIdle()
+{
+    if (!_applyLayerChangesOnIdlePending) {
+        _applyLayerChangesOnIdlePending = true;
+        QTimer::singleShot(0, this, [this]() { this->applyLayerChanges(); });
+    }
+}
+
+bool LayerTreeModel::needsRebuild(const LayerChanges& layerChanges) const
+{
+    if (!_sessionState->isValid())
+        return true;
+
+    const SdfLayerHandle rootLayer = _sessionState->stage()->GetRootLayer();
+    const SdfLayerHandle sessionLayer = _sessionState->stage()->GetSessionLayer();
+
+    // The shared and incoming layers include the sublayers of some layers, so
+    // they would need to be recomputed when sublayers change.
+    const bool hasLayerSets = !_sharedLayers.empty() || !_incomingLayers.empty();
+
+    for (const auto& layerAndChanges : layerChanges) {
+        const SdfLayerHandle& layer = layerAndChanges.first;
+        const unsigned        changes = layerAndChanges.second;
+
+        // The root layer custom data holds the shared layers.
+        const unsigned rootChanges = MayaUsd::LayerTreeChange_CustomLayerData
+            | MayaUsd::LayerTreeChange_Identifier | MayaUsd::LayerTreeChange_Reload;
+        if (layer == rootLayer && (changes & rootChanges))
+            return true;
+
+        const unsigned subLayerChanges = MayaUsd::LayerTreeChange_SubLayers
+            | MayaUsd::LayerTreeChange_Identifier | MayaUsd::LayerTreeChange_Reload;
+        if (hasLayerSets && (changes & subLayerChanges))
+            return true;
+
+        if (!findUSDLayerItems(layer).empty())
+            continue;
+
+        // A hidden session layer is shown once it is dirty, and a new layer may
+        // be a sublayer that could not be found before.
+        if ((layer == sessionLayer && sessionLayer->IsDirty()) || _hasInvalidLayerItems)
+            return true;
+    }
+
+    return false;
+}
+
+void LayerTreeModel::applyLayerChanges()
+{
+    _applyLayerChangesOnIdlePending = false;
+
+    LayerChanges layerChanges;
+    std::swap(layerChanges, _pendingLayerChanges);
+
+    // A pending rebuild takes care of all the changes.
+    if (_rebuildOnIdlePending || layerChanges.empty())
+        return;
+
+    if (needsRebuild(layerChanges)) {
+        rebuildModelOnIdle();
+        return;
+    }
+
+    const unsigned dataChanges
+        = MayaUsd::LayerTreeChange_Identifier | MayaUsd::LayerTreeChange_Reload;
+    // A new identifier changes what the relative sublayer paths resolve to.
+    const unsigned subLayerChanges = MayaUsd::LayerTreeChange_SubLayers
+        | MayaUsd::LayerTreeChange_Identifier | MayaUsd::LayerTreeChange_Reload;
+
+    bool childrenChanged = false;
+    for (const auto& layerAndChanges : layerChanges) {
+        const unsigned changes = layerAndChanges.second;
+        if (!(changes & (dataChanges | subLayerChanges)))
+            continue;
+
+        // Note: copy the items since updating their children invalidates the index.
+        const LayerItemVector items = findUSDLayerItems(layerAndChanges.first);
+        for (auto item : items) {
+            if (changes & dataChanges)
+                item->fetchData(RebuildChildren::No);
+
+            if ((changes & subLayerChanges) && item->updateSubLayers()) {
+                invalidateLayerItems();
+                childrenChanged = true;
+            }
+        }
+    }
+
+    if (childrenChanged)
+        updateTargetLayer(InRebuildModel::Yes);
+}
+
 // notification from USD
 void LayerTreeModel::usd_layerChanged(SdfNotice::LayersDidChangeSentPerLayer const& notice)
 {
-    // experienced crashes in python prototype  For now, rebuild everything
-    if (!_blockUsdNotices)
-        rebuildModelOnIdle();
+    if (_blockUsdNotices)
+        return;
+
+    // The same changes are sent once per changed layer.
+    if (notice.GetSerialNumber() == _lastLayerChangesSerialNumber)
+        return;
+    _lastLayerChangesSerialNumber = notice.GetSerialNumber();
+
+    // Only apply the changes that affect the layer tree, instead of rebuilding
+    // the whole model for every edit. Editing the prims of a layer does not
+    // change the tree and its dirty state is updated by its own notification.
+    for (const auto& layerAndChanges : notice.GetChangeListVec()) {
+        const unsigned changes = MayaUsd::classifyLayerTreeChanges(layerAndChanges.second);
+        if (changes != MayaUsd::LayerTreeChange_None)
+            _pendingLayerChanges[layerAndChanges.first] |= changes;
+    }
+
+    if (!_pendingLayerChanges.empty())
+        applyLayerChangesOnIdle();
 }
 
 // notification from USD
@@ -425,8 +562,7 @@ void LayerTreeModel::usd_layerDirtinessChanged(
     const TfWeakPtr<SdfLayer>&              layer)
 {
     if (!_blockUsdNotices) {
-        auto layerItem = findUSDLayerItem(layer);
-        if (layerItem) {
+        for (auto layerItem : findUSDLayerItems(layer)) {
             layerItem->fetchData(RebuildChildren::No);
         }
     }
@@ -26,6 +26,9 @@
 
 #include <QtGui/QStandardItemModel>
 
+#include <limits>
+#include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -141,9 +144,31 @@ protected:
     bool _rebuildOnIdlePending = false;
     void rebuildModel(bool refreshLockState = false);
 
+    // layer changes received from USD, applied to the model on idle
+    typedef std::map<PXR_NS::SdfLayerHandle, unsigned> LayerChanges;
+    void         applyLayerChangesOnIdle();
+    void         applyLayerChanges();
+    bool         needsRebuild(const LayerChanges& layerChanges) const;
+    LayerChanges _pendingLayerChanges;
+    bool         _applyLayerChangesOnIdlePending = false;
+    size_t       _lastLayerChangesSerialNumber = std::numeric_limits<size_t>::max();
+
+    // shared and incoming layers, computed when rebuilding the model
+    std::set<std::string> _sharedLayers;
+    std::set<std::string> _incomingLayers;
+
     void updateTargetLayer(InRebuildModel inRebuild);
 
     LayerTreeItem* findUSDLayerItem(const PXR_NS::SdfLayerRefPtr& usdLayer) const;
+    // a layer can be the sublayer of more than one layer, so it can have more than one item
+    const LayerItemVector& findUSDLayerItems(const PXR_NS::SdfLayerHandle& usdLayer) const;
+
+    // index of the items of each layer, rebuilt when needed after the items change
+    void invalidateLayerItems() const { _layerItemsValid = false; }
+    void updateLayerItems() const;
+    mutable std::map<PXR_NS::SdfLayerHandle, LayerItemVector> _layerItems;
+    mutable bool                                              _layerItemsValid = false;
+    mutable bool                                              _hasInvalidLayerItems = false;
 };
 
 } // namespace UsdLayerEditor
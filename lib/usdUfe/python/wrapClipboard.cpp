@@ -33,8 +33,29 @@ void _setClipboardFileFormat(const std::string& formatTag)
     }
 }
 
+std::string _getClipboardFilePath()
+{
+    auto clipboardHandler = std::dynamic_pointer_cast<UsdUfe::UsdClipboardHandler>(
+        Ufe::RunTimeMgr::instance().clipboardHandler(UsdUfe::getUsdRunTimeId()));
+    if (clipboardHandler) {
+        return clipboardHandler->clipboardFilePath();
+    }
+    return std::string();
+}
+
+void _setClipboardFilePath(const std::string& clipboardFilePath)
+{
+    auto clipboardHandler = std::dynamic_pointer_cast<UsdUfe::UsdClipboardHandler>(
+        Ufe::RunTimeMgr::instance().clipboardHandler(UsdUfe::getUsdRunTimeId()));
+    if (clipboardHandler) {
+        clipboardHandler->setClipboardFilePath(clipboardFilePath);
+    }
+}
+
 // clang-format off
 void wrapClipboard()
 {
     def("setClipboardFileFormat", _setClipboardFileFormat);
+    def("getClipboardFilePath", _getClipboardFilePath);
+    def("setClipboardFilePath", _setClipboardFilePath);
 }
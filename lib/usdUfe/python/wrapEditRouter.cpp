@@ -24,6 +24,8 @@
 
 #include <exception>
 #include <iostream>
+#include <memory>
+#include <vector>
 
 using namespace boost::python;
 
@@ -60,12 +62,32 @@ public:
     ~PyEditRouter() override { }
 
     void operator()(const PXR_NS::VtDictionary& context, PXR_NS::VtDictionary& routingData) override
+    {
+        PXR_NS::TfPyLock pyLock;
+        route(context, routingData);
+    }
+
+    // Take the GIL once for the whole batch instead of once per edit. The
+    // Python router is still called once per edit, as it takes a single edit.
+    void routeBatch(
+        const std::vector<PXR_NS::VtDictionary>& contexts,
+        std::vector<PXR_NS::VtDictionary>&       routingData) override
+    {
+        routingData.resize(contexts.size());
+
+        PXR_NS::TfPyLock pyLock;
+        for (size_t i = 0; i < contexts.size(); ++i)
+            route(contexts[i], routingData[i]);
+    }
+
+private:
+    // Call the Python edit router. The GIL must be held by the caller.
+    void route(const PXR_NS::VtDictionary& context, PXR_NS::VtDictionary& routingData)
     {
         // Note: necessary to compile the TF_WARN macro as it refers to USD types without using
         //       the namespace prefix.
         PXR_NAMESPACE_USING_DIRECTIVE;
 
-        PXR_NS::TfPyLock pyLock;
         if (!PyCallable_Check(_pyCb)) {
             return;
         }
@@ -115,7 +137,6 @@ public:
         }
     }
 
-private:
     PyObject* _pyCb;
 };
 
@@ -159,6 +180,41 @@ void registerStageLayerEditRouterFromLayer(
         operation, stagePtr, PXR_NS::SdfLayerHandle(&layer));
 }
 
+// Python context manager around the C++ memoization scope, since the scope
+// must be destroyed deterministically, in the reverse order of its creation.
+class PyEditRouterCacheScope
+{
+public:
+    void enter() { _scope = std::make_unique<UsdUfe::EditRouterCacheScope>(); }
+
+    void exit(const object&, const object&, const object&) { _scope.reset(); }
+
+private:
+    std::unique_ptr<UsdUfe::EditRouterCacheScope> _scope;
+};
+
+// The requests are (operation, prim, attribute name) tuples. The attribute name
+// is only used by the attribute operation and can be omitted.
+list getEditRouterLayersFromPython(const list& pyRequests)
+{
+    UsdUfe::EditRoutingRequests requests;
+    for (boost::python::ssize_t i = 0; i < len(pyRequests); ++i) {
+        const object pyRequest = pyRequests[i];
+
+        UsdUfe::EditRoutingRequest request;
+        request.operation = extract<PXR_NS::TfToken>(pyRequest[0]);
+        request.prim = extract<PXR_NS::UsdPrim>(pyRequest[1]);
+        if (len(pyRequest) > 2)
+            request.attrName = extract<PXR_NS::TfToken>(pyRequest[2]);
+        requests.push_back(request);
+    }
+
+    list layers;
+    for (const auto& layer : UsdUfe::getEditRouterLayers(requests))
+        layers.append(layer);
+    return layers;
+}
+
 } // namespace
 
 void wrapEditRouter()
@@ -182,6 +238,14 @@ void wrapEditRouter()
 
     def("restoreAllDefaultEditRouters", &UsdUfe::restoreAllDefaultEditRouters);
 
+    def("getEditRouterLayer", &UsdUfe::getEditRouterLayer);
+    def("getAttrEditRouterLayer", &UsdUfe::getAttrEditRouterLayer);
+    def("getEditRouterLayers", &getEditRouterLayersFromPython);
+
+    class_<PyEditRouterCacheScope, boost::noncopyable>("EditRouterCacheScope")
+        .def("__enter__", &PyEditRouterCacheScope::enter)
+        .def("__exit__", &PyEditRouterCacheScope::exit);
+
     using OpThis = UsdUfe::OperationEditRouterContext;
     class_<OpThis, boost::noncopyable>("OperationEditRouterContext", no_init)
         .def("__init__", make_constructor(OperationEditRouterContextInit));
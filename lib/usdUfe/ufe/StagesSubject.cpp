@@ -20,6 +20,7 @@
 #include <usdUfe/ufe/Global.h>
 #include <usdUfe/ufe/UfeVersionCompat.h>
 #include <usdUfe/ufe/UsdCamera.h>
+#include <usdUfe/ufe/UsdHierarchy.h>
 #include <usdUfe/ufe/Utils.h>
 #include <usdUfe/undo/UsdUndoManager.h>
 
@@ -392,6 +393,10 @@ void StagesSubject::stageChanged(
     UsdNotice::ObjectsChanged const& notice,
     UsdStageWeakPtr const&           sender)
 {
+    // Drop the stale cached children before any observer gets a chance to
+    // query the hierarchy.
+    UsdHierarchy::invalidateCachedChildren(notice);
+
     // If the stage path has not been initialized yet, do nothing
     if (stagePath(sender).empty())
         return;
@@ -17,6 +17,7 @@
 #include "UsdClipboard.h"
 
 #include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/usdFileFormat.h>
 #include <pxr/usd/usd/usdcFileFormat.h>
 #include <pxr/usd/usdShade/connectableAPI.h>
@@ -74,18 +75,27 @@ UsdClipboard::~UsdClipboard() { cleanClipboard(); }
 
 void UsdClipboard::setClipboardData(const PXR_NS::UsdStageWeakPtr& clipboardData)
 {
+    cleanClipboardStage();
+
     // Note: if a clipboard file already exists, it automatically gets overridden, so there is no
     // need to clear it.
     // Note: export the root layer directly as the stage export will flatten which removes
     //       variant sets, payloads, etc.
-    PXR_NS::SdfFileFormat::FileFormatArguments args;
-    args[PXR_NS::UsdUsdFileFormatTokens->FormatArg] = _clipboardFileFormat;
-    if (!clipboardData->GetRootLayer()->Export(_clipboardFilePath, "UsdUfe clipboard", args)) {
-        const std::string error
-            = "Failed to export Clipboard stage with destination: " + _clipboardFilePath + ".";
-        throw std::runtime_error(error);
+    if (!_clipboardFilePath.empty()) {
+        PXR_NS::SdfFileFormat::FileFormatArguments args;
+        args[PXR_NS::UsdUsdFileFormatTokens->FormatArg] = _clipboardFileFormat;
+        if (!clipboardData->GetRootLayer()->Export(_clipboardFilePath, "UsdUfe clipboard", args)) {
+            const std::string error
+                = "Failed to export Clipboard stage with destination: " + _clipboardFilePath + ".";
+            throw std::runtime_error(error);
+        }
+        getClipboardFileStamp(_clipboardFileStamp);
     }
 
+    // Keep the root layer itself as the in-memory clipboard data. The stage
+    // on it is only opened if the data gets pasted.
+    _clipboardLayer = clipboardData->GetRootLayer();
+
     setPasteAsSibling();
 
     // Unload the stage, otherwise when we try to set and get the next clipboard data we end up with
@@ -95,23 +105,45 @@ void UsdClipboard::setClipboardData(const PXR_NS::UsdStageWeakPtr& clipboardData
 
 PXR_NS::UsdStageWeakPtr UsdClipboard::getClipboardData()
 {
-    // Check if the layer exists
-    auto layer = PXR_NS::SdfLayer::FindOrOpen(_clipboardFilePath);
-    if (!layer)
+    if (_clipboardFilePath.empty()) {
+        // The clipboard data only lives in memory.
+        if (_clipboardLayer && !_clipboardStage)
+            _clipboardStage = PXR_NS::UsdStage::Open(_clipboardLayer);
+        return _clipboardStage;
+    }
+
+    // Check if the clipboard file exists. Note: it gets removed when another instance of the DCC
+    // app cleans the clipboard, so don't paste the in-memory data in that case either.
+    FileStamp fileStamp;
+    if (!getClipboardFileStamp(fileStamp)) {
+        cleanClipboardStage();
         return {};
+    }
 
-    PXR_NS::UsdStageRefPtr clipboardStage = PXR_NS::UsdStage::Open(_clipboardFilePath);
+    // Unless another instance of the DCC app has written the clipboard file since the in-memory
+    // data was written to it or read from it, paste the in-memory data.
+    if (_clipboardLayer && fileStamp == _clipboardFileStamp) {
+        if (!_clipboardStage)
+            _clipboardStage = PXR_NS::UsdStage::Open(_clipboardLayer);
+        return _clipboardStage;
+    }
 
-    cleanClipboardStageCache();
+    // Check if the layer exists
+    auto layer = PXR_NS::SdfLayer::FindOrOpen(_clipboardFilePath);
+    if (!layer) {
+        cleanClipboardStage();
+        return {};
+    }
 
-    // Add the clipboard USD stage to UsdUtilsStageCache, otherwise it is destroyed once out of
-    // scope.
-    _clipboardStageCacheId = PXR_NS::UsdUtilsStageCache::Get().Insert(clipboardStage);
+    // Force the layer to reload, so we don't end up with the old data.
+    layer->Reload(/*force=*/true);
 
-    // Force the new stage to reload, so we don't end up with the old stage.
-    clipboardStage->Reload();
+    // Keep the read data in memory, otherwise the stage is destroyed once out of scope.
+    _clipboardLayer = layer;
+    _clipboardStage = PXR_NS::UsdStage::Open(_clipboardLayer);
+    _clipboardFileStamp = fileStamp;
 
-    return clipboardStage;
+    return _clipboardStage;
 }
 
 void UsdClipboard::setPasteAsSibling()
@@ -146,20 +178,42 @@ void UsdClipboard::setClipboardFileFormat(const std::string& formatTag)
 
 void UsdClipboard::cleanClipboard()
 {
-    cleanClipboardStageCache();
+    cleanClipboardStage();
     removeClipboardFile();
 }
 
-void UsdClipboard::cleanClipboardStageCache()
+void UsdClipboard::cleanClipboardStage()
 {
-    // Erase the clipboard stage from the cache.
-    if (_clipboardStageCacheId.IsValid()) {
-        auto clipboardStageRef = PXR_NS::UsdUtilsStageCache::Get().Find(_clipboardStageCacheId);
-        PXR_NS::UsdUtilsStageCache::Get().Erase(clipboardStageRef);
-    }
+    _clipboardStage = nullptr;
+    _clipboardLayer = nullptr;
+    _clipboardFileStamp = FileStamp();
+}
+
+bool UsdClipboard::getClipboardFileStamp(FileStamp& stamp) const
+{
+    if (_clipboardFilePath.empty())
+        return false;
+
+    std::error_code ec;
+    const auto      time = std::filesystem::last_write_time(_clipboardFilePath, ec);
+    if (ec)
+        return false;
+    const auto size = std::filesystem::file_size(_clipboardFilePath, ec);
+    if (ec)
+        return false;
+
+    stamp.time = static_cast<std::int64_t>(time.time_since_epoch().count());
+    stamp.size = size;
+    return true;
 }
 
-void UsdClipboard::removeClipboardFile() { std::filesystem::remove(_clipboardFilePath); }
+void UsdClipboard::removeClipboardFile()
+{
+    if (!_clipboardFilePath.empty()) {
+        std::error_code ec;
+        std::filesystem::remove(_clipboardFilePath, ec);
+    }
+}
 
 void UsdClipboard::ufeSelectionChanged()
 {
@@ -19,12 +19,21 @@
 
 #include <usdUfe/base/api.h>
 
+#include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/usd/common.h>
-#include <pxr/usd/usdUtils/stageCache.h>
+
+#include <cstdint>
 
 namespace USDUFE_NS_DEF {
 
 //! \brief Class to handle clipboard USD data.
+/*!
+    The clipboard data is kept in memory, so that pasting in the same instance
+    of the DCC app does not have to read it back from disk. It is also exported
+    to the clipboard file, so that it can be pasted in other running instances.
+    The clipboard file is only read when it was written by another instance
+    after the in-memory data.
+ */
 class USDUFE_PUBLIC UsdClipboard
 {
 public:
@@ -63,9 +72,14 @@ public:
 
     //! \brief Sets the clipboard path (including filename) where data should exported and
     //! read from.
+    //! \note An empty path keeps the clipboard data in memory only, so it cannot
+    //!       be pasted in other running instances of the DCC app.
     //! \param clipboardFilePath The new clipboard path+file.
     void setClipboardFilePath(const std::string& clipboardFilePath);
 
+    //! \brief Get the clipboard path (including filename).
+    const std::string& clipboardFilePath() const { return _clipboardFilePath; }
+
     //! \brief Sets the USD file format for the clipboard file.
     //! \param formatTag The USD file format to use.
     void setClipboardFileFormat(const std::string& formatTag);
@@ -80,11 +94,32 @@ private:
     // The USD file format to use for the clipboard file.
     std::string _clipboardFileFormat;
 
-    // The cache clipboard stage id.
-    PXR_NS::UsdStageCache::Id _clipboardStageCacheId;
-
-    //! \brief Erase the clipboard stage from the cache.
-    void cleanClipboardStageCache();
+    // The in-memory clipboard data: the clipboard root layer and the stage
+    // opened on it, which is only opened when the data is first pasted.
+    PXR_NS::SdfLayerRefPtr _clipboardLayer;
+    PXR_NS::UsdStageRefPtr _clipboardStage;
+
+    // Modification time and size of the clipboard file when the in-memory
+    // data was written to or read from it. A different stamp means another
+    // instance of the DCC app has since written its own clipboard data.
+    struct FileStamp
+    {
+        std::int64_t   time { 0 };
+        std::uintmax_t size { 0 };
+
+        bool operator==(const FileStamp& other) const
+        {
+            return time == other.time && size == other.size;
+        }
+    };
+    FileStamp _clipboardFileStamp;
+
+    //! \brief Get the current stamp of the clipboard file.
+    //! \return False if there is no clipboard file.
+    bool getClipboardFileStamp(FileStamp& stamp) const;
+
+    //! \brief Release the in-memory clipboard data.
+    void cleanClipboardStage();
 
     //! \brief Remove the clipboard file by deleting it.
     void removeClipboardFile();
@@ -268,6 +268,11 @@ void UsdClipboardHandler::setClipboardFilePath(const std::string& clipboardPath)
     _clipboard->setClipboardFilePath(clipboardPath);
 }
 
+const std::string& UsdClipboardHandler::clipboardFilePath() const
+{
+    return _clipboard->clipboardFilePath();
+}
+
 void UsdClipboardHandler::setClipboardFileFormat(const std::string& formatTag)
 {
     _clipboard->setClipboardFileFormat(formatTag);
@@ -65,8 +65,12 @@ public:
     bool hasItemToPaste(HasItemToPasteTestFn testFn);
 
     //! Sets the absolute path (with filename) for saving clipboard data to.
+    //! An empty path keeps the clipboard data in memory only.
     void setClipboardFilePath(const std::string& clipboardPath);
 
+    //! Returns the absolute path (with filename) for saving clipboard data to.
+    const std::string& clipboardFilePath() const;
+
     //! Sets the USD file format for the clipboard file.
     //! \param[in] formatTag USD file format to save. Must be either "usda" or "usdc".
     void setClipboardFileFormat(const std::string& formatTag);
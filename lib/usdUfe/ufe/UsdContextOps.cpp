@@ -30,6 +30,7 @@
 #include <usdUfe/ufe/UsdUndoToggleActiveCommand.h>
 #include <usdUfe/ufe/UsdUndoToggleInstanceableCommand.h>
 #include <usdUfe/ufe/Utils.h>
+#include <usdUfe/utils/loadRules.h>
 
 #include <pxr/base/plug/plugin.h>
 #include <pxr/base/plug/registry.h>
@@ -38,6 +39,7 @@
 
 #include <ufe/globalSelection.h>
 
+#include <algorithm>
 #include <vector>
 
 PXR_NAMESPACE_USING_DIRECTIVE
@@ -238,6 +240,58 @@ getConcretePrimTypes(bool sorted, const UsdUfe::UsdContextOps::SchemaNameMap& sc
     return groups;
 }
 
+// Composite command loading or unloading many prims. The load rules of the
+// stages are modified in a single transaction, so each stage is recomposed and
+// has its load rules saved once instead of once per prim.
+class LoadRulesCompositeCommand : public Ufe::CompositeUndoableCommand
+{
+public:
+    LoadRulesCompositeCommand(
+        const std::list<Ufe::CompositeUndoableCommand::Ptr>& cmds,
+        std::vector<UsdStageWeakPtr>&&                       stages)
+        : Ufe::CompositeUndoableCommand(cmds)
+        , _stages(std::move(stages))
+    {
+    }
+
+    void execute() override
+    {
+        {
+            UsdUfe::LoadRulesTransaction transaction;
+            Ufe::CompositeUndoableCommand::execute();
+        }
+        saveLoadRules();
+    }
+
+    void undo() override
+    {
+        {
+            UsdUfe::LoadRulesTransaction transaction;
+            Ufe::CompositeUndoableCommand::undo();
+        }
+        saveLoadRules();
+    }
+
+    void redo() override
+    {
+        {
+            UsdUfe::LoadRulesTransaction transaction;
+            Ufe::CompositeUndoableCommand::redo();
+        }
+        saveLoadRules();
+    }
+
+private:
+    void saveLoadRules() const
+    {
+        for (const auto& stage : _stages)
+            if (stage)
+                UsdUfe::saveStageLoadRules(stage);
+    }
+
+    std::vector<UsdStageWeakPtr> _stages;
+};
+
 } // namespace
 
 namespace USDUFE_NS_DEF {
@@ -631,6 +685,21 @@ Ufe::UndoableCommand::Ptr UsdContextOps::doBulkOpCmd(const ItemPath& itemPath)
                                 : nullptr;
     };
 
+    // Load and unload commands modify the load rules of the stages in a single
+    // transaction.
+    std::vector<UsdStageWeakPtr> loadRulesStages;
+    auto addLoadRulesStage = [&loadRulesStages](const UsdStageWeakPtr& stage) {
+        if (std::find(loadRulesStages.begin(), loadRulesStages.end(), stage)
+            == loadRulesStages.end())
+            loadRulesStages.push_back(stage);
+    };
+    auto loadRulesCmdReturn = [&cmdList, &loadRulesStages](const Ufe::Selection& bulkItems) {
+        DEBUG_OUTPUT(bulkItems);
+        return !cmdList.empty()
+            ? std::make_shared<LoadRulesCompositeCommand>(cmdList, std::move(loadRulesStages))
+            : nullptr;
+    };
+
     // Unload:
     if (itemPath[0u] == kUSDUnloadItem) {
         for (auto& selItem : _bulkItems) {
@@ -638,9 +707,10 @@ Ufe::UndoableCommand::Ptr UsdContextOps::doBulkOpCmd(const ItemPath& itemPath)
             if (usdItem) {
                 auto cmd = std::make_shared<UsdUndoUnloadPayloadCommand>(usdItem->prim());
                 cmdList.emplace_back(cmd);
+                addLoadRulesStage(usdItem->prim().GetStage());
             }
         }
-        return compositeCmdReturn(_bulkItems);
+        return loadRulesCmdReturn(_bulkItems);
     }
 
     // Load With Descendants:
@@ -653,9 +723,10 @@ Ufe::UndoableCommand::Ptr UsdContextOps::doBulkOpCmd(const ItemPath& itemPath)
             if (usdItem) {
                 auto cmd = std::make_shared<UsdUndoLoadPayloadCommand>(usdItem->prim(), policy);
                 cmdList.emplace_back(cmd);
+                addLoadRulesStage(usdItem->prim().GetStage());
             }
         }
-        return compositeCmdReturn(_bulkItems);
+        return loadRulesCmdReturn(_bulkItems);
     }
 
     // Prim Visibility:
@@ -22,6 +22,7 @@
 #include <usdUfe/utils/layers.h>
 #include <usdUfe/utils/usdUtils.h>
 
+#include <pxr/base/tf/hash.h>
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/usd/sdf/copyUtils.h>
 #include <pxr/usd/sdf/layer.h>
@@ -36,8 +37,13 @@
 #include <ufe/sceneNotification.h>
 
 #include <cassert>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
 
 #ifdef UFE_V3_FEATURES_AVAILABLE
 #include <usdUfe/ufe/UsdUndoUngroupCommand.h>
@@ -89,6 +95,159 @@ UsdPrimSiblingRange invalidSiblingRange()
     return UsdPrimSiblingRange(empty, empty);
 }
 
+// Cache of the child lists built by UsdHierarchy, per stage and keyed by the
+// parent prim path, so that expanding or redrawing a parent in the Outliner
+// does not create a scene item and a UFE path for each of its children again.
+// StagesSubject drops the stale lists when their stage changes, and the whole
+// cache is dropped when the DCC scene is reset.
+class ChildListCache
+{
+public:
+    using ChildListPtr = std::shared_ptr<const Ufe::SceneItemList>;
+
+    struct Key
+    {
+        Ufe::Path       parentPath;
+        std::type_index hierarchyType;
+        bool            showInactive;
+        bool            filterInactive;
+
+        bool operator==(const Key& other) const
+        {
+            return hierarchyType == other.hierarchyType && showInactive == other.showInactive
+                && filterInactive == other.filterInactive && parentPath == other.parentPath;
+        }
+    };
+
+    ChildListPtr find(const UsdPrim& parent, const Key& key)
+    {
+        if (!parent) {
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto                        stageIt = _stages.find(parent.GetStage());
+        if (stageIt == _stages.end()) {
+            return nullptr;
+        }
+        auto parentIt = stageIt->second.find(parent.GetPath());
+        if (parentIt == stageIt->second.end()) {
+            return nullptr;
+        }
+        for (const Entry& entry : parentIt->second) {
+            if (entry.key == key) {
+                return entry.children;
+            }
+        }
+        return nullptr;
+    }
+
+    void insert(const UsdPrim& parent, const Key& key, const ChildListPtr& children)
+    {
+        const UsdStageWeakPtr       stage = parent.GetStage();
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto                        stageIt = _stages.find(stage);
+        if (stageIt == _stages.end()) {
+            // Forget the stages that have been destroyed.
+            for (auto it = _stages.begin(); it != _stages.end();) {
+                it = it->first ? std::next(it) : _stages.erase(it);
+            }
+            stageIt = _stages.emplace(stage, ParentMap()).first;
+        } else if (stageIt->second.size() >= kMaxParentsPerStage) {
+            stageIt->second.clear();
+        }
+
+        std::vector<Entry>& entries = stageIt->second[parent.GetPath()];
+        for (Entry& entry : entries) {
+            if (entry.key == key) {
+                entry.children = children;
+                return;
+            }
+        }
+        entries.push_back({ key, children });
+    }
+
+    void invalidate(const UsdNotice::ObjectsChanged& notice)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto                        stageIt = _stages.find(notice.GetStage());
+        if (stageIt == _stages.end()) {
+            return;
+        }
+        ParentMap& parents = stageIt->second;
+
+        // A resync may add, remove, reorder, activate or deactivate prims
+        // anywhere below the resynced path, which changes the children of the
+        // resynced prim, of its descendants and, when the resynced prim itself
+        // appears or disappears, of its parent. For large change blocks,
+        // dropping the stage is cheaper than matching every cached parent
+        // against every resynced path.
+        const auto resyncedPaths = notice.GetResyncedPaths();
+        if (resyncedPaths.size() > kMaxResyncedPathsToMatch) {
+            parents.clear();
+            return;
+        }
+        for (const SdfPath& resyncedPath : resyncedPaths) {
+            if (resyncedPath.IsAbsoluteRootPath()) {
+                parents.clear();
+                return;
+            }
+            if (!resyncedPath.IsPrimPath()) {
+                continue;
+            }
+            const SdfPath parentPath = resyncedPath.GetParentPath();
+            for (auto it = parents.begin(); it != parents.end();) {
+                const bool stale = it->first.HasPrefix(resyncedPath) || it->first == parentPath;
+                it = stale ? parents.erase(it) : std::next(it);
+            }
+        }
+
+        // Metadata changes do not resync, but the children hook of a derived
+        // hierarchy may depend on metadata, such as the pull information of
+        // the children.
+        for (const SdfPath& changedPath : notice.GetChangedInfoOnlyPaths()) {
+            if (changedPath.IsPrimPath()) {
+                parents.erase(changedPath);
+                parents.erase(changedPath.GetParentPath());
+            }
+        }
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stages.clear();
+    }
+
+private:
+    static constexpr size_t kMaxParentsPerStage = 1u << 14;
+    static constexpr size_t kMaxResyncedPathsToMatch = 64u;
+
+    struct Entry
+    {
+        Key          key;
+        ChildListPtr children;
+    };
+    using ParentMap = std::unordered_map<SdfPath, std::vector<Entry>, SdfPath::Hash>;
+
+    std::mutex                                             _mutex;
+    std::unordered_map<UsdStageWeakPtr, ParentMap, TfHash> _stages;
+};
+
+ChildListCache& getChildListCache()
+{
+    // Note: C++ guarantees correct multi-thread protection for static
+    //       variables initialization in functions.
+    static ChildListCache cache;
+    return cache;
+}
+
+Usd_PrimFlagsPredicate childPredicate(bool showInactive)
+{
+    // See uniqueChildName() for explanation of USD filter predicate.
+    return showInactive ? UsdPrimIsDefined && !UsdPrimIsAbstract : kUsdUfePrimDefaultPredicate;
+}
+
 UsdPrimSiblingRange getUSDFilteredChildren(
     const UsdUfe::UsdSceneItem::Ptr usdSceneItem,
     const Usd_PrimFlagsPredicate    pred = kUsdUfePrimDefaultPredicate)
@@ -139,6 +298,15 @@ const Ufe::Path& UsdHierarchy::path() const { return _item->path(); }
 
 UsdSceneItem::Ptr UsdHierarchy::usdSceneItem() const { return _item; }
 
+/*static*/
+void UsdHierarchy::invalidateCachedChildren(const UsdNotice::ObjectsChanged& notice)
+{
+    getChildListCache().invalidate(notice);
+}
+
+/*static*/
+void UsdHierarchy::clearCachedChildren() { getChildListCache().clear(); }
+
 //------------------------------------------------------------------------------
 // Ufe::Hierarchy overrides
 //------------------------------------------------------------------------------
@@ -149,21 +317,30 @@ Ufe::SceneItem::Ptr UsdHierarchy::sceneItem() const { return _item; }
 
 bool UsdHierarchy::hasChildren() const
 {
-    // We have an extra logic in createUFEChildList to remap and filter
-    // prims. Going this direction is more costly, but easier to maintain.
-    //
-    // I don't have data that proves we need to worry about performance in here,
-    // so going after maintainability.
-    return !children().empty();
+    // Same filters as children().
+    const bool showInactive = false;
+    const bool isFilteringInactive = true;
+    if (auto children = getChildListCache().find(
+            prim(), { path(), typeid(*this), showInactive, isFilteringInactive })) {
+        return !children->empty();
+    }
+    return hasUFEChild(getUSDFilteredChildren(_item), isFilteringInactive);
 }
 
 bool UsdHierarchy::hasFilteredChildren(const ChildFilter& childFilter) const
 {
-    // We have an extra logic in createUFEChildList to remap and filter
-    // prims. Going this direction is more costly, but easier to maintain.
-    //
-    // I don't have data that proves we need to worry about performance in here,
-    // so going after maintainability.
+    // Same filters as filteredChildren().
+    if ((childFilter.size() == 1) && (childFilter.front().name == "InactivePrims")) {
+        const bool showInactive = childFilter.front().value;
+        const bool isFilteringInactive = !showInactive;
+        if (auto children = getChildListCache().find(
+                prim(), { path(), typeid(*this), showInactive, isFilteringInactive })) {
+            return !children->empty();
+        }
+        return hasUFEChild(
+            getUSDFilteredChildren(_item, childPredicate(showInactive)), isFilteringInactive);
+    }
+
     return !filteredChildren(childFilter).empty();
 }
 
@@ -171,20 +348,20 @@ bool UsdHierarchy::hasFilteredChildren(const ChildFilter& childFilter) const
 
 bool UsdHierarchy::hasChildren() const
 {
-    // We have an extra logic in createUFEChildList to remap and filter
-    // prims. Going this direction is more costly, but easier to maintain.
-    //
-    // I don't have data that proves we need to worry about performance in here,
-    // so going after maintainability.
+    const bool showInactive = false;
     const bool isFilteringInactive = false;
-    return !createUFEChildList(getUSDFilteredChildren(_item), isFilteringInactive).empty();
+    if (auto children = getChildListCache().find(
+            prim(), { path(), typeid(*this), showInactive, isFilteringInactive })) {
+        return !children->empty();
+    }
+    return hasUFEChild(getUSDFilteredChildren(_item), isFilteringInactive);
 }
 
 #endif
 
 Ufe::SceneItemList UsdHierarchy::children() const
 {
-    return createUFEChildList(getUSDFilteredChildren(_item), true /*filterInactive*/);
+    return cachedUFEChildList(false /*showInactive*/, true /*filterInactive*/);
 }
 
 Ufe::SceneItemList UsdHierarchy::filteredChildren(const ChildFilter& childFilter) const
@@ -192,11 +369,8 @@ Ufe::SceneItemList UsdHierarchy::filteredChildren(const ChildFilter& childFilter
     // Note: for now the only child filter flag we support is "Inactive Prims".
     //       See UsdHierarchyHandler::childFilter()
     if ((childFilter.size() == 1) && (childFilter.front().name == "InactivePrims")) {
-        // See uniqueChildName() for explanation of USD filter predicate.
-        const bool             showInactive = childFilter.front().value;
-        Usd_PrimFlagsPredicate flags
-            = showInactive ? UsdPrimIsDefined && !UsdPrimIsAbstract : kUsdUfePrimDefaultPredicate;
-        return createUFEChildList(getUSDFilteredChildren(_item, flags), !showInactive);
+        const bool showInactive = childFilter.front().value;
+        return cachedUFEChildList(showInactive, !showInactive);
     }
 
     UFE_LOG("Unknown child filter");
@@ -212,8 +386,10 @@ bool UsdHierarchy::childrenHook(
 }
 
 // Return UFE child list from input USD child list.
-Ufe::SceneItemList
-UsdHierarchy::createUFEChildList(const UsdPrimSiblingRange& range, bool filterInactive) const
+Ufe::SceneItemList UsdHierarchy::createUFEChildList(
+    const UsdPrimSiblingRange& range,
+    bool                       filterInactive,
+    bool*                      hooked) const
 {
     // Note that the calls to this function are given a range from
     // getUSDFilteredChildren() above, which ensures that when fItem is a
@@ -223,8 +399,11 @@ UsdHierarchy::createUFEChildList(const UsdPrimSiblingRange& range, bool filterIn
     Ufe::SceneItemList children;
     for (const auto& child : range) {
         // Give derived classes a chance to process this child.
-        if (childrenHook(child, children, filterInactive))
+        if (childrenHook(child, children, filterInactive)) {
+            if (hooked)
+                *hooked = true;
             continue;
+        }
 
         if (!filterInactive || child.IsActive()) {
             children.emplace_back(UsdSceneItem::create(_item->path() + child.GetName(), child));
@@ -233,6 +412,54 @@ UsdHierarchy::createUFEChildList(const UsdPrimSiblingRange& range, bool filterIn
     return children;
 }
 
+bool UsdHierarchy::hasUFEChild(const UsdPrimSiblingRange& range, bool filterInactive) const
+{
+    // Same logic as createUFEChildList(), without creating the scene items of
+    // the children. The hook still gets a list to add the children it remaps
+    // to, which stays empty unless it does.
+    Ufe::SceneItemList hookedChildren;
+    for (const auto& child : range) {
+        if (childrenHook(child, hookedChildren, filterInactive)) {
+            if (!hookedChildren.empty())
+                return true;
+            continue;
+        }
+
+        if (!filterInactive || child.IsActive())
+            return true;
+    }
+    return false;
+}
+
+Ufe::SceneItemList UsdHierarchy::cachedUFEChildList(bool showInactive, bool filterInactive) const
+{
+    // The children of instances and instance proxies come from prototypes,
+    // whose changes are not reported under the instance paths. Point instances
+    // have no children.
+    const UsdPrim parentPrim = prim();
+    if (_item->isPointInstance() || !parentPrim.IsValid() || parentPrim.IsInstance()
+        || parentPrim.IsInstanceProxy()) {
+        return createUFEChildList(
+            getUSDFilteredChildren(_item, childPredicate(showInactive)), filterInactive);
+    }
+
+    const ChildListCache::Key key { path(), typeid(*this), showInactive, filterInactive };
+    if (auto children = getChildListCache().find(parentPrim, key)) {
+        return *children;
+    }
+
+    bool hooked = false;
+    auto children = std::make_shared<const Ufe::SceneItemList>(createUFEChildList(
+        getUSDFilteredChildren(_item, childPredicate(showInactive)), filterInactive, &hooked));
+
+    // The children remapped or skipped by the hook of a derived class may
+    // depend on DCC state that USD notices don't track, so don't cache them.
+    if (!hooked) {
+        getChildListCache().insert(parentPrim, key, children);
+    }
+    return *children;
+}
+
 Ufe::SceneItem::Ptr UsdHierarchy::parent() const
 {
     // We do not have a special case for point instances here. If fItem
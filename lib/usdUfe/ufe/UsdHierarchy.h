@@ -20,6 +20,8 @@
 #include <usdUfe/ufe/UfeVersionCompat.h>
 #include <usdUfe/ufe/UsdSceneItem.h>
 
+#include <pxr/usd/usd/notice.h>
+
 #include <ufe/hierarchy.h>
 #include <ufe/path.h>
 #include <ufe/selection.h>
@@ -56,6 +58,15 @@ public:
 
     UsdSceneItem::Ptr usdSceneItem() const;
 
+    //! Drops the cached child lists made stale by \p notice: those of the
+    //! resynced prims, of their descendants and of their parents, and those
+    //! of the prims whose metadata changed and of their parents.
+    //! Must be called before the UFE notifications for \p notice are sent.
+    static void invalidateCachedChildren(const PXR_NS::UsdNotice::ObjectsChanged& notice);
+
+    //! Drops all cached child lists, e.g. when the DCC scene is reset.
+    static void clearCachedChildren();
+
     // Ufe::Hierarchy overrides
     Ufe::SceneItem::Ptr sceneItem() const override;
     bool                hasChildren() const override;
@@ -97,8 +108,20 @@ protected:
         bool                   filterInactive) const;
 
 private:
-    Ufe::SceneItemList
-    createUFEChildList(const PXR_NS::UsdPrimSiblingRange& range, bool filterInactive) const;
+    //! Return UFE child list from input USD child list. If \p hooked is not
+    //! null, it is set to true if childrenHook() processed any of the children.
+    Ufe::SceneItemList createUFEChildList(
+        const PXR_NS::UsdPrimSiblingRange& range,
+        bool                               filterInactive,
+        bool*                              hooked = nullptr) const;
+
+    //! Return true if createUFEChildList() would return a non-empty list,
+    //! stopping at the first child that would be part of it.
+    bool hasUFEChild(const PXR_NS::UsdPrimSiblingRange& range, bool filterInactive) const;
+
+    //! Return the cached UFE child list built with the given filters, building
+    //! and caching it if needed.
+    Ufe::SceneItemList cachedUFEChildList(bool showInactive, bool filterInactive) const;
 
 private:
     UsdSceneItem::Ptr _item;
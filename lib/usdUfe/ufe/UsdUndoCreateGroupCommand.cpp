@@ -17,6 +17,7 @@
 
 #include <usdUfe/ufe/UsdUndoAddNewPrimCommand.h>
 #include <usdUfe/ufe/UsdUndoSetKindCommand.h>
+#include <usdUfe/ufe/Utils.h>
 
 #include <pxr/usd/kind/registry.h>
 #include <pxr/usd/usd/modelAPI.h>
@@ -97,6 +98,10 @@ void UsdUndoCreateGroupCommand::execute()
     try {
         auto newParentHierarchy = Ufe::Hierarchy::hierarchy(_groupItem);
         if (newParentHierarchy) {
+            // Note: with UFE v3, the children are not reparented here but by
+            // the DCC, one insert child command at a time, so the names of the
+            // group children can only be indexed once per parent on this path.
+            UniqueChildNameBatch uniqueNameBatch;
             for (const auto& child : _selection) {
                 auto parentCmd = newParentHierarchy->appendChildCmd(child);
                 _groupCompositeCmd->append(parentCmd);
@@ -49,6 +49,9 @@ public:
     UsdSceneItem::Ptr   duplicatedItem() const;
     Ufe::SceneItem::Ptr sceneItem() const override { return duplicatedItem(); };
 
+    //! The USD path of the duplicate, known before the command is executed.
+    const PXR_NS::SdfPath& usdDstPath() const { return _usdDstPath; }
+
     void execute() override;
     void undo() override;
     void redo() override;
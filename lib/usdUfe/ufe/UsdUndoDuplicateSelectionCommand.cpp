@@ -16,9 +16,13 @@
 
 #include "UsdUndoDuplicateSelectionCommand.h"
 
+#include <usdUfe/base/tokens.h>
 #include <usdUfe/ufe/UsdUndoDuplicateCommand.h>
 #include <usdUfe/ufe/Utils.h>
 #include <usdUfe/undo/UsdUndoBlock.h>
+#include <usdUfe/utils/editRouter.h>
+#include <usdUfe/utils/editRouterContext.h>
+#include <usdUfe/utils/loadRules.h>
 
 namespace USDUFE_NS_DEF {
 
@@ -67,8 +71,50 @@ void UsdUndoDuplicateSelectionCommand::execute()
 {
     UsdUndoBlock undoBlock(&_undoableItem);
 
-    for (auto&& usdItem : _sourceItems) {
-        auto duplicateCmd = UsdUndoDuplicateCommand::create(usdItem, _dstParentItem);
+    // Route all the duplicates with a single edit router call, unless an outer
+    // context already routed them. Each duplicate command then uses the layer
+    // of its item instead of calling the edit router again. Unrouted items use
+    // the current edit target, as they would when routed one by one.
+    PXR_NS::SdfLayerHandleVector dstLayers(_sourceItems.size());
+    if (!StackedEditRouterContext::isTargetAlreadySet()) {
+        EditRoutingRequests requests;
+        requests.reserve(_sourceItems.size());
+        for (auto&& usdItem : _sourceItems)
+            requests.push_back({ EditRoutingTokens->RouteDuplicate, usdItem->prim(), {} });
+        dstLayers = getEditRouterLayers(requests);
+
+        for (size_t i = 0; i < _sourceItems.size(); ++i)
+            if (!dstLayers[i])
+                dstLayers[i] = _sourceItems[i]->prim().GetStage()->GetEditTarget().GetLayer();
+    }
+
+    // Each duplicate replicates the load rules of its source. Name all the
+    // duplicates first, so that their load rules are applied to the stage at
+    // once, before any of them is copied. Each copy then composes with its
+    // final load rules, so an unloaded payload is never loaded by the copy.
+    // Within the unique name batch, the later duplicates are named after the
+    // earlier ones, even though those do not exist yet.
+    std::vector<UsdUndoDuplicateCommand::Ptr> duplicateCmds;
+    duplicateCmds.reserve(_sourceItems.size());
+    {
+        UniqueChildNameBatch uniqueNameBatch;
+        LoadRulesTransaction loadRulesTransaction;
+        for (auto&& usdItem : _sourceItems) {
+            auto duplicateCmd = UsdUndoDuplicateCommand::create(usdItem, _dstParentItem);
+
+            PXR_NS::UsdPrim srcPrim = usdItem->prim();
+            duplicateLoadRules(*srcPrim.GetStage(), srcPrim.GetPath(), duplicateCmd->usdDstPath());
+
+            duplicateCmds.push_back(duplicateCmd);
+        }
+    }
+
+    for (size_t i = 0; i < _sourceItems.size(); ++i) {
+        const UsdSceneItem::Ptr& usdItem = _sourceItems[i];
+
+        OperationEditRouterContext ctx(usdItem->prim().GetStage(), dstLayers[i]);
+
+        const auto& duplicateCmd = duplicateCmds[i];
         duplicateCmd->execute();
 
         _duplicatedItemsMap.emplace(usdItem, downcast(duplicateCmd->sceneItem()));
@@ -279,7 +279,9 @@ preserveLoadRules(const Ufe::Path& srcUfePath, const SdfPath& srcUsdPath, const
 
     // Make sure the load state of the reparented prim will be preserved.
     // We copy all rules that applied to it specifically and remove the rules
-    // that applied to it specifically.
+    // that applied to it specifically. Both are applied at once when the
+    // transaction ends.
+    LoadRulesTransaction transaction;
     duplicateLoadRules(*stage, srcUsdPath, dstUsdPath);
     removeRulesForPath(*stage, srcUsdPath);
 }
@@ -16,6 +16,7 @@
 #include "UsdUndoPayloadCommand.h"
 
 #include <usdUfe/ufe/Utils.h>
+#include <usdUfe/utils/loadRules.h>
 
 namespace USDUFE_NS_DEF {
 
@@ -40,7 +41,7 @@ UsdUndoLoadUnloadBaseCommand::UsdUndoLoadUnloadBaseCommand(const PXR_NS::UsdPrim
 
     // When not provided with the load policy, we need to figure out
     // what the current policy is.
-    PXR_NS::UsdStageLoadRules loadRules = _stage->GetLoadRules();
+    PXR_NS::UsdStageLoadRules loadRules = getLoadRules(*_stage);
     _policy
         = loadRules.GetEffectiveRuleForPath(_primPath) == PXR_NS::UsdStageLoadRules::Rule::AllRule
         ? PXR_NS::UsdLoadPolicy::UsdLoadWithDescendants
@@ -55,19 +56,46 @@ void UsdUndoLoadUnloadBaseCommand::doCommand(UsdUndoLoadUnloadBaseCommand::comma
     if (!_stage)
         return;
     if (!undo)
-        _undoRules = _stage->GetLoadRules();
+        _undoRules = getLoadRules(*_stage);
     fn(this);
     if (undo)
-        _stage->SetLoadRules(_undoRules);
+        setLoadRules(*_stage, _undoRules);
     saveModifiedLoadRules();
 }
 
-void UsdUndoLoadUnloadBaseCommand::doLoad() const { _stage->Load(_primPath, _policy); }
+void UsdUndoLoadUnloadBaseCommand::doLoad() const
+{
+    if (!LoadRulesTransaction::isActive()) {
+        _stage->Load(_primPath, _policy);
+        return;
+    }
+
+    // Within a transaction, only modify the pending load rules. The stage
+    // gets loaded once when the transaction ends.
+    PXR_NS::UsdStageLoadRules loadRules = getLoadRules(*_stage);
+    loadRules.LoadAndUnload({ _primPath }, {}, _policy);
+    setLoadRules(*_stage, loadRules);
+}
+
+void UsdUndoLoadUnloadBaseCommand::doUnload() const
+{
+    if (!LoadRulesTransaction::isActive()) {
+        _stage->Unload(_primPath);
+        return;
+    }
 
-void UsdUndoLoadUnloadBaseCommand::doUnload() const { _stage->Unload(_primPath); }
+    PXR_NS::UsdStageLoadRules loadRules = getLoadRules(*_stage);
+    loadRules.Unload(_primPath);
+    setLoadRules(*_stage, loadRules);
+}
 
 void UsdUndoLoadUnloadBaseCommand::saveModifiedLoadRules() const
 {
+    // Within a transaction, the pending load rules are not applied yet. The
+    // code owning the transaction saves them once it ends.
+    if (LoadRulesTransaction::isActive())
+        return;
+
     // Save the load rules so that switching the stage settings will be able to preserve the
     // load rules.
     UsdUfe::saveStageLoadRules(_stage);
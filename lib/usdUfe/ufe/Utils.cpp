@@ -42,7 +42,7 @@
 #include <ufe/selection.h>
 
 #include <cctype>
-#include <regex>
+#include <map>
 
 #ifdef UFE_V4_FEATURES_AVAILABLE
 #include <ufe/attributeInfo.h>
@@ -104,6 +104,10 @@ uint32_t findLayerIndex(const UsdPrim& prim, const SdfLayerHandle& layer)
 
 int gWaitCursorCount = 0;
 
+// Children names of the parents seen in the current unique child name batch.
+int gUniqueChildNameBatchCount = 0;
+std::map<std::pair<UsdStageWeakPtr, SdfPath>, UsdUfe::ChildrenNames> gBatchChildrenNames;
+
 UsdUfe::StageAccessorFn            gStageAccessorFn = nullptr;
 UsdUfe::StagePathAccessorFn        gStagePathAccessorFn = nullptr;
 UsdUfe::UfePathToPrimFn            gUfePathToPrimFn = nullptr;
@@ -311,18 +315,16 @@ int ufePathToInstanceIndex(const Ufe::Path& path, UsdPrim* prim)
 
 bool splitNumericalSuffix(const std::string srcName, std::string& base, std::string& suffix)
 {
-    // Compiled regular expression to find a numerical suffix to a path component.
-    // It searches for any number of characters followed by a single non-numeric,
-    // then one or more digits at end of string.
-    std::regex re("(.*)([^0-9])([0-9]+)$");
+    // Find any number of characters followed by a single non-numeric, then
+    // one or more digits at end of string.
     base = srcName;
-    std::smatch match;
-    if (std::regex_match(srcName, match, re)) {
-        base = match[1].str() + match[2].str();
-        suffix = match[3].str();
-        return true;
+    const size_t lastNonDigit = srcName.find_last_not_of("0123456789");
+    if (lastNonDigit == std::string::npos || lastNonDigit + 1 == srcName.size()) {
+        return false;
     }
-    return false;
+    base = srcName.substr(0, lastNonDigit + 1);
+    suffix = srcName.substr(lastNonDigit + 1);
+    return true;
 }
 
 std::string uniqueName(const TfToken::HashSet& existingNames, std::string srcName)
@@ -358,8 +360,18 @@ void setUniqueChildNameFn(UniqueChildNameFn fn)
 
 std::string uniqueChildName(const UsdPrim& usdParent, const std::string& name)
 {
-    return gUniqueChildNameFn ? gUniqueChildNameFn(usdParent, name)
-                              : uniqueChildNameDefault(usdParent, name);
+    std::string childName = gUniqueChildNameFn ? gUniqueChildNameFn(usdParent, name)
+                                               : uniqueChildNameDefault(usdParent, name);
+
+    // Within a batch, the returned name is about to be given to a new child.
+    if (gUniqueChildNameBatchCount > 0 && !childName.empty()) {
+        auto iter = gBatchChildrenNames.find({ usdParent.GetStage(), usdParent.GetPath() });
+        if (iter != gBatchChildrenNames.end()) {
+            iter->second.add(TfToken(childName));
+        }
+    }
+
+    return childName;
 }
 
 std::string uniqueChildNameDefault(const UsdPrim& usdParent, const std::string& name)
@@ -367,8 +379,18 @@ std::string uniqueChildNameDefault(const UsdPrim& usdParent, const std::string&
     if (!usdParent.IsValid())
         return std::string();
 
-    TfToken::HashSet childrenNames;
+    ChildrenNames        storage;
+    const ChildrenNames& childrenNames = getChildrenNames(usdParent, storage);
+
+    std::string childName { name };
+    if (childrenNames.contains(childName)) {
+        childName = uniqueName(childrenNames.names(), childName);
+    }
+    return childName;
+}
 
+ChildrenNames::ChildrenNames(const UsdPrim& parent)
+{
     // The prim GetChildren method used the UsdPrimDefaultPredicate which includes
     // active prims. We also need the inactive ones.
     //
@@ -380,15 +402,87 @@ std::string uniqueChildNameDefault(const UsdPrim& usdParent, const std::string&
     //		 use loaded either in _computeDisplayPredicate().
     //
     // Note: our UsdHierarchy uses instance proxies, so we also use them here.
-    for (auto child : usdParent.GetFilteredChildren(
+    for (auto child : parent.GetFilteredChildren(
              UsdTraverseInstanceProxies(UsdPrimIsDefined && !UsdPrimIsAbstract))) {
-        childrenNames.insert(child.GetName());
+        _names.insert(child.GetName());
     }
-    std::string childName { name };
-    if (childrenNames.find(TfToken(childName)) != childrenNames.end()) {
-        childName = uniqueName(childrenNames, childName);
+}
+
+bool ChildrenNames::contains(const std::string& name) const
+{
+    return _names.find(TfToken(name)) != _names.end();
+}
+
+const std::string& ChildrenNames::largestSuffixName(const std::string& baseName, int& suffix) const
+{
+    // The suffixes are only indexed when first needed, as the default unique
+    // child name only uses the names.
+    if (!_suffixesIndexed) {
+        for (const TfToken& name : _names) {
+            indexSuffix(name.GetString());
+        }
+        _suffixesIndexed = true;
     }
-    return childName;
+
+    static const std::string noName;
+
+    auto iter = _largestSuffixes.find(baseName);
+    if (iter == _largestSuffixes.end()) {
+        return noName;
+    }
+    suffix = iter->second.second;
+    return iter->second.first;
+}
+
+void ChildrenNames::add(const TfToken& name)
+{
+    if (_names.insert(name).second && _suffixesIndexed) {
+        indexSuffix(name.GetString());
+    }
+}
+
+void ChildrenNames::indexSuffix(const std::string& name) const
+{
+    std::string baseName, suffix;
+    // Suffixes too long to fit in an int are left out, uniqueName() still
+    // guarantees uniqueness.
+    if (!splitNumericalSuffix(name, baseName, suffix) || suffix.length() > 9) {
+        return;
+    }
+
+    const int suffixValue = std::stoi(suffix);
+    auto      inserted = _largestSuffixes.emplace(baseName, std::make_pair(name, suffixValue));
+    if (!inserted.second && suffixValue > inserted.first->second.second) {
+        inserted.first->second = std::make_pair(name, suffixValue);
+    }
+}
+
+const ChildrenNames& getChildrenNames(const UsdPrim& parent, ChildrenNames& storage)
+{
+    if (gUniqueChildNameBatchCount == 0) {
+        storage = ChildrenNames(parent);
+        return storage;
+    }
+
+    const auto key = std::make_pair(parent.GetStage(), parent.GetPath());
+    auto       iter = gBatchChildrenNames.find(key);
+    if (iter == gBatchChildrenNames.end()) {
+        iter = gBatchChildrenNames.emplace(key, ChildrenNames(parent)).first;
+    }
+    return iter->second;
+}
+
+void startUniqueChildNameBatch() { ++gUniqueChildNameBatchCount; }
+
+void stopUniqueChildNameBatch()
+{
+    if (gUniqueChildNameBatchCount <= 0)
+        return;
+
+    --gUniqueChildNameBatchCount;
+
+    if (gUniqueChildNameBatchCount == 0)
+        gBatchChildrenNames.clear();
 }
 
 SdfPath uniqueChildPath(const UsdStage& stage, const SdfPath& path)
@@ -38,6 +38,8 @@
 #endif // UFE_V3_FEATURES_AVAILABLE
 
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 UFE_NS_DEF
 {
@@ -197,6 +199,70 @@ std::string uniqueChildName(const PXR_NS::UsdPrim& usdParent, const std::string&
 USDUFE_PUBLIC
 std::string uniqueChildNameDefault(const PXR_NS::UsdPrim& parent, const std::string& name);
 
+//! \brief Names of the children of a prim, as used to make child names unique.
+//!
+//! Along with the names, the child name with the largest numerical suffix is
+//! indexed per base name, so that a unique name following the largest suffix
+//! can be found without splitting every sibling name.
+class USDUFE_PUBLIC ChildrenNames
+{
+public:
+    ChildrenNames() = default;
+
+    //! Collect the names of the children of \p parent, including the inactive
+    //! ones and instance proxies.
+    ChildrenNames(const PXR_NS::UsdPrim& parent);
+
+    const PXR_NS::TfToken::HashSet& names() const { return _names; }
+
+    bool contains(const std::string& name) const;
+
+    //! Return the child name with the largest numerical suffix among the
+    //! children named \p baseName followed by a suffix, and set \p suffix to
+    //! its value. Returns an empty string if there is no such child.
+    const std::string& largestSuffixName(const std::string& baseName, int& suffix) const;
+
+    //! Add \p name to the children names.
+    void add(const PXR_NS::TfToken& name);
+
+private:
+    void indexSuffix(const std::string& name) const;
+
+    using LargestSuffixes = std::unordered_map<std::string, std::pair<std::string, int>>;
+
+    PXR_NS::TfToken::HashSet _names;
+    mutable LargestSuffixes  _largestSuffixes;
+    mutable bool             _suffixesIndexed { false };
+};
+
+//! Return the names of the children of \p parent. Within a unique child name
+//! batch, the names are collected once per parent and reused, otherwise they
+//! are collected into \p storage.
+USDUFE_PUBLIC
+const ChildrenNames& getChildrenNames(const PXR_NS::UsdPrim& parent, ChildrenNames& storage);
+
+//! Start a unique child name batch. Can be called recursively.
+//! Within a batch, the children names of each parent are collected only once,
+//! and each name returned by uniqueChildName() is added to them, so that
+//! creating many children is linear in the number of children. Only the prims
+//! named through uniqueChildName() must be created under these parents while
+//! the batch is active.
+USDUFE_PUBLIC
+void startUniqueChildNameBatch();
+
+//! Stop a unique child name batch. Can be called recursively.
+USDUFE_PUBLIC
+void stopUniqueChildNameBatch();
+
+//! Start and stop a unique child name batch in the constructor and destructor.
+struct USDUFE_PUBLIC UniqueChildNameBatch
+{
+    UniqueChildNameBatch() { startUniqueChildNameBatch(); }
+    ~UniqueChildNameBatch() { stopUniqueChildNameBatch(); }
+
+    USDUFE_DISALLOW_COPY_MOVE_AND_ASSIGNMENT(UniqueChildNameBatch);
+};
+
 //! Return a unique SdfPath by looking at existing siblings under the path's parent.
 USDUFE_PUBLIC
 PXR_NS::SdfPath uniqueChildPath(const PXR_NS::UsdStage& stage, const PXR_NS::SdfPath& path);
@@ -19,6 +19,7 @@
 
 #include <pxr/base/tf/callContext.h>
 #include <pxr/base/tf/diagnosticLite.h>
+#include <pxr/base/tf/instantiateStacked.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/usd/sdf/primSpec.h>
 #include <pxr/usd/usd/editContext.h>
@@ -29,6 +30,8 @@
 #include <pxr/usd/usd/variantSets.h>
 #include <pxr/usd/usdGeom/gprim.h>
 
+#include <map>
+
 namespace {
 
 UsdUfe::EditRouters& getRegisterdDefaultEditRouters()
@@ -61,6 +64,12 @@ void editTargetLayer(const PXR_NS::VtDictionary& context, PXR_NS::VtDictionary&
 
 } // namespace
 
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_INSTANTIATE_STACKED(UsdUfe::EditRouterCacheScope);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
 namespace USDUFE_NS_DEF {
 
 EditRouter::~EditRouter() { }
@@ -218,24 +227,18 @@ static PXR_NS::SdfLayerHandle _extractLayer(const PXR_NS::VtValue& value)
     return nullptr;
 }
 
-PXR_NS::SdfLayerHandle
-getEditRouterLayer(const PXR_NS::TfToken& operation, const PXR_NS::UsdPrim& prim)
+static PXR_NS::VtDictionary _makeContext(const EditRoutingRequest& request)
 {
-    const auto dstEditRouter = getEditRouter(operation);
-    if (!dstEditRouter)
-        return nullptr;
-
-    // Optimize the case where we have a per-stage layer routing.
-    // This avoid creating dictionaries just to pass and receive a value.
-    if (auto layerRouter = std::dynamic_pointer_cast<LayerPerStageEditRouter>(dstEditRouter))
-        return layerRouter->getLayerForStage(prim.GetStage());
-
     PXR_NS::VtDictionary context;
-    PXR_NS::VtDictionary routingData;
-    context[EditRoutingTokens->Prim] = PXR_NS::VtValue(prim);
-    context[EditRoutingTokens->Operation] = operation;
-    (*dstEditRouter)(context, routingData);
+    context[EditRoutingTokens->Prim] = PXR_NS::VtValue(request.prim);
+    context[EditRoutingTokens->Operation] = request.operation;
+    if (!request.attrName.IsEmpty())
+        context[request.operation] = PXR_NS::VtValue(request.attrName);
+    return context;
+}
 
+static PXR_NS::SdfLayerHandle _extractRoutedLayer(const PXR_NS::VtDictionary& routingData)
+{
     // Try to retrieve the layer from the routing data.
     const auto found = routingData.find(EditRoutingTokens->Layer);
     if (found == routingData.end())
@@ -244,33 +247,159 @@ getEditRouterLayer(const PXR_NS::TfToken& operation, const PXR_NS::UsdPrim& prim
     return _extractLayer(found->second);
 }
 
-PXR_NS::SdfLayerHandle
-getAttrEditRouterLayer(const PXR_NS::UsdPrim& prim, const PXR_NS::TfToken& attrName)
+static PXR_NS::SdfLayerHandle _routeLayer(const EditRoutingRequest& request)
 {
-    static const PXR_NS::TfToken attrOp(EditRoutingTokens->RouteAttribute);
-
-    const EditRouter::Ptr dstEditRouter = getEditRouter(attrOp);
+    const EditRouter::Ptr dstEditRouter = getEditRouter(request.operation);
     if (!dstEditRouter)
         return nullptr;
 
     // Optimize the case where we have a per-stage layer routing.
     // This avoid creating dictionaries just to pass and receive a value.
     if (auto layerRouter = std::dynamic_pointer_cast<LayerPerStageEditRouter>(dstEditRouter))
-        return layerRouter->getLayerForStage(prim.GetStage());
+        return layerRouter->getLayerForStage(request.prim.GetStage());
+
+    PXR_NS::SdfLayerHandle layer;
+    if (EditRouterCacheScope::findLayer(request, layer))
+        return layer;
 
-    PXR_NS::VtDictionary context;
     PXR_NS::VtDictionary routingData;
-    context[EditRoutingTokens->Prim] = PXR_NS::VtValue(prim);
-    context[EditRoutingTokens->Operation] = attrOp;
-    context[attrOp] = PXR_NS::VtValue(attrName);
-    (*dstEditRouter)(context, routingData);
+    (*dstEditRouter)(_makeContext(request), routingData);
+    layer = _extractRoutedLayer(routingData);
 
-    // Try to retrieve the layer from the routing data.
-    const auto found = routingData.find(EditRoutingTokens->Layer);
-    if (found == routingData.end())
-        return nullptr;
+    EditRouterCacheScope::storeLayer(request, layer);
+    return layer;
+}
 
-    return _extractLayer(found->second);
+void EditRouter::routeBatch(
+    const std::vector<PXR_NS::VtDictionary>& contexts,
+    std::vector<PXR_NS::VtDictionary>&       routingData)
+{
+    routingData.resize(contexts.size());
+    for (size_t i = 0; i < contexts.size(); ++i)
+        (*this)(contexts[i], routingData[i]);
+}
+
+bool EditRouterCacheScope::makeKey(const EditRoutingRequest& request, Key& key)
+{
+    // Only memoize valid prims: the prim type is part of the key.
+    if (!request.prim.IsValid())
+        return false;
+
+    key = Key(
+        request.prim.GetStage(),
+        request.operation,
+        request.prim.GetTypeName(),
+        request.attrName);
+    return true;
+}
+
+bool EditRouterCacheScope::findLayer(
+    const EditRoutingRequest& request,
+    PXR_NS::SdfLayerHandle&   layer)
+{
+    const auto& stack = GetStack();
+    if (stack.empty())
+        return false;
+
+    Key key;
+    if (!makeKey(request, key))
+        return false;
+
+    const auto& layers = stack.front()->_layers;
+    const auto  found = layers.find(key);
+    if (found == layers.end())
+        return false;
+
+    layer = found->second;
+    return true;
+}
+
+void EditRouterCacheScope::storeLayer(
+    const EditRoutingRequest&     request,
+    const PXR_NS::SdfLayerHandle& layer)
+{
+    const auto& stack = GetStack();
+    if (stack.empty())
+        return;
+
+    Key key;
+    if (!makeKey(request, key))
+        return;
+
+    // Null layers are memoized too: they mean the edit is not routed.
+    stack.front()->_layers[key] = layer;
+}
+
+PXR_NS::SdfLayerHandle
+getEditRouterLayer(const PXR_NS::TfToken& operation, const PXR_NS::UsdPrim& prim)
+{
+    return _routeLayer({ operation, prim, PXR_NS::TfToken() });
+}
+
+PXR_NS::SdfLayerHandle
+getAttrEditRouterLayer(const PXR_NS::UsdPrim& prim, const PXR_NS::TfToken& attrName)
+{
+    return _routeLayer({ EditRoutingTokens->RouteAttribute, prim, attrName });
+}
+
+PXR_NS::SdfLayerHandleVector getEditRouterLayers(const EditRoutingRequests& requests)
+{
+    PXR_NS::SdfLayerHandleVector layers(requests.size());
+
+    // Group the requests that need to call an edit router by operation, so
+    // that each edit router gets called once with all of its requests.
+    std::map<PXR_NS::TfToken, std::vector<size_t>> pendingByOperation;
+    for (size_t i = 0; i < requests.size(); ++i) {
+        const EditRoutingRequest& request = requests[i];
+
+        const EditRouter::Ptr dstEditRouter = getEditRouter(request.operation);
+        if (!dstEditRouter)
+            continue;
+
+        if (auto layerRouter = std::dynamic_pointer_cast<LayerPerStageEditRouter>(dstEditRouter)) {
+            layers[i] = layerRouter->getLayerForStage(request.prim.GetStage());
+            continue;
+        }
+
+        if (EditRouterCacheScope::findLayer(request, layers[i]))
+            continue;
+
+        pendingByOperation[request.operation].push_back(i);
+    }
+
+    for (const auto& opAndIndices : pendingByOperation) {
+        const EditRouter::Ptr dstEditRouter = getEditRouter(opAndIndices.first);
+
+        // Within a memoization scope, requests sharing a key are only routed
+        // once: the first one reserves the key with a null layer, so that the
+        // other ones are skipped here and get the routed layer afterward.
+        std::vector<size_t>               routedIndices;
+        std::vector<PXR_NS::VtDictionary> contexts;
+        for (const size_t i : opAndIndices.second) {
+            if (EditRouterCacheScope::findLayer(requests[i], layers[i]))
+                continue;
+            EditRouterCacheScope::storeLayer(requests[i], nullptr);
+            routedIndices.push_back(i);
+            contexts.push_back(_makeContext(requests[i]));
+        }
+
+        std::vector<PXR_NS::VtDictionary> routingData;
+        dstEditRouter->routeBatch(contexts, routingData);
+
+        for (size_t j = 0; j < routedIndices.size() && j < routingData.size(); ++j) {
+            const size_t i = routedIndices[j];
+            layers[i] = _extractRoutedLayer(routingData[j]);
+            EditRouterCacheScope::storeLayer(requests[i], layers[i]);
+        }
+
+        if (routedIndices.size() == opAndIndices.second.size())
+            continue;
+
+        for (const size_t i : opAndIndices.second)
+            EditRouterCacheScope::findLayer(requests[i], layers[i]);
+    }
+
+    return layers;
 }
 
 PXR_NS::UsdEditTarget
@@ -19,6 +19,7 @@
 #include <usdUfe/base/api.h>
 
 #include <pxr/base/tf/hashmap.h>
+#include <pxr/base/tf/stacked.h>
 #include <pxr/base/vt/dictionary.h>
 #include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/sdf/types.h>
@@ -26,7 +27,10 @@
 #include <pxr/usd/usd/stage.h>
 
 #include <functional>
+#include <map>
 #include <memory>
+#include <tuple>
+#include <vector>
 
 namespace USDUFE_NS_DEF {
 
@@ -44,6 +48,14 @@ public:
     // so that acceptable defaults can be left unchanged.
     virtual void operator()(const PXR_NS::VtDictionary& context, PXR_NS::VtDictionary& routingData)
         = 0;
+
+    // Compute the routing data of several edits at once, one routing data per
+    // context.  The default implementation calls operator() for each context.
+    // Derived classes can override it to amortize the cost of a call, for
+    // example taking the Python GIL once for the whole batch.
+    virtual void routeBatch(
+        const std::vector<PXR_NS::VtDictionary>& contexts,
+        std::vector<PXR_NS::VtDictionary>&       routingData);
 };
 
 // Wrap an argument edit router callback for storage in the edit router map.
@@ -92,6 +104,50 @@ private:
 using EditRouters
     = PXR_NS::TfHashMap<PXR_NS::TfToken, EditRouter::Ptr, PXR_NS::TfToken::HashFunctor>;
 
+// An edit to route: the operation, the prim it applies to and, for the
+// "attribute" operation, the name of the attribute.
+struct EditRoutingRequest
+{
+    PXR_NS::TfToken operation;
+    PXR_NS::UsdPrim prim;
+    PXR_NS::TfToken attrName;
+};
+
+using EditRoutingRequests = std::vector<EditRoutingRequest>;
+
+// Memoize the layers computed by the edit routers while in scope.
+//
+// Bulk operations that route the same operation or attribute on many prims can
+// use it so that each edit router only gets called once per stage, operation,
+// prim type and attribute name. Since the prim path is not part of that key,
+// this is only correct when the edit routers don't route differently based on
+// the prim path, which is why it is opt-in.
+//
+// Scopes nest, the outermost scope owns the memoized layers. The nesting is
+// per-thread.
+class USDUFE_PUBLIC EditRouterCacheScope : public PXR_NS::TfStacked<EditRouterCacheScope>
+{
+public:
+    EditRouterCacheScope() = default;
+
+    EditRouterCacheScope(const EditRouterCacheScope&) = delete;
+    EditRouterCacheScope& operator=(const EditRouterCacheScope&) = delete;
+
+    // Retrieve the layer memoized for the argument edit in the current scope.
+    // Returns false if there is no scope or nothing was memoized yet.
+    static bool findLayer(const EditRoutingRequest& request, PXR_NS::SdfLayerHandle& layer);
+
+    // Memoize the layer for the argument edit in the current scope, if any.
+    static void storeLayer(const EditRoutingRequest& request, const PXR_NS::SdfLayerHandle& layer);
+
+private:
+    using Key = std::tuple<PXR_NS::UsdStagePtr, PXR_NS::TfToken, PXR_NS::TfToken, PXR_NS::TfToken>;
+
+    static bool makeKey(const EditRoutingRequest& request, Key& key);
+
+    mutable std::map<Key, PXR_NS::SdfLayerHandle> _layers;
+};
+
 // Utility function that returns a layer for the argument operation.
 // If no edit router exists for that operation, a nullptr is returned.
 // The edit router is given the prim in the context with key "prim", and is
@@ -111,6 +167,14 @@ USDUFE_PUBLIC
 PXR_NS::SdfLayerHandle
 getAttrEditRouterLayer(const PXR_NS::UsdPrim& prim, const PXR_NS::TfToken& attrName);
 
+// Utility function that returns the layers for a batch of edits, in the order
+// of the requests. Like getEditRouterLayer() and getAttrEditRouterLayer(), a
+// nullptr is returned for the operations without an edit router. Each edit
+// router is called once for all the requests of its operation, through
+// EditRouter::routeBatch().
+USDUFE_PUBLIC
+PXR_NS::SdfLayerHandleVector getEditRouterLayers(const EditRoutingRequests& requests);
+
 // Utility function that returns a UsdEditTarget for the argument operation.
 // If no edit router exists for that operation, a null UsdEditTarget is returned.
 // The edit router is given the prim in the context with key "prim", and is
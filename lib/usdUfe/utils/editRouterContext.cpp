@@ -70,13 +70,13 @@ PXR_NS::UsdStagePtr StackedEditRouterContext::getStage() const
     return {};
 }
 
-bool StackedEditRouterContext::isTargetAlreadySet() const
+bool StackedEditRouterContext::isTargetAlreadySet(const StackedEditRouterContext* ignored)
 {
     // Use the edit target of a edit router context higher-up in the call
-    // stack only if it is not ourself and if it had been routed to a specific
-    // layer.
+    // stack only if it is not the ignored one and if it had been routed to a
+    // specific layer.
     for (const StackedEditRouterContext* ctx : GetStack())
-        if (ctx && ctx != this && ctx->getLayer())
+        if (ctx && ctx != ignored && ctx->getLayer())
             return true;
 
     return false;
@@ -86,7 +86,7 @@ PXR_NS::SdfLayerHandle OperationEditRouterContext::getOperationLayer(
     const PXR_NS::TfToken& operationName,
     const PXR_NS::UsdPrim& prim)
 {
-    if (isTargetAlreadySet())
+    if (isTargetAlreadySet(this))
         return nullptr;
 
     return getEditRouterLayer(operationName, prim);
@@ -110,7 +110,7 @@ PXR_NS::SdfLayerHandle AttributeEditRouterContext::getAttributeLayer(
     const PXR_NS::UsdPrim& prim,
     const PXR_NS::TfToken& attributeName)
 {
-    if (isTargetAlreadySet())
+    if (isTargetAlreadySet(this))
         return nullptr;
 
     return getAttrEditRouterLayer(prim, attributeName);
@@ -45,11 +45,13 @@ public:
      */
     PXR_NS::UsdStagePtr getStage() const;
 
-protected:
     /*! \brief Check if an edit context higher-up in the call-stack of this
      *         thread already routed the edits to a specific layer.
+     * \param ignored An edit context to ignore, typically the one asking.
      */
-    bool isTargetAlreadySet() const;
+    static bool isTargetAlreadySet(const StackedEditRouterContext* ignored = nullptr);
+
+protected:
 
     /*! \brief Set the edit target of the given stage to the given layer.
      *         If the layer is null, then the target is not changed.
@@ -16,15 +16,91 @@
 
 #include "loadRules.h"
 
+#include <pxr/base/tf/instantiateStacked.h>
+
+#include <algorithm>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_INSTANTIATE_STACKED(UsdUfe::LoadRulesTransaction);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+namespace {
+
+using PathAndRule = std::pair<PXR_NS::SdfPath, PXR_NS::UsdStageLoadRules::Rule>;
+using PathAndRuleVector = std::vector<PathAndRule>;
+
+// The load rules are kept sorted by path, and the paths prefixed by a given
+// path are contiguous in that order. Find the range of rules for the subtree
+// rooted at the given path without scanning all rules.
+std::pair<PathAndRuleVector::const_iterator, PathAndRuleVector::const_iterator>
+findSubtreeRules(const PathAndRuleVector& rules, const PXR_NS::SdfPath& path)
+{
+    return PXR_NS::SdfPathFindPrefixedRange(
+        rules.begin(), rules.end(), path, [](const PathAndRule& rule) -> const PXR_NS::SdfPath& {
+            return rule.first;
+        });
+}
+
+} // namespace
+
 namespace USDUFE_NS_DEF {
 
+LoadRulesTransaction::~LoadRulesTransaction()
+{
+    // Only the outermost transaction applies the pending load rules.
+    const auto& stack = GetStack();
+    if (stack.empty() || stack.front() != this)
+        return;
+
+    for (const auto& stageAndRules : _pendingLoadRules) {
+        const PXR_NS::UsdStagePtr& stage = stageAndRules.first;
+        if (!stage)
+            continue;
+
+        if (stage->GetLoadRules() != stageAndRules.second)
+            stage->SetLoadRules(stageAndRules.second);
+    }
+}
+
+bool LoadRulesTransaction::isActive() { return !GetStack().empty(); }
+
+const PXR_NS::UsdStageLoadRules*
+LoadRulesTransaction::findPendingLoadRules(const PXR_NS::UsdStage& stage)
+{
+    const auto& stack = GetStack();
+    if (stack.empty())
+        return nullptr;
+
+    const PendingLoadRules& pending = stack.front()->_pendingLoadRules;
+
+    const auto found = pending.find(PXR_NS::UsdStagePtr(&stage));
+    if (found == pending.end())
+        return nullptr;
+
+    return &found->second;
+}
+
+bool LoadRulesTransaction::setPendingLoadRules(
+    PXR_NS::UsdStage&                stage,
+    const PXR_NS::UsdStageLoadRules& newLoadRules)
+{
+    const auto& stack = GetStack();
+    if (stack.empty())
+        return false;
+
+    stack.front()->_pendingLoadRules[PXR_NS::UsdStagePtr(&stage)] = newLoadRules;
+    return true;
+}
+
 void duplicateLoadRules(
     PXR_NS::UsdStage&      stage,
     const PXR_NS::SdfPath& fromPath,
     const PXR_NS::SdfPath& destPath)
 {
     // Note: get a *copy* of the rules since we are going to insert new rules as we iterate.
-    auto loadRules = stage.GetLoadRules();
+    auto loadRules = getLoadRules(stage);
 
     // Retrieve the effective rule for the source path.
     //
@@ -47,16 +123,17 @@ void duplicateLoadRules(
     // by a rule on itself or a descendent and not from an ancestor. Then we
     // need to duplicate the load or unload rule.
     //
-    // We do this by iterating over all rules and duplicating all rules that
-    // contain the source path to create rules with the destination path.
-
-    auto oldRules = loadRules.GetRules();
-    for (const auto& rule : oldRules) {
-        const PXR_NS::SdfPath& rulePath = rule.first;
-        if (rulePath.HasPrefix(fromPath)) {
-            const auto newPath = rulePath.ReplacePrefix(fromPath, destPath);
-            loadRules.AddRule(newPath, rule.second);
-        }
+    // We do this by iterating over the rules that contain the source path
+    // and duplicating them to create rules with the destination path.
+
+    const auto& oldRules = loadRules.GetRules();
+    const auto  subtree = findSubtreeRules(oldRules, fromPath);
+
+    // Note: copy the subtree rules since we are going to insert new rules.
+    const PathAndRuleVector subtreeRules(subtree.first, subtree.second);
+    for (const auto& rule : subtreeRules) {
+        const auto newPath = rule.first.ReplacePrefix(fromPath, destPath);
+        loadRules.AddRule(newPath, rule.second);
     }
 
     // Verify if the effective rule at the destination was covered by the
@@ -79,28 +156,30 @@ void duplicateLoadRules(
         loadRules.AddRule(destPath, desiredRule);
     }
 
-    // Update the rules in the load rules object and then in the stage
-    // since we were operating on a copy.
-    stage.SetLoadRules(loadRules);
+    // Update the rules in the stage since we were operating on a copy.
+    setLoadRules(stage, loadRules);
 }
 
 void removeRulesForPath(PXR_NS::UsdStage& stage, const PXR_NS::SdfPath& path)
 {
     // Note: get a *copy* of the rules since we are going to remove rules.
-    auto loadRules = stage.GetLoadRules();
-    auto rules = loadRules.GetRules();
+    auto loadRules = getLoadRules(stage);
 
     // Remove all rules that match the given path.
-    auto newEnd = std::remove_if(rules.begin(), rules.end(), [&path](const auto& rule) {
-        const PXR_NS::SdfPath& rulePath = rule.first;
-        return rulePath.HasPrefix(path);
-    });
-    rules.erase(newEnd, rules.end());
+    const auto& oldRules = loadRules.GetRules();
+    const auto  subtree = findSubtreeRules(oldRules, path);
+    if (subtree.first == subtree.second)
+        return;
+
+    PathAndRuleVector rules;
+    rules.reserve(oldRules.size() - std::distance(subtree.first, subtree.second));
+    rules.insert(rules.end(), oldRules.begin(), subtree.first);
+    rules.insert(rules.end(), subtree.second, oldRules.end());
 
     // Update the rules in the load rules object and then in the stage
     // since we were operating on a copy.
     loadRules.SetRules(rules);
-    stage.SetLoadRules(loadRules);
+    setLoadRules(stage, loadRules);
 }
 
 } // namespace USDUFE_NS_DEF
@@ -18,14 +18,57 @@
 
 #include <usdUfe/base/api.h>
 
+#include <pxr/base/tf/stacked.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/stageLoadRules.h>
 
+#include <map>
 #include <string.h>
 
 namespace USDUFE_NS_DEF {
 
+/*! \brief batch the load rules modifications made while in scope.
+ *
+ * Setting the load rules of a stage recomposes it, so commands modifying the load rules of many
+ * prims in a row should do so within a transaction. Within a transaction, getLoadRules() and
+ * setLoadRules(), and the functions built on them such as duplicateLoadRules(), work on a pending
+ * copy of the load rules of each stage. The pending load rules are applied to the stages, with a
+ * single UsdStage::SetLoadRules() per stage, when the outermost transaction ends.
+ *
+ * Transactions nest. The nesting is per-thread.
+ */
+class USDUFE_PUBLIC LoadRulesTransaction : public PXR_NS::TfStacked<LoadRulesTransaction>
+{
+public:
+    LoadRulesTransaction() = default;
+    ~LoadRulesTransaction();
+
+    LoadRulesTransaction(const LoadRulesTransaction&) = delete;
+    LoadRulesTransaction& operator=(const LoadRulesTransaction&) = delete;
+
+    /*! \brief verify if a transaction is in progress on this thread.
+     */
+    static bool isActive();
+
+    /*! \brief retrieve the pending load rules of the stage, if any.
+     * \return null if no transaction is in progress or the stage load rules were not modified.
+     */
+    static const PXR_NS::UsdStageLoadRules* findPendingLoadRules(const PXR_NS::UsdStage& stage);
+
+    /*! \brief set the pending load rules of the stage.
+     * \return false if no transaction is in progress.
+     */
+    static bool setPendingLoadRules(
+        PXR_NS::UsdStage&                stage,
+        const PXR_NS::UsdStageLoadRules& newLoadRules);
+
+private:
+    using PendingLoadRules = std::map<PXR_NS::UsdStagePtr, PXR_NS::UsdStageLoadRules>;
+
+    mutable PendingLoadRules _pendingLoadRules;
+};
+
 /*! \brief modify the stage load rules so that the rules governing fromPath are replicated for
  * destPath.
  */
@@ -50,7 +93,14 @@ std::string convertLoadRulesToText(const PXR_NS::UsdStage& stage);
 USDUFE_PUBLIC
 void setLoadRulesFromText(PXR_NS::UsdStage& stage, const std::string& text);
 
+/*! \brief get the stage load rules, including the modifications pending in a transaction.
+ */
+USDUFE_PUBLIC
+PXR_NS::UsdStageLoadRules getLoadRules(const PXR_NS::UsdStage& stage);
+
 /*! \brief set the stage load rules if they are different from the current ones.
+ *
+ * Within a LoadRulesTransaction, the load rules are only applied when the transaction ends.
  */
 USDUFE_PUBLIC
 void setLoadRules(PXR_NS::UsdStage& stage, const PXR_NS::UsdStageLoadRules& newLoadRules);
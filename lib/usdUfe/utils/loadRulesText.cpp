@@ -22,7 +22,7 @@ namespace USDUFE_NS_DEF {
 
 std::string convertLoadRulesToText(const PXR_NS::UsdStage& stage)
 {
-    return convertLoadRulesToText(stage.GetLoadRules());
+    return convertLoadRulesToText(getLoadRules(stage));
 }
 
 void setLoadRulesFromText(PXR_NS::UsdStage& stage, const std::string& text)
@@ -30,13 +30,24 @@ void setLoadRulesFromText(PXR_NS::UsdStage& stage, const std::string& text)
     setLoadRules(stage, createLoadRulesFromText(text));
 }
 
+PXR_NS::UsdStageLoadRules getLoadRules(const PXR_NS::UsdStage& stage)
+{
+    if (auto pendingLoadRules = LoadRulesTransaction::findPendingLoadRules(stage))
+        return *pendingLoadRules;
+
+    return stage.GetLoadRules();
+}
+
 void setLoadRules(PXR_NS::UsdStage& stage, const PXR_NS::UsdStageLoadRules& newLoadRules)
 {
+    if (LoadRulesTransaction::setPendingLoadRules(stage, newLoadRules))
+        return;
+
     if (stage.GetLoadRules() != newLoadRules)
         stage.SetLoadRules(newLoadRules);
 }
 
-static std::string convertRuleToText(const PXR_NS::UsdStageLoadRules::Rule rule)
+static const char* convertRuleToText(const PXR_NS::UsdStageLoadRules::Rule rule)
 {
     // Note: using namespace required for the TF_WARN macro.
     PXR_NAMESPACE_USING_DIRECTIVE
@@ -49,25 +60,26 @@ static std::string convertRuleToText(const PXR_NS::UsdStageLoadRules::Rule rule)
     }
 }
 
-static std::string
-convertPerPathRuleToText(const PXR_NS::SdfPath& path, const PXR_NS::UsdStageLoadRules::Rule rule)
+std::string convertLoadRulesToText(const PXR_NS::UsdStageLoadRules& rules)
 {
-    // Note: using namespace required for the TfStringfPrintf macro.
-    PXR_NAMESPACE_USING_DIRECTIVE
+    const auto& perPathRules = rules.GetRules();
 
-    return TfStringPrintf("%s=%s", path.GetAsString().c_str(), convertRuleToText(rule).c_str());
-}
+    // Stages can have thousands of rules, so size the text once and append
+    // each rule in place instead of formatting it into a temporary string.
+    size_t textSize = 0;
+    for (const auto& pathAndRule : perPathRules)
+        textSize += pathAndRule.first.GetString().size() + 6;
 
-std::string convertLoadRulesToText(const PXR_NS::UsdStageLoadRules& rules)
-{
     std::string text;
+    text.reserve(textSize);
 
-    const auto& perPathRules = rules.GetRules();
     for (const auto& pathAndRule : perPathRules) {
         if (!text.empty())
-            text += ";";
+            text += ';';
 
-        text += convertPerPathRuleToText(pathAndRule.first, pathAndRule.second);
+        text += pathAndRule.first.GetString();
+        text += '=';
+        text += convertRuleToText(pathAndRule.second);
     }
 
     return text;
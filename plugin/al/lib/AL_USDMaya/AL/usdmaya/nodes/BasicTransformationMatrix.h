@@ -71,6 +71,10 @@ public:
 
     virtual void initialiseToPrim(bool readFromPrim = true, Scope* node = 0) { }
 
+    /// \brief  flags the cached time-varying state of the xform ops as stale, so that it will be
+    /// re-evaluated on the next time change. Called when the xform ops of the prim are edited.
+    virtual void invalidateTimeVaryingOps() { }
+
     /// \brief  the type ID of the transformation matrix
     AL_USDMAYA_PUBLIC
     static const MTypeId kTypeId;
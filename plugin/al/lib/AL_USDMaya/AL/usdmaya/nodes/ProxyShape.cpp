@@ -48,6 +48,7 @@
 #include <pxr/usd/usd/stageCacheContext.h>
 #include <pxr/usd/usdGeom/imageable.h>
 #include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdGeom/xformOp.h>
 #include <pxr/usd/usdUtils/stageCache.h>
 #include <pxr/usdImaging/usdImaging/delegate.h>
 
@@ -923,11 +924,15 @@ void ProxyShape::onObjectsChanged(
     UsdNotice::ObjectsChanged const& notice,
     UsdStageWeakPtr const&           sender)
 {
-    if (m_ignoringUpdates || MFileIO::isReadingFile()
-        || AL::usdmaya::utils::BlockNotifications::isBlockingNotifications())
+    if (!sender || sender != m_stage)
         return;
 
-    if (!sender || sender != m_stage)
+    // the cached time-varying state of the transforms must follow every edit, including the ones
+    // made while the updates are ignored or blocked, or inside a transaction
+    invalidateTimeVaryingOps(notice);
+
+    if (m_ignoringUpdates || MFileIO::isReadingFile()
+        || AL::usdmaya::utils::BlockNotifications::isBlockingNotifications())
         return;
 
     TF_DEBUG(ALUSDMAYA_EVENTS)
@@ -953,6 +958,38 @@ void ProxyShape::onObjectsChanged(
     }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void ProxyShape::invalidateTimeVaryingOps(UsdNotice::ObjectsChanged const& notice)
+{
+    // the transforms cache which of their xform ops are animated, so let them know when the xform
+    // ops of their prim (or of any of its ancestors, for resyncs) have been edited. Layer stack
+    // changes, such as muting or inserting a sublayer, resync the pseudo-root.
+    auto invalidate = [](TransformReferenceMap::iterator it) {
+        Scope* tm = it->second.getTransformNode();
+        if (tm && tm->transform()) {
+            tm->transform()->invalidateTimeVaryingOps();
+        }
+    };
+    for (const SdfPath& path : notice.GetResyncedPaths()) {
+        const SdfPath primPath = path.GetPrimPath();
+        for (auto it = m_requiredPaths.lower_bound(primPath);
+             it != m_requiredPaths.end() && it->first.HasPrefix(primPath);
+             ++it) {
+            invalidate(it);
+        }
+    }
+    for (const SdfPath& path : notice.GetChangedInfoOnlyPaths()) {
+        if (path.IsPrimPropertyPath()
+            && (UsdGeomXformOp::IsXformOp(path.GetNameToken())
+                || path.GetNameToken() == UsdGeomTokens->xformOpOrder)) {
+            auto it = m_requiredPaths.find(path.GetPrimPath());
+            if (it != m_requiredPaths.end()) {
+                invalidate(it);
+            }
+        }
+    }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void ProxyShape::validateTransforms()
 {
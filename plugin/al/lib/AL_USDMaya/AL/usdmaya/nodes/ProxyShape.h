@@ -957,6 +957,7 @@ private:
         SdfNotice::LayerIdentifierDidChange const& notice,
         UsdStageWeakPtr const&                     sender);
     void onObjectsChanged(UsdNotice::ObjectsChanged const&, UsdStageWeakPtr const& sender);
+    void invalidateTimeVaryingOps(UsdNotice::ObjectsChanged const& notice);
     void variantSelectionListener(SdfNotice::LayersDidChange const& notice);
     void onEditTargetChanged(
         UsdNotice::StageEditTargetChanged const& notice,
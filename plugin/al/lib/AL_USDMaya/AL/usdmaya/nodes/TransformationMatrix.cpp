@@ -920,6 +920,7 @@ void TransformationMatrix::initialiseToPrim(bool readFromPrim, Scope* transformN
     bool resetsXformStack = false;
     m_xformops = m_xform.GetOrderedXformOps(&resetsXformStack);
     m_orderedOps.resize(m_xformops.size());
+    m_timeVaryingOpsDirty = true;
 
     if (!resetsXformStack) {
         m_flags |= kInheritsTransform;
@@ -1170,6 +1171,28 @@ void TransformationMatrix::initialiseToPrim(bool readFromPrim, Scope* transformN
     }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void TransformationMatrix::updateTimeVaryingOps()
+{
+    // ops inserted by the insert*Op methods change the size of the stack without a re-initialise
+    if (!m_timeVaryingOpsDirty && m_timeVaryingOps.size() == m_xformops.size()) {
+        return;
+    }
+
+    MProfilingScope profilerScope(
+        _transformationMatrixProfilerCategory, MProfiler::kColorE_L3, "Update time varying ops");
+
+    m_timeVaryingOpsDirty = false;
+    m_hasTimeVaryingOps = false;
+    m_timeVaryingOps.assign(m_xformops.size(), false);
+    for (size_t i = 0, n = m_xformops.size(); i < n; ++i) {
+        if (m_xformops[i].GetNumTimeSamples() >= 1) {
+            m_timeVaryingOps[i] = true;
+            m_hasTimeVaryingOps = true;
+        }
+    }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void TransformationMatrix::updateToTime(const UsdTimeCode& time)
 {
@@ -1184,75 +1207,76 @@ void TransformationMatrix::updateToTime(const UsdTimeCode& time)
     }
     if (m_time != time) {
         m_time = time;
+
+        // static transforms have nothing to read back from USD
+        updateTimeVaryingOps();
+        if (!m_hasTimeVaryingOps) {
+            return;
+        }
+
         {
             auto opIt = m_orderedOps.begin();
+            auto timeVaryingIt = m_timeVaryingOps.begin();
             for (std::vector<UsdGeomXformOp>::const_iterator it = m_xformops.begin(),
                                                              e = m_xformops.end();
                  it != e;
-                 ++it, ++opIt) {
+                 ++it, ++opIt, ++timeVaryingIt) {
+                if (!*timeVaryingIt) {
+                    continue;
+                }
                 const UsdGeomXformOp& op = *it;
                 switch (*opIt) {
                 case kTranslate: {
-                    if (op.GetNumTimeSamples() >= 1) {
-                        m_flags |= kAnimatedTranslation;
-                        internal_readVector(m_translationFromUsd, op);
-                        MPxTransformationMatrix::translationValue
-                            = m_translationFromUsd + m_translationTweak;
-                    }
+                    m_flags |= kAnimatedTranslation;
+                    internal_readVector(m_translationFromUsd, op);
+                    MPxTransformationMatrix::translationValue
+                        = m_translationFromUsd + m_translationTweak;
                 } break;
 
                 case kRotate: {
-                    if (op.GetNumTimeSamples() >= 1) {
-                        m_flags |= kAnimatedRotation;
-                        internal_readRotation(m_rotationFromUsd, op);
-                        MPxTransformationMatrix::rotationValue = m_rotationFromUsd;
-                        MPxTransformationMatrix::rotationValue.x += m_rotationTweak.x;
-                        MPxTransformationMatrix::rotationValue.y += m_rotationTweak.y;
-                        MPxTransformationMatrix::rotationValue.z += m_rotationTweak.z;
-                    }
+                    m_flags |= kAnimatedRotation;
+                    internal_readRotation(m_rotationFromUsd, op);
+                    MPxTransformationMatrix::rotationValue = m_rotationFromUsd;
+                    MPxTransformationMatrix::rotationValue.x += m_rotationTweak.x;
+                    MPxTransformationMatrix::rotationValue.y += m_rotationTweak.y;
+                    MPxTransformationMatrix::rotationValue.z += m_rotationTweak.z;
                 } break;
 
                 case kScale: {
-                    if (op.GetNumTimeSamples() >= 1) {
-                        m_flags |= kAnimatedScale;
-                        internal_readVector(m_scaleFromUsd, op);
-                        MPxTransformationMatrix::scaleValue = m_scaleFromUsd + m_scaleTweak;
-                    }
+                    m_flags |= kAnimatedScale;
+                    internal_readVector(m_scaleFromUsd, op);
+                    MPxTransformationMatrix::scaleValue = m_scaleFromUsd + m_scaleTweak;
                 } break;
 
                 case kShear: {
-                    if (op.GetNumTimeSamples() >= 1) {
-                        m_flags |= kAnimatedShear;
-                        internal_readShear(m_shearFromUsd, op);
-                        MPxTransformationMatrix::shearValue = m_shearFromUsd + m_shearTweak;
-                    }
+                    m_flags |= kAnimatedShear;
+                    internal_readShear(m_shearFromUsd, op);
+                    MPxTransformationMatrix::shearValue = m_shearFromUsd + m_shearTweak;
                 } break;
 
                 case kTransform: {
-                    if (op.GetNumTimeSamples() >= 1) {
-                        m_flags |= kAnimatedMatrix;
-                        GfMatrix4d matrix;
-                        matrix.SetIdentity();
-                        op.Get<GfMatrix4d>(&matrix, getTimeCode());
-                        double T[3] {};
-                        double S[3] {};
-                        AL::usdmaya::utils::matrixToSRT(matrix, S, m_rotationFromUsd, T);
-                        m_scaleFromUsd.x = S[0];
-                        m_scaleFromUsd.y = S[1];
-                        m_scaleFromUsd.z = S[2];
-                        m_translationFromUsd.x = T[0];
-                        m_translationFromUsd.y = T[1];
-                        m_translationFromUsd.z = T[2];
-                        MPxTransformationMatrix::rotationValue.x
-                            = m_rotationFromUsd.x + m_rotationTweak.x;
-                        MPxTransformationMatrix::rotationValue.y
-                            = m_rotationFromUsd.y + m_rotationTweak.y;
-                        MPxTransformationMatrix::rotationValue.z
-                            = m_rotationFromUsd.z + m_rotationTweak.z;
-                        MPxTransformationMatrix::translationValue
-                            = m_translationFromUsd + m_translationTweak;
-                        MPxTransformationMatrix::scaleValue = m_scaleFromUsd + m_scaleTweak;
-                    }
+                    m_flags |= kAnimatedMatrix;
+                    GfMatrix4d matrix;
+                    matrix.SetIdentity();
+                    op.Get<GfMatrix4d>(&matrix, getTimeCode());
+                    double T[3] {};
+                    double S[3] {};
+                    AL::usdmaya::utils::matrixToSRT(matrix, S, m_rotationFromUsd, T);
+                    m_scaleFromUsd.x = S[0];
+                    m_scaleFromUsd.y = S[1];
+                    m_scaleFromUsd.z = S[2];
+                    m_translationFromUsd.x = T[0];
+                    m_translationFromUsd.y = T[1];
+                    m_translationFromUsd.z = T[2];
+                    MPxTransformationMatrix::rotationValue.x
+                        = m_rotationFromUsd.x + m_rotationTweak.x;
+                    MPxTransformationMatrix::rotationValue.y
+                        = m_rotationFromUsd.y + m_rotationTweak.y;
+                    MPxTransformationMatrix::rotationValue.z
+                        = m_rotationFromUsd.z + m_rotationTweak.z;
+                    MPxTransformationMatrix::translationValue
+                        = m_translationFromUsd + m_translationTweak;
+                    MPxTransformationMatrix::scaleValue = m_scaleFromUsd + m_scaleTweak;
                 } break;
 
                 default: break;
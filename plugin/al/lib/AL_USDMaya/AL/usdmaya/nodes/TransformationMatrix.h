@@ -50,6 +50,13 @@ class TransformationMatrix : public BasicTransformationMatrix
     std::vector<UsdGeomXformOp>     m_xformops;
     std::vector<TransformOperation> m_orderedOps;
 
+    // whether each of the xform ops has time samples. This is cached so that updateToTime does not
+    // need to count the samples of every op on each frame, and is rebuilt lazily whenever the op
+    // stack changes or the xform ops of the prim (or the layers of its stage) are edited.
+    std::vector<bool> m_timeVaryingOps;
+    bool              m_hasTimeVaryingOps = false;
+    bool              m_timeVaryingOpsDirty = true;
+
     // tweak values. These are applied on top of the USD transform values to produce the final
     // result.
     MVector        m_scaleTweak;
@@ -111,6 +118,9 @@ class TransformationMatrix : public BasicTransformationMatrix
     void insertRotatePivotTranslationOp();
     void insertRotateAxesOp();
 
+    // rebuilds the time-varying flags of the xform ops, if they are stale.
+    void updateTimeVaryingOps();
+
     enum Flags
     {
         // describe which components are animated
@@ -364,6 +374,10 @@ class TransformationMatrix : public BasicTransformationMatrix
     /// \param  time the new timecode
     void updateToTime(const UsdTimeCode& time);
 
+    /// \brief  flags the cached time-varying state of the xform ops as stale. The ProxyShape calls
+    /// this when an xform op of the prim has been edited.
+    void invalidateTimeVaryingOps() override { m_timeVaryingOpsDirty = true; }
+
     /// \brief  pushes any modifications on the matrix back onto the UsdPrim
     void pushToPrim();
 
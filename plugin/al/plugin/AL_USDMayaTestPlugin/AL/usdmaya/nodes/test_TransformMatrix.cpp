@@ -1425,6 +1425,78 @@ TEST(Transform, getTimeCode)
     }
 }
 
+// Static xform ops are skipped by updateToTime, so make sure that time samples authored after the
+// transform has been created are picked up.
+TEST(Transform, timeSamplesAddedToStaticOps)
+{
+    auto constructTransformChain = []() {
+        UsdStageRefPtr stage = UsdStage::CreateInMemory();
+        UsdGeomXform   a = UsdGeomXform::Define(stage, SdfPath("/tm"));
+        a.AddTranslateOp(UsdGeomXformOp::PrecisionDouble).Set(GfVec3d(1.0, 2.0, 3.0));
+        return stage;
+    };
+
+    MFileIO::newFile(true);
+
+    const std::string temp_path
+        = buildTempPath("AL_USDMayaTests_transform_timeSamplesAddedToStaticOps.usda");
+
+    // generate some data for the proxy shape
+    {
+        auto stage = constructTransformChain();
+        stage->Export(temp_path, false);
+    }
+
+    MFnDagNode fn;
+    MObject    xform = fn.create("transform");
+    MObject    shape = fn.create("AL_usdmaya_ProxyShape", xform);
+
+    AL::usdmaya::nodes::ProxyShape* proxy = (AL::usdmaya::nodes::ProxyShape*)fn.userNode();
+
+    // force the stage to load
+    proxy->filePathPlug().setString(temp_path.c_str());
+
+    auto stage = proxy->getUsdStage();
+
+    MDagModifier modifier1;
+    MDGModifier  modifier2;
+
+    MObject leafNode = proxy->makeUsdTransforms(
+        stage->GetPrimAtPath(SdfPath("/tm")),
+        modifier1,
+        AL::usdmaya::nodes::ProxyShape::kRequested,
+        &modifier2);
+
+    EXPECT_FALSE(leafNode == MObject::kNullObj);
+    EXPECT_EQ(MStatus(MS::kSuccess), modifier1.doIt());
+    EXPECT_EQ(MStatus(MS::kSuccess), modifier2.doIt());
+
+    MFnTransform                   fnx(leafNode);
+    AL::usdmaya::nodes::Transform* transformNode = (AL::usdmaya::nodes::Transform*)fnx.userNode();
+
+    AL::usdmaya::nodes::TransformationMatrix* transformMatrix = transformNode->getTransMatrix();
+
+    transformNode->pushToPrimPlug().setValue(false);
+    transformNode->readAnimatedValuesPlug().setValue(true);
+
+    transformMatrix->updateToTime(UsdTimeCode(1.0));
+    EXPECT_FALSE(transformMatrix->hasAnimatedTranslation());
+
+    // animate the op directly on the stage, the proxy shape should flag the cached state as stale
+    UsdGeomXformable            xformable(stage->GetPrimAtPath(SdfPath("/tm")));
+    bool                        resetsXformStack = false;
+    std::vector<UsdGeomXformOp> ops = xformable.GetOrderedXformOps(&resetsXformStack);
+    ASSERT_EQ(1u, ops.size());
+    ops[0].Set(GfVec3d(4.0, 5.0, 6.0), UsdTimeCode(10.0));
+
+    transformMatrix->updateToTime(UsdTimeCode(10.0));
+    EXPECT_TRUE(transformMatrix->hasAnimatedTranslation());
+    const MVector translation = transformMatrix->translation(MSpace::kTransform);
+    EXPECT_NEAR(4.0, translation.x, 1e-5);
+    EXPECT_NEAR(5.0, translation.y, 1e-5);
+    EXPECT_NEAR(6.0, translation.z, 1e-5);
+}
+
 // Need to test the behaviour of the transform node when the animation data present is from Matrices
 // rather than TRS components.
 TEST(Transform, matrixAnimationChannels) { AL_USDMAYA_UNTESTED; }
@@ -59,6 +59,65 @@ class testPointBasedDeformerNode(unittest.TestCase):
 
         self.assertTrue(Gf.IsClose(cpPosition, expectedPosition, self.EPSILON))
 
+    def _CreateDeformedCube(self):
+        timeUnit = OM.MTime.uiUnit()
+        OMA.MAnimControl.setAnimationStartEndTime(
+            OM.MTime(self.START_TIMECODE, timeUnit), OM.MTime(self.END_TIMECODE, timeUnit))
+        cmds.currentTime(self.START_TIMECODE)
+
+        testCube = cmds.polyCube(depth=1.0, height=1.0, width=1.0)[0]
+
+        stageNode = cmds.createNode('pxrUsdStageNode')
+        cmds.setAttr('%s.filePath' % stageNode, self._deformingCubeUsdFilePath,
+            type='string')
+
+        cmds.select(testCube, replace=True)
+
+        deformerNode = cmds.deformer(type='pxrUsdPointBasedDeformerNode')[0]
+        cmds.setAttr('%s.primPath' % deformerNode, self._deformingCubePrimPath,
+            type='string')
+        cmds.connectAttr('%s.outUsdStage' % stageNode,
+            '%s.inUsdStage' % deformerNode)
+        cmds.connectAttr('time1.outTime', '%s.time' % deformerNode)
+
+        return testCube, deformerNode
+
+    def _ValidateVertexPositions(self, nodeName, expectedPositions):
+        positions = cmds.xform('%s.vtx[*]' % nodeName, query=True,
+            objectSpace=True, translation=True)
+        self.assertEqual(len(positions), 3 * len(expectedPositions))
+        for i, expectedPosition in enumerate(expectedPositions):
+            position = Gf.Vec3d(positions[3 * i:3 * i + 3])
+            self.assertTrue(Gf.IsClose(position, expectedPosition, self.EPSILON),
+                'vertex %d is at %s instead of %s' % (i, position, expectedPosition))
+
+    def testCubeDeformedPositions(self):
+        """
+        Tests that all the points of a native Maya mesh are moved to the USD
+        points, that the envelope blends the Maya and USD points, and that
+        evaluating again at a previous time gives back the same points.
+        """
+        testCube, deformerNode = self._CreateDeformedCube()
+
+        # At the start time, the USD cube is the Maya cube scaled twice.
+        usdPoints = [
+            Gf.Vec3d(-1.0, -1.0, 1.0), Gf.Vec3d(1.0, -1.0, 1.0),
+            Gf.Vec3d(-1.0, 1.0, 1.0), Gf.Vec3d(1.0, 1.0, 1.0),
+            Gf.Vec3d(-1.0, 1.0, -1.0), Gf.Vec3d(1.0, 1.0, -1.0),
+            Gf.Vec3d(-1.0, -1.0, -1.0), Gf.Vec3d(1.0, -1.0, -1.0)]
+        self._ValidateVertexPositions(testCube, usdPoints)
+
+        # Half the envelope moves the Maya points half way to the USD points.
+        cmds.setAttr('%s.envelope' % deformerNode, 0.5)
+        self._ValidateVertexPositions(testCube, [0.75 * p for p in usdPoints])
+
+        cmds.setAttr('%s.envelope' % deformerNode, 1.0)
+        cmds.currentTime(self.MID_TIMECODE)
+        self._ValidateControlPoint(testCube, 0, Gf.Vec3d(0.0, -1.0, 1.0))
+
+        cmds.currentTime(self.START_TIMECODE)
+        self._ValidateVertexPositions(testCube, usdPoints)
+
     def testCubeWithDeformer(self):
         """
         Tests that a native Maya mesh is deformed correctly by a point based
@@ -0,0 +1,53 @@
+#include <hdMaya/delegates/delegate.h>
+
+#include <pxr/base/work/loops.h>
+#include <pxr/imaging/hd/engine.h>
+#include <pxr/imaging/hd/tokens.h>
+
+#include <gtest/gtest.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// A delegate that populates nothing, only used for its motion sampling.
+class TestDelegate final : public HdMayaDelegate
+{
+public:
+    TestDelegate(const InitData& initData)
+        : HdMayaDelegate(initData)
+    {
+    }
+
+    void Populate() override { }
+};
+
+} // namespace
+
+TEST(HdMayaDelegate, requestedSampleCountKeepsLargest)
+{
+    HdEngine     engine;
+    TestDelegate delegate(HdMayaDelegate::InitData(
+        TfToken("test"), engine, nullptr, nullptr, nullptr, SdfPath("/test"), false));
+    EXPECT_EQ(delegate.GetRequestedSampleCount(), 0u);
+
+    // Rprims request their sample counts while syncing in parallel. Motion blur is off, so each
+    // request returns a single sample without switching the DG context.
+    const size_t   maxSampleCount = 10000;
+    const SdfPath  id("/shape");
+    const TfToken& key = HdTokens->points;
+    WorkParallelForN(maxSampleCount, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            float times[1];
+            int   samples[1];
+            delegate.SampleValues(id, key, i + 1, times, samples, [i]() { return int(i); });
+        }
+    });
+    EXPECT_EQ(delegate.GetRequestedSampleCount(), maxSampleCount);
+
+    // A smaller request does not lower the count used by the prepass.
+    float times[1];
+    int   samples[1];
+    delegate.SampleValues(id, key, 2, times, samples, []() { return 0; });
+    EXPECT_EQ(delegate.GetRequestedSampleCount(), maxSampleCount);
+}
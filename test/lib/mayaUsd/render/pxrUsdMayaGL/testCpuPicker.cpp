@@ -0,0 +1,227 @@
+#include <mayaUsd/render/pxrUsdMayaGL/cpuPicker.h>
+
+#include <pxr/base/gf/frustum.h>
+#include <pxr/base/gf/matrix4f.h>
+#include <pxr/base/gf/range1d.h>
+#include <pxr/base/gf/range2d.h>
+#include <pxr/imaging/hd/changeTracker.h>
+#include <pxr/imaging/hd/mesh.h>
+#include <pxr/imaging/hd/renderDelegate.h>
+#include <pxr/imaging/hd/renderIndex.h>
+#include <pxr/imaging/hd/repr.h>
+#include <pxr/imaging/hd/resourceRegistry.h>
+#include <pxr/imaging/hd/tokens.h>
+#include <pxr/imaging/hd/unitTestDelegate.h>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// A mesh that only syncs its visibility, which is all the picker reads from
+// the rprims themselves, everything else being read from the scene delegate.
+class TestMesh final : public HdMesh
+{
+public:
+    TestMesh(const SdfPath& id)
+        : HdMesh(id)
+    {
+    }
+
+    HdDirtyBits GetInitialDirtyBitsMask() const override
+    {
+        return HdChangeTracker::AllSceneDirtyBits;
+    }
+
+    void Sync(HdSceneDelegate* delegate, HdRenderParam*, HdDirtyBits* dirtyBits, const TfToken&)
+        override
+    {
+        _UpdateVisibility(delegate, dirtyBits);
+        *dirtyBits &= ~HdChangeTracker::AllSceneDirtyBits;
+    }
+
+protected:
+    HdDirtyBits _PropagateDirtyBits(HdDirtyBits bits) const override { return bits; }
+
+    void _InitRepr(const TfToken&, HdDirtyBits*) override { }
+};
+
+// A render delegate that draws nothing, and only creates meshes.
+class TestRenderDelegate final : public HdRenderDelegate
+{
+public:
+    const TfTokenVector& GetSupportedRprimTypes() const override
+    {
+        static const TfTokenVector types = { HdPrimTypeTokens->mesh };
+        return types;
+    }
+
+    const TfTokenVector& GetSupportedSprimTypes() const override
+    {
+        static const TfTokenVector types;
+        return types;
+    }
+
+    const TfTokenVector& GetSupportedBprimTypes() const override
+    {
+        static const TfTokenVector types;
+        return types;
+    }
+
+    HdResourceRegistrySharedPtr GetResourceRegistry() const override { return _resourceRegistry; }
+
+    HdRenderPassSharedPtr CreateRenderPass(HdRenderIndex*, HdRprimCollection const&) override
+    {
+        return nullptr;
+    }
+
+    HdInstancer* CreateInstancer(
+        HdSceneDelegate*,
+#if defined(HD_API_VERSION) && HD_API_VERSION >= 36
+        SdfPath const&) override
+#else
+        SdfPath const&,
+        SdfPath const&) override
+#endif
+    {
+        return nullptr;
+    }
+
+    void DestroyInstancer(HdInstancer*) override { }
+
+    HdRprim* CreateRprim(
+        TfToken const&,
+#if defined(HD_API_VERSION) && HD_API_VERSION >= 36
+        SdfPath const& rprimId) override
+#else
+        SdfPath const& rprimId,
+        SdfPath const&) override
+#endif
+    {
+        TestMesh* mesh = new TestMesh(rprimId);
+        meshes[rprimId] = mesh;
+        return mesh;
+    }
+
+    void DestroyRprim(HdRprim* rPrim) override
+    {
+        meshes.erase(rPrim->GetId());
+        delete rPrim;
+    }
+
+    HdSprim* CreateSprim(TfToken const&, SdfPath const&) override { return nullptr; }
+    HdSprim* CreateFallbackSprim(TfToken const&) override { return nullptr; }
+    void     DestroySprim(HdSprim*) override { }
+
+    HdBprim* CreateBprim(TfToken const&, SdfPath const&) override { return nullptr; }
+    HdBprim* CreateFallbackBprim(TfToken const&) override { return nullptr; }
+    void     DestroyBprim(HdBprim*) override { }
+
+    void CommitResources(HdChangeTracker*) override { }
+
+    std::map<SdfPath, TestMesh*> meshes;
+
+private:
+    HdResourceRegistrySharedPtr _resourceRegistry = std::make_shared<HdResourceRegistry>();
+};
+
+class CpuPickerTest : public ::testing::Test
+{
+protected:
+    CpuPickerTest()
+        : _renderIndex(HdRenderIndex::New(&_renderDelegate, HdDriverVector()))
+        , _sceneDelegate(_renderIndex.get(), SdfPath::AbsoluteRootPath())
+    {
+    }
+
+    // Sync the dirty meshes the way the batch renderer does when drawing:
+    // the picker tracks the changes first, and hidden meshes are only synced
+    // when their visibility changes.
+    void draw()
+    {
+        _picker.TrackChanges(*_renderIndex);
+
+        HdChangeTracker& changeTracker = _renderIndex->GetChangeTracker();
+        for (const auto& idAndMesh : _renderDelegate.meshes) {
+            HdDirtyBits dirtyBits = changeTracker.GetRprimDirtyBits(idAndMesh.first);
+            if (!idAndMesh.second->IsVisible()
+                && !(dirtyBits & HdChangeTracker::DirtyVisibility)) {
+                continue;
+            }
+
+            idAndMesh.second->Sync(&_sceneDelegate, nullptr, &dirtyBits, HdReprTokens->hull);
+            changeTracker.MarkRprimClean(idAndMesh.first, dirtyBits);
+        }
+    }
+
+    // Pick through the center of the scene, looking down the Z axis.
+    HdxPickHitVector pick()
+    {
+        GfFrustum frustum;
+        frustum.SetPosition(GfVec3d(0.0, 0.0, 10.0));
+        frustum.SetProjectionType(GfFrustum::Orthographic);
+        frustum.SetWindow(GfRange2d(GfVec2d(-0.1, -0.1), GfVec2d(0.1, 0.1)));
+        frustum.SetNearFar(GfRange1d(1.0, 100.0));
+
+        const HdRprimCollection collection(HdTokens->geometry, HdReprSelector(HdReprTokens->hull));
+
+        HdxPickHitVector hits;
+        EXPECT_TRUE(_picker.TestIntersection(
+            *_renderIndex,
+            collection,
+            { HdTokens->geometry },
+            frustum.ComputeViewMatrix(),
+            frustum.ComputeProjectionMatrix(),
+            GfVec2i(4, 4),
+            true,
+            &hits));
+        return hits;
+    }
+
+    TestRenderDelegate             _renderDelegate;
+    std::unique_ptr<HdRenderIndex> _renderIndex;
+    HdUnitTestDelegate             _sceneDelegate;
+    UsdMayaGLCpuPicker             _picker;
+};
+
+} // namespace
+
+TEST_F(CpuPickerTest, pickCube)
+{
+    const SdfPath cubeId("/cube");
+    _sceneDelegate.AddCube(cubeId, GfMatrix4f(1.0f));
+    draw();
+
+    const HdxPickHitVector hits = pick();
+    ASSERT_EQ(1u, hits.size());
+    EXPECT_EQ(cubeId, hits[0].objectId);
+}
+
+TEST_F(CpuPickerTest, pickHiddenThenShownCube)
+{
+    const SdfPath cubeId("/cube");
+    _sceneDelegate.AddCube(cubeId, GfMatrix4f(1.0f));
+    draw();
+    EXPECT_EQ(1u, pick().size());
+
+    // Hide the cube, then move it: being hidden, it is not synced and stays
+    // dirty, so the picker has no cached entry for it.
+    _sceneDelegate.SetVisibility(cubeId, false);
+    draw();
+    _sceneDelegate.UpdateTransform(
+        cubeId, GfMatrix4f(1.0f).SetTranslate(GfVec3f(0.5f, 0.0f, 0.0f)));
+    draw();
+    EXPECT_TRUE(pick().empty());
+
+    // Once shown again, the cube must be picked.
+    _sceneDelegate.SetVisibility(cubeId, true);
+    draw();
+
+    const HdxPickHitVector hits = pick();
+    ASSERT_EQ(1u, hits.size());
+    EXPECT_EQ(cubeId, hits[0].objectId);
+}
@@ -359,13 +359,21 @@ class testProxyShapeSelectionPerformance(unittest.TestCase):
 
         self.assertEqual(actualSelectionSet, expectedSelectionSet)
 
-    def _RunPerfTest(self):
+    def _RunPerfTest(self, cpuPicking=False):
         mayaSceneFile = 'Grid_5_of_CubeGrid%s_10.ma' % self._testName
         mayaSceneFullPath = os.path.join(self._inputDir, mayaSceneFile)
         cmds.file(mayaSceneFullPath, open=True, force=True)
 
         Tf.Status("Maya Scene File: %s" % mayaSceneFile)
 
+        # When requested, have the batch renderer resolve the selections on
+        # the CPU. The expected selections are the same either way.
+        hdImagingShapePath = '|HdImaging|HdImagingShape'
+        self.assertTrue(cmds.objExists(hdImagingShapePath))
+        cmds.setAttr('%s.enableCpuPicking' % hdImagingShapePath, cpuPicking)
+        if cpuPicking:
+            self._testName = '%sCpuPicking' % self._testName
+
         # Get the QWidget for the viewport window.
         self.assertTrue(self._IsViewportRendererViewport20())
         self._viewWidget = self._GetViewportWidget(self._cameraName,
@@ -444,6 +452,22 @@ class testProxyShapeSelectionPerformance(unittest.TestCase):
         self._testName = 'ModelRefs'
         self._RunPerfTest()
 
+    def testPerfGridOfCubeGridsCombinedMeshCpuPicking(self):
+        """
+        Tests selection correctness and performance with the "CombinedMesh"
+        scene above when the batch renderer resolves selections on the CPU.
+        """
+        self._testName = 'CombinedMesh'
+        self._RunPerfTest(cpuPicking=True)
+
+    def testPerfGridOfCubeGridsModelRefsCpuPicking(self):
+        """
+        Tests selection correctness and performance with the "ModelRefs"
+        scene above when the batch renderer resolves selections on the CPU.
+        """
+        self._testName = 'ModelRefs'
+        self._RunPerfTest(cpuPicking=True)
+
 
 if __name__ == '__main__':
     fixturesUtils.runTests(globals())
@@ -0,0 +1,172 @@
+#include <mayaUsd/render/vp2RenderDelegate/basisCurvesIndices.h>
+
+#include <pxr/imaging/hd/tokens.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// The serial generation the parallel one replaced, used as the reference.
+
+template <typename Primitive>
+VtArray<Primitive>
+mapIndices(const std::vector<Primitive>& primitives, const HdBasisCurvesTopology& topology)
+{
+    VtArray<Primitive> result(primitives.begin(), primitives.end());
+
+    const VtIntArray& curveIndices = topology.GetCurveIndices();
+    if (!curveIndices.empty()) {
+        const int maxIndex = static_cast<int>(curveIndices.size()) - 1;
+        for (Primitive& primitive : result) {
+            for (size_t v = 0; v < Primitive::dimension; ++v) {
+                primitive[v] = curveIndices[std::min(primitive[v], maxIndex)];
+            }
+        }
+    }
+    return result;
+}
+
+VtVec4iArray serialCubicIndices(const HdBasisCurvesTopology& topology)
+{
+    const bool wrap = topology.GetCurveWrap() == HdTokens->periodic;
+    const int  vStep = (topology.GetCurveBasis() == HdTokens->bezier) ? 3 : 1;
+
+    std::vector<GfVec4i> indices;
+    int                  vertexIndex = 0;
+    for (const int count : topology.GetCurveVertexCounts()) {
+        const int numSegs = wrap ? count / vStep : ((count - 4) / vStep) + 1;
+        for (int i = 0; i < numSegs; ++i) {
+            GfVec4i   seg;
+            const int offset = i * vStep;
+            for (int v = 0; v < 4; ++v) {
+                seg[v] = wrap ? vertexIndex + ((offset + v) % count)
+                              : vertexIndex + std::min(offset + v, (count - 1));
+            }
+            indices.push_back(seg);
+        }
+        vertexIndex += count;
+    }
+    return mapIndices(indices, topology);
+}
+
+VtVec2iArray serialLinesIndices(const HdBasisCurvesTopology& topology)
+{
+    std::vector<GfVec2i> indices;
+    int                  vertexIndex = 0;
+    for (const int count : topology.GetCurveVertexCounts()) {
+        for (int i = 0; i < count; i += 2) {
+            indices.push_back(GfVec2i(vertexIndex, vertexIndex + 1));
+            vertexIndex += 2;
+        }
+    }
+    return mapIndices(indices, topology);
+}
+
+VtVec2iArray serialLineSegmentIndices(const HdBasisCurvesTopology& topology)
+{
+    const bool skipFirstAndLastSegs = topology.GetCurveBasis() == HdTokens->catmullRom;
+    const bool wrap = topology.GetCurveWrap() == HdTokens->periodic;
+
+    std::vector<GfVec2i> indices;
+    int                  vertexIndex = 0;
+    for (const int count : topology.GetCurveVertexCounts()) {
+        int       v0 = vertexIndex;
+        const int firstVert = v0;
+        ++vertexIndex;
+        for (int i = 1; i < count; ++i) {
+            const int v1 = vertexIndex;
+            ++vertexIndex;
+            if (!skipFirstAndLastSegs || (i > 1 && i < count - 1)) {
+                indices.push_back(GfVec2i(v0, v1));
+            }
+            v0 = v1;
+        }
+        if (wrap) {
+            indices.push_back(GfVec2i(v0, firstVert));
+        }
+    }
+    return mapIndices(indices, topology);
+}
+
+// Enough curves for several parallel chunks, with every small vertex count,
+// including empty curves and curves too short for a single cubic segment.
+VtIntArray curveVertexCounts()
+{
+    VtIntArray counts(5000);
+    for (size_t curve = 0; curve < counts.size(); ++curve) {
+        counts[curve] = static_cast<int>((curve * 7) % 13);
+    }
+    return counts;
+}
+
+// Curve indices that reverse the vertices. They only cover half of them, so
+// that the clamping of the generated indices is also verified.
+VtIntArray curveIndices(const VtIntArray& counts)
+{
+    int numVertices = 0;
+    for (const int count : counts) {
+        numVertices += count + 1;
+    }
+
+    VtIntArray indices(numVertices / 2);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        indices[i] = numVertices - static_cast<int>(i);
+    }
+    return indices;
+}
+
+const TfToken pinnedWrap("pinned");
+
+std::vector<HdBasisCurvesTopology> topologies(const TfToken& type, const TfTokenVector& wraps)
+{
+    const TfTokenVector bases = { HdTokens->bezier, HdTokens->bSpline, HdTokens->catmullRom };
+    const VtIntArray    counts = curveVertexCounts();
+    const VtIntArray    indices = curveIndices(counts);
+
+    std::vector<HdBasisCurvesTopology> result;
+    for (const TfToken& basis : bases) {
+        for (const TfToken& wrap : wraps) {
+            result.emplace_back(type, basis, wrap, counts, VtIntArray());
+            result.emplace_back(type, basis, wrap, counts, indices);
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+TEST(BasisCurvesIndices, cubicIndices)
+{
+    const TfTokenVector wraps = { HdTokens->nonperiodic, HdTokens->periodic, pinnedWrap };
+    for (const HdBasisCurvesTopology& topology : topologies(HdTokens->cubic, wraps)) {
+        EXPECT_EQ(serialCubicIndices(topology), HdVP2BuildCubicIndexArray(topology))
+            << topology.GetCurveBasis() << " " << topology.GetCurveWrap();
+    }
+}
+
+TEST(BasisCurvesIndices, linesIndices)
+{
+    const TfTokenVector wraps = { HdTokens->segmented };
+    for (const HdBasisCurvesTopology& topology : topologies(HdTokens->linear, wraps)) {
+        EXPECT_EQ(serialLinesIndices(topology), HdVP2BuildLinesIndexArray(topology))
+            << topology.GetCurveBasis();
+    }
+}
+
+TEST(BasisCurvesIndices, lineSegmentIndices)
+{
+    // Cubic curves are also drawn as line segments when they are not refined.
+    const TfTokenVector wraps = { HdTokens->nonperiodic, HdTokens->periodic, pinnedWrap };
+    for (const TfToken& type : { HdTokens->linear, HdTokens->cubic }) {
+        for (const HdBasisCurvesTopology& topology : topologies(type, wraps)) {
+            EXPECT_EQ(
+                serialLineSegmentIndices(topology), HdVP2BuildLineSegmentIndexArray(topology))
+                << type << " " << topology.GetCurveBasis() << " " << topology.GetCurveWrap();
+        }
+    }
+}
@@ -0,0 +1,273 @@
+#include <mayaUsd/render/vp2RenderDelegate/instancer.h>
+
+#include <pxr/base/gf/matrix4f.h>
+#include <pxr/imaging/hd/changeTracker.h>
+#include <pxr/imaging/hd/mesh.h>
+#include <pxr/imaging/hd/renderDelegate.h>
+#include <pxr/imaging/hd/renderIndex.h>
+#include <pxr/imaging/hd/resourceRegistry.h>
+#include <pxr/imaging/hd/tokens.h>
+#include <pxr/imaging/hd/unitTestDelegate.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <map>
+#include <memory>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// A mesh that is never drawn, only used as an instancer prototype.
+class TestMesh final : public HdMesh
+{
+public:
+    TestMesh(const SdfPath& id)
+        : HdMesh(id)
+    {
+    }
+
+    HdDirtyBits GetInitialDirtyBitsMask() const override
+    {
+        return HdChangeTracker::AllSceneDirtyBits;
+    }
+
+    void Sync(HdSceneDelegate*, HdRenderParam*, HdDirtyBits* dirtyBits, const TfToken&) override
+    {
+        *dirtyBits &= ~HdChangeTracker::AllSceneDirtyBits;
+    }
+
+protected:
+    HdDirtyBits _PropagateDirtyBits(HdDirtyBits bits) const override { return bits; }
+
+    void _InitRepr(const TfToken&, HdDirtyBits*) override { }
+};
+
+// A render delegate that draws nothing, and only creates meshes and VP2 instancers.
+class TestRenderDelegate final : public HdRenderDelegate
+{
+public:
+    const TfTokenVector& GetSupportedRprimTypes() const override
+    {
+        static const TfTokenVector types = { HdPrimTypeTokens->mesh };
+        return types;
+    }
+
+    const TfTokenVector& GetSupportedSprimTypes() const override
+    {
+        static const TfTokenVector types;
+        return types;
+    }
+
+    const TfTokenVector& GetSupportedBprimTypes() const override
+    {
+        static const TfTokenVector types;
+        return types;
+    }
+
+    HdResourceRegistrySharedPtr GetResourceRegistry() const override { return _resourceRegistry; }
+
+    HdRenderPassSharedPtr CreateRenderPass(HdRenderIndex*, HdRprimCollection const&) override
+    {
+        return nullptr;
+    }
+
+    HdInstancer* CreateInstancer(
+        HdSceneDelegate* delegate,
+#if defined(HD_API_VERSION) && HD_API_VERSION >= 36
+        SdfPath const& id) override
+    {
+        HdVP2Instancer* instancer = new HdVP2Instancer(delegate, id);
+#else
+        SdfPath const& id,
+        SdfPath const& instancerId) override
+    {
+        HdVP2Instancer* instancer = new HdVP2Instancer(delegate, id, instancerId);
+#endif
+        instancers[id] = instancer;
+        return instancer;
+    }
+
+    void DestroyInstancer(HdInstancer* instancer) override
+    {
+        instancers.erase(instancer->GetId());
+        delete instancer;
+    }
+
+    HdRprim* CreateRprim(
+        TfToken const&,
+#if defined(HD_API_VERSION) && HD_API_VERSION >= 36
+        SdfPath const& rprimId) override
+#else
+        SdfPath const& rprimId,
+        SdfPath const&) override
+#endif
+    {
+        return new TestMesh(rprimId);
+    }
+
+    void DestroyRprim(HdRprim* rPrim) override { delete rPrim; }
+
+    HdSprim* CreateSprim(TfToken const&, SdfPath const&) override { return nullptr; }
+    HdSprim* CreateFallbackSprim(TfToken const&) override { return nullptr; }
+    void     DestroySprim(HdSprim*) override { }
+
+    HdBprim* CreateBprim(TfToken const&, SdfPath const&) override { return nullptr; }
+    HdBprim* CreateFallbackBprim(TfToken const&) override { return nullptr; }
+    void     DestroyBprim(HdBprim*) override { }
+
+    void CommitResources(HdChangeTracker*) override { }
+
+    std::map<SdfPath, HdVP2Instancer*> instancers;
+
+private:
+    HdResourceRegistrySharedPtr _resourceRegistry = std::make_shared<HdResourceRegistry>();
+};
+
+class InstancerTest : public ::testing::Test
+{
+protected:
+    InstancerTest()
+        : _renderIndex(HdRenderIndex::New(&_renderDelegate, HdDriverVector()))
+        , _sceneDelegate(_renderIndex.get(), SdfPath::AbsoluteRootPath())
+    {
+    }
+
+    // Give the instancer one instance of its single prototype per translation.
+    void setTranslations(const SdfPath& instancerId, const VtVec3fArray& translations)
+    {
+        const size_t count = translations.size();
+        _sceneDelegate.SetInstancerProperties(
+            instancerId,
+            VtIntArray(count, 0),
+            VtVec3fArray(count, GfVec3f(1.0f)),
+            VtVec4fArray(count, GfVec4f(1.0f, 0.0f, 0.0f, 0.0f)),
+            translations);
+        _renderIndex->GetChangeTracker().MarkInstancerDirty(
+            instancerId, HdChangeTracker::DirtyPrimvar | HdChangeTracker::DirtyInstanceIndex);
+    }
+
+    HdVP2Instancer* instancer(const SdfPath& instancerId)
+    {
+        return _renderDelegate.instancers[instancerId];
+    }
+
+    TestRenderDelegate             _renderDelegate;
+    std::unique_ptr<HdRenderIndex> _renderIndex;
+    HdUnitTestDelegate             _sceneDelegate;
+
+    const SdfPath _instancerId { "/instancer" };
+    const SdfPath _cubeId { "/instancer/cube" };
+};
+
+} // namespace
+
+TEST_F(InstancerTest, cachedUntilInstancerChanges)
+{
+    _sceneDelegate.AddInstancer(_instancerId);
+    _sceneDelegate.AddCube(_cubeId, GfMatrix4f(1.0f), false, _instancerId);
+    setTranslations(_instancerId, { GfVec3f(1.0f, 0.0f, 0.0f), GfVec3f(2.0f, 0.0f, 0.0f) });
+
+    const VtMatrix4dArray transforms = instancer(_instancerId)->ComputeInstanceTransforms(_cubeId);
+    ASSERT_EQ(transforms.size(), 2u);
+    EXPECT_EQ(transforms[0].ExtractTranslation(), GfVec3d(1.0, 0.0, 0.0));
+    EXPECT_EQ(transforms[1].ExtractTranslation(), GfVec3d(2.0, 0.0, 0.0));
+
+    // Nothing changed, the prototype gets the cached array back.
+    const VtMatrix4dArray cached = instancer(_instancerId)->ComputeInstanceTransforms(_cubeId);
+    EXPECT_TRUE(cached.IsIdentical(transforms));
+}
+
+TEST_F(InstancerTest, instanceCountChangeInvalidatesCache)
+{
+    _sceneDelegate.AddInstancer(_instancerId);
+    _sceneDelegate.AddCube(_cubeId, GfMatrix4f(1.0f), false, _instancerId);
+    setTranslations(_instancerId, { GfVec3f(1.0f, 0.0f, 0.0f) });
+
+    const VtMatrix4dArray transforms = instancer(_instancerId)->ComputeInstanceTransforms(_cubeId);
+    ASSERT_EQ(transforms.size(), 1u);
+
+    setTranslations(
+        _instancerId,
+        { GfVec3f(1.0f, 0.0f, 0.0f), GfVec3f(2.0f, 0.0f, 0.0f), GfVec3f(3.0f, 0.0f, 0.0f) });
+
+    const VtMatrix4dArray added = instancer(_instancerId)->ComputeInstanceTransforms(_cubeId);
+    EXPECT_FALSE(added.IsIdentical(transforms));
+    ASSERT_EQ(added.size(), 3u);
+    EXPECT_EQ(added[2].ExtractTranslation(), GfVec3d(3.0, 0.0, 0.0));
+}
+
+TEST_F(InstancerTest, transformChangeInvalidatesCache)
+{
+    _sceneDelegate.AddInstancer(_instancerId);
+    _sceneDelegate.AddCube(_cubeId, GfMatrix4f(1.0f), false, _instancerId);
+    setTranslations(_instancerId, { GfVec3f(1.0f, 0.0f, 0.0f) });
+
+    const VtMatrix4dArray transforms = instancer(_instancerId)->ComputeInstanceTransforms(_cubeId);
+    ASSERT_EQ(transforms.size(), 1u);
+
+    setTranslations(_instancerId, { GfVec3f(0.0f, 5.0f, 0.0f) });
+
+    const VtMatrix4dArray moved = instancer(_instancerId)->ComputeInstanceTransforms(_cubeId);
+    EXPECT_FALSE(moved.IsIdentical(transforms));
+    ASSERT_EQ(moved.size(), 1u);
+    EXPECT_EQ(moved[0].ExtractTranslation(), GfVec3d(0.0, 5.0, 0.0));
+}
+
+TEST_F(InstancerTest, parentTransformChangeInvalidatesCache)
+{
+    const SdfPath parentId("/parent");
+    const SdfPath childId("/parent/instancer");
+    const SdfPath cubeId("/parent/instancer/cube");
+    _sceneDelegate.AddInstancer(parentId);
+    _sceneDelegate.AddInstancer(childId, parentId);
+    _sceneDelegate.AddCube(cubeId, GfMatrix4f(1.0f), false, childId);
+    setTranslations(parentId, { GfVec3f(10.0f, 0.0f, 0.0f), GfVec3f(20.0f, 0.0f, 0.0f) });
+    setTranslations(childId, { GfVec3f(1.0f, 0.0f, 0.0f) });
+
+    const VtMatrix4dArray transforms = instancer(childId)->ComputeInstanceTransforms(cubeId);
+    ASSERT_EQ(transforms.size(), 2u);
+    EXPECT_EQ(transforms[1].ExtractTranslation(), GfVec3d(21.0, 0.0, 0.0));
+    EXPECT_TRUE(instancer(childId)->ComputeInstanceTransforms(cubeId).IsIdentical(transforms));
+
+    // Only the parent changed, the child instancer must still recompose.
+    setTranslations(parentId, { GfVec3f(10.0f, 0.0f, 0.0f), GfVec3f(30.0f, 0.0f, 0.0f) });
+
+    const VtMatrix4dArray moved = instancer(childId)->ComputeInstanceTransforms(cubeId);
+    EXPECT_FALSE(moved.IsIdentical(transforms));
+    ASSERT_EQ(moved.size(), 2u);
+    EXPECT_EQ(moved[1].ExtractTranslation(), GfVec3d(31.0, 0.0, 0.0));
+}
+
+TEST_F(InstancerTest, millionInstances)
+{
+    const size_t count = 1000000;
+    VtVec3fArray translations(count);
+    for (size_t i = 0; i < count; ++i) {
+        translations[i] = GfVec3f(static_cast<float>(i), 0.0f, 0.0f);
+    }
+
+    _sceneDelegate.AddInstancer(_instancerId);
+    _sceneDelegate.AddCube(_cubeId, GfMatrix4f(1.0f), false, _instancerId);
+    setTranslations(_instancerId, translations);
+
+    using Clock = std::chrono::steady_clock;
+    const auto            start = Clock::now();
+    const VtMatrix4dArray transforms = instancer(_instancerId)->ComputeInstanceTransforms(_cubeId);
+    const auto            computed = Clock::now();
+    const VtMatrix4dArray cached = instancer(_instancerId)->ComputeInstanceTransforms(_cubeId);
+    const auto            end = Clock::now();
+
+    ASSERT_EQ(transforms.size(), count);
+    EXPECT_EQ(transforms[count - 1].ExtractTranslation(), GfVec3d(count - 1.0, 0.0, 0.0));
+    EXPECT_TRUE(cached.IsIdentical(transforms));
+
+    // Reported in the test results rather than asserted, as timings vary between machines.
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+    const auto computeTime = duration_cast<microseconds>(computed - start).count();
+    const auto cachedTime = duration_cast<microseconds>(end - computed).count();
+    RecordProperty("computeMicroseconds", static_cast<int>(computeTime));
+    RecordProperty("cachedMicroseconds", static_cast<int>(cachedTime));
+}
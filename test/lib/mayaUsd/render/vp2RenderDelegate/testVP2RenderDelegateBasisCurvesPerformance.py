@@ -0,0 +1,147 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+"""
+Measures how the time spent by the Viewport 2.0 render delegate to draw basis
+curves scales with the number of curves.
+
+For each curve count, a single BasisCurves prim is drawn, then its topology
+and its display colors are changed and it is drawn again. The elapsed times are
+written with perfStatsUtils. Set MAYAUSD_PERF_SCALE to grow or shrink the
+number of curves.
+"""
+
+import fixturesUtils
+import mayaUtils
+import perfStatsUtils
+
+from maya import cmds
+
+from pxr import Gf
+from pxr import Tf
+from pxr import UsdGeom
+from pxr import Vt
+
+import contextlib
+import os
+import unittest
+
+
+_CURVE_COUNTS = [1000, 10000, 100000]
+
+_VERTICES_PER_CURVE = 8
+
+
+class testVP2RenderDelegateBasisCurvesPerformance(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__, initializeStandalone=False,
+            loadPlugin=False)
+
+        cls._testDir = os.path.abspath('.')
+
+        cls._perfStats = perfStatsUtils.PerfStats(cls.__name__, cls._testDir)
+
+    @classmethod
+    def tearDownClass(cls):
+        cls._perfStats.write()
+
+    def setUp(self):
+        cmds.file(force=True, new=True)
+        mayaUtils.loadPlugin('mayaUsdPlugin')
+
+    @contextlib.contextmanager
+    def _ProfileScope(self, profileScopeName):
+        """
+        A context manager that measures the execution time between enter and
+        exit and records it in the class' stats.
+        """
+        stopwatch = Tf.Stopwatch()
+        try:
+            stopwatch.Start()
+            yield
+        finally:
+            stopwatch.Stop()
+            self._perfStats.addTime(profileScopeName, stopwatch.seconds)
+
+    def _AuthorCurves(self, curves, numCurves, numVerticesPerCurve):
+        """
+        Authors numCurves parallel curves of numVerticesPerCurve vertices on a
+        square grid, with one display color per vertex.
+        """
+        gridSize = max(int(numCurves ** 0.5), 1)
+        points = []
+        colors = []
+        for curve in range(numCurves):
+            x = float(curve % gridSize)
+            z = float(curve // gridSize)
+            for vertex in range(numVerticesPerCurve):
+                points.append(Gf.Vec3f(x, float(vertex), z))
+                colors.append(Gf.Vec3f(x / gridSize, 0.5, z / gridSize))
+
+        curves.GetCurveVertexCountsAttr().Set(
+            Vt.IntArray(numCurves, numVerticesPerCurve))
+        curves.GetPointsAttr().Set(Vt.Vec3fArray(points))
+        curves.GetDisplayColorPrimvar().Set(Vt.Vec3fArray(colors))
+        curves.GetDisplayColorPrimvar().SetInterpolation(UsdGeom.Tokens.vertex)
+
+    def _RunScalingTest(self, curveType, basis):
+        for curveCount in _CURVE_COUNTS:
+            numCurves = perfStatsUtils.scaled(curveCount)
+            testName = '%s %s %d Curves' % (curveType, basis, numCurves)
+
+            cmds.file(force=True, new=True)
+            _, stage = mayaUtils.createProxyAndStage()
+
+            curves = UsdGeom.BasisCurves.Define(stage, '/Curves')
+            curves.GetTypeAttr().Set(curveType)
+            curves.GetBasisAttr().Set(basis)
+            curves.GetWrapAttr().Set(UsdGeom.Tokens.nonperiodic)
+            self._AuthorCurves(curves, numCurves, _VERTICES_PER_CURVE)
+
+            with self._ProfileScope('%s Initial Draw Time' % testName):
+                cmds.refresh(force=True)
+
+            # Changing the vertex counts changes the topology, which
+            # regenerates the index buffers.
+            self._AuthorCurves(curves, numCurves, _VERTICES_PER_CURVE - 1)
+            with self._ProfileScope('%s Topology Change Draw Time' % testName):
+                cmds.refresh(force=True)
+
+            # Changing the display colors only refills the color buffer.
+            colors = curves.GetDisplayColorPrimvar().Get()
+            curves.GetDisplayColorPrimvar().Set(
+                Vt.Vec3fArray([Gf.Vec3f(1.0) - color for color in colors]))
+            with self._ProfileScope('%s Color Change Draw Time' % testName):
+                cmds.refresh(force=True)
+
+            self.assertEqual(
+                len(curves.GetCurveVertexCountsAttr().Get()), numCurves)
+
+    def testLinearCurvesScaling(self):
+        self._RunScalingTest(UsdGeom.Tokens.linear, UsdGeom.Tokens.bezier)
+
+    def testCubicBezierCurvesScaling(self):
+        self._RunScalingTest(UsdGeom.Tokens.cubic, UsdGeom.Tokens.bezier)
+
+    def testCubicCatmullRomCurvesScaling(self):
+        self._RunScalingTest(UsdGeom.Tokens.cubic, UsdGeom.Tokens.catmullRom)
+
+
+if __name__ == '__main__':
+    fixturesUtils.runTests(globals())
@@ -0,0 +1,171 @@
+#include <mayaUsd/utils/layerTreeChanges.h>
+
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/notice.h>
+#include <pxr/usd/sdf/primSpec.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+using Paths = std::vector<std::string>;
+
+MayaUsd::SubLayerEdits verifySubLayerEdits(const Paths& oldPaths, const Paths& newPaths)
+{
+    MayaUsd::SubLayerEdits edits;
+    EXPECT_TRUE(MayaUsd::computeSubLayerEdits(oldPaths, newPaths, edits));
+
+    Paths paths = oldPaths;
+    MayaUsd::applySubLayerEdits(edits, paths);
+    EXPECT_EQ(newPaths, paths);
+
+    return edits;
+}
+
+size_t countEdits(const MayaUsd::SubLayerEdits& edits, MayaUsd::SubLayerEdit::Type type)
+{
+    return std::count_if(edits.begin(), edits.end(), [type](const MayaUsd::SubLayerEdit& edit) {
+        return edit.type == type;
+    });
+}
+
+// Record the classified changes of each layer.
+class LayerChangesRecorder : public TfWeakBase
+{
+public:
+    LayerChangesRecorder()
+    {
+        TfWeakPtr<LayerChangesRecorder> me(this);
+        _key = TfNotice::Register(me, &LayerChangesRecorder::layersChanged);
+    }
+
+    ~LayerChangesRecorder() { TfNotice::Revoke(_key); }
+
+    void layersChanged(const SdfNotice::LayersDidChange& notice)
+    {
+        for (const auto& layerAndChanges : notice.GetChangeListVec())
+            changes[layerAndChanges.first]
+                |= MayaUsd::classifyLayerTreeChanges(layerAndChanges.second);
+    }
+
+    std::map<SdfLayerHandle, unsigned> changes;
+
+private:
+    TfNotice::Key _key;
+};
+
+} // namespace
+
+TEST(SubLayerEdits, unchangedSubLayers)
+{
+    auto edits = verifySubLayerEdits({ "a", "b", "c" }, { "a", "b", "c" });
+    EXPECT_TRUE(edits.empty());
+}
+
+TEST(SubLayerEdits, insertSubLayers)
+{
+    auto edits = verifySubLayerEdits({ "a", "b" }, { "x", "a", "y", "b", "z" });
+    EXPECT_EQ(3u, edits.size());
+    EXPECT_EQ(3u, countEdits(edits, MayaUsd::SubLayerEdit::Type::Insert));
+}
+
+TEST(SubLayerEdits, removeSubLayers)
+{
+    auto edits = verifySubLayerEdits({ "a", "b", "c", "d" }, { "b", "d" });
+    EXPECT_EQ(2u, edits.size());
+    EXPECT_EQ(2u, countEdits(edits, MayaUsd::SubLayerEdit::Type::Remove));
+}
+
+TEST(SubLayerEdits, moveSubLayers)
+{
+    // Moving a sublayer must not remove it, so that its children are kept.
+    auto edits = verifySubLayerEdits({ "a", "b", "c", "d" }, { "d", "a", "b", "c" });
+    EXPECT_EQ(1u, edits.size());
+    EXPECT_EQ(1u, countEdits(edits, MayaUsd::SubLayerEdit::Type::Move));
+
+    edits = verifySubLayerEdits({ "a", "b", "c", "d" }, { "d", "c", "b", "a" });
+    EXPECT_EQ(edits.size(), countEdits(edits, MayaUsd::SubLayerEdit::Type::Move));
+}
+
+TEST(SubLayerEdits, mixedSubLayerEdits)
+{
+    auto edits = verifySubLayerEdits({ "a", "b", "c", "d", "e" }, { "e", "x", "c", "a" });
+    EXPECT_EQ(2u, countEdits(edits, MayaUsd::SubLayerEdit::Type::Remove));
+    EXPECT_EQ(1u, countEdits(edits, MayaUsd::SubLayerEdit::Type::Insert));
+
+    verifySubLayerEdits({}, { "a", "b" });
+    verifySubLayerEdits({ "a", "b" }, {});
+}
+
+TEST(SubLayerEdits, duplicateSubLayers)
+{
+    MayaUsd::SubLayerEdits edits;
+    EXPECT_FALSE(MayaUsd::computeSubLayerEdits({ "a", "a" }, { "a" }, edits));
+    EXPECT_FALSE(MayaUsd::computeSubLayerEdits({ "a" }, { "b", "b" }, edits));
+}
+
+TEST(ClassifyLayerTreeChanges, contentChanges)
+{
+    auto layer = SdfLayer::CreateAnonymous();
+
+    LayerChangesRecorder recorder;
+    SdfCreatePrimInLayer(layer, SdfPath("/a/b"));
+
+    const unsigned layerChanges = MayaUsd::LayerTreeChange_Identifier
+        | MayaUsd::LayerTreeChange_CustomLayerData | MayaUsd::LayerTreeChange_Reload;
+    EXPECT_TRUE(recorder.changes[layer] & MayaUsd::LayerTreeChange_Content);
+    EXPECT_FALSE(recorder.changes[layer] & layerChanges);
+}
+
+TEST(ClassifyLayerTreeChanges, subLayerChanges)
+{
+    auto layer = SdfLayer::CreateAnonymous();
+    auto subLayer1 = SdfLayer::CreateAnonymous();
+    auto subLayer2 = SdfLayer::CreateAnonymous();
+
+    {
+        LayerChangesRecorder recorder;
+        layer->InsertSubLayerPath(subLayer1->GetIdentifier());
+        layer->InsertSubLayerPath(subLayer2->GetIdentifier());
+
+        EXPECT_TRUE(recorder.changes[layer] & MayaUsd::LayerTreeChange_SubLayers);
+        EXPECT_FALSE(recorder.changes[layer] & MayaUsd::LayerTreeChange_Content);
+    }
+
+    {
+        LayerChangesRecorder recorder;
+        layer->RemoveSubLayerPath(0);
+
+        EXPECT_TRUE(recorder.changes[layer] & MayaUsd::LayerTreeChange_SubLayers);
+    }
+}
+
+TEST(ClassifyLayerTreeChanges, customLayerDataChanges)
+{
+    auto layer = SdfLayer::CreateAnonymous();
+
+    LayerChangesRecorder recorder;
+    VtDictionary         data;
+    data["referencedLayers"] = VtValue(std::string("layer"));
+    layer->SetCustomLayerData(data);
+
+    EXPECT_EQ(MayaUsd::LayerTreeChange_CustomLayerData, recorder.changes[layer]);
+}
+
+TEST(ClassifyLayerTreeChanges, reloadChanges)
+{
+    auto layer = SdfLayer::CreateAnonymous();
+    SdfCreatePrimInLayer(layer, SdfPath("/a"));
+
+    LayerChangesRecorder recorder;
+    layer->Clear();
+
+    EXPECT_TRUE(recorder.changes[layer] & MayaUsd::LayerTreeChange_Reload);
+}
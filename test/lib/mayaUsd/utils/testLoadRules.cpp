@@ -1,9 +1,56 @@
+#include <usdUfe/ufe/Global.h>
+#include <usdUfe/ufe/UsdSceneItem.h>
+#include <usdUfe/ufe/UsdUndoDuplicateSelectionCommand.h>
+#include <usdUfe/ufe/Utils.h>
 #include <usdUfe/utils/loadRules.h>
 
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/payloads.h>
+
+#include <ufe/path.h>
+#include <ufe/pathSegment.h>
+#include <ufe/selection.h>
+
 #include <gtest/gtest.h>
 
+#include <set>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
+namespace {
+
+// Record the children of the pseudo-root whose payload is ever loaded.
+class LoadedPayloadsRecorder : public TfWeakBase
+{
+public:
+    LoadedPayloadsRecorder(const UsdStageRefPtr& stage)
+        : _stage(stage)
+    {
+        TfWeakPtr<LoadedPayloadsRecorder> me(this);
+        _key = TfNotice::Register(me, &LoadedPayloadsRecorder::objectsChanged, _stage);
+    }
+
+    ~LoadedPayloadsRecorder() { TfNotice::Revoke(_key); }
+
+    void objectsChanged(const UsdNotice::ObjectsChanged&, const UsdStageWeakPtr&)
+    {
+        for (const UsdPrim& prim : _stage->GetPseudoRoot().GetAllChildren())
+            if (prim.HasAuthoredPayloads() && prim.IsLoaded())
+                loadedPayloads.insert(prim.GetPath());
+    }
+
+    std::set<SdfPath> loadedPayloads;
+
+private:
+    UsdStageRefPtr _stage;
+    TfNotice::Key  _key;
+};
+
+} // namespace
+
 TEST(ConvertLoadRules, convertEmptyLoadRules)
 {
     UsdStageLoadRules originalLoadRules;
@@ -58,3 +105,107 @@ TEST(ConvertLoadRules, convertSimpleStageLoadRules)
 
     EXPECT_EQ(originalStage->GetLoadRules(), convertedStage->GetLoadRules());
 }
+
+TEST(ModifyLoadRules, duplicateLoadRules)
+{
+    UsdStageLoadRules originalLoadRules;
+    originalLoadRules.AddRule(SdfPath("/a"), UsdStageLoadRules::NoneRule);
+    originalLoadRules.AddRule(SdfPath("/a/b"), UsdStageLoadRules::AllRule);
+    originalLoadRules.AddRule(SdfPath("/a/b/c"), UsdStageLoadRules::NoneRule);
+    originalLoadRules.AddRule(SdfPath("/a/bb"), UsdStageLoadRules::OnlyRule);
+    auto stage = UsdStage::CreateInMemory();
+    stage->SetLoadRules(originalLoadRules);
+
+    UsdUfe::duplicateLoadRules(*stage, SdfPath("/a/b"), SdfPath("/d"));
+
+    UsdStageLoadRules expectedLoadRules = originalLoadRules;
+    expectedLoadRules.AddRule(SdfPath("/d"), UsdStageLoadRules::AllRule);
+    expectedLoadRules.AddRule(SdfPath("/d/c"), UsdStageLoadRules::NoneRule);
+
+    EXPECT_EQ(expectedLoadRules, stage->GetLoadRules());
+}
+
+TEST(ModifyLoadRules, removeRulesForPath)
+{
+    UsdStageLoadRules originalLoadRules;
+    originalLoadRules.AddRule(SdfPath("/a"), UsdStageLoadRules::NoneRule);
+    originalLoadRules.AddRule(SdfPath("/a/b"), UsdStageLoadRules::AllRule);
+    originalLoadRules.AddRule(SdfPath("/a/b/c"), UsdStageLoadRules::NoneRule);
+    originalLoadRules.AddRule(SdfPath("/a/bb"), UsdStageLoadRules::OnlyRule);
+    auto stage = UsdStage::CreateInMemory();
+    stage->SetLoadRules(originalLoadRules);
+
+    UsdUfe::removeRulesForPath(*stage, SdfPath("/a/b"));
+
+    UsdStageLoadRules expectedLoadRules;
+    expectedLoadRules.AddRule(SdfPath("/a"), UsdStageLoadRules::NoneRule);
+    expectedLoadRules.AddRule(SdfPath("/a/bb"), UsdStageLoadRules::OnlyRule);
+
+    EXPECT_EQ(expectedLoadRules, stage->GetLoadRules());
+}
+
+TEST(ModifyLoadRules, loadRulesTransaction)
+{
+    UsdStageLoadRules originalLoadRules;
+    originalLoadRules.AddRule(SdfPath("/a"), UsdStageLoadRules::NoneRule);
+    auto stage = UsdStage::CreateInMemory();
+    stage->SetLoadRules(originalLoadRules);
+
+    UsdStageLoadRules expectedLoadRules;
+    expectedLoadRules.AddRule(SdfPath("/b"), UsdStageLoadRules::NoneRule);
+    expectedLoadRules.AddRule(SdfPath("/c"), UsdStageLoadRules::NoneRule);
+
+    {
+        UsdUfe::LoadRulesTransaction transaction;
+        UsdUfe::duplicateLoadRules(*stage, SdfPath("/a"), SdfPath("/b"));
+
+        {
+            UsdUfe::LoadRulesTransaction nestedTransaction;
+            UsdUfe::duplicateLoadRules(*stage, SdfPath("/b"), SdfPath("/c"));
+            UsdUfe::removeRulesForPath(*stage, SdfPath("/a"));
+        }
+
+        // The modifications are pending until the outermost transaction ends.
+        EXPECT_EQ(originalLoadRules, stage->GetLoadRules());
+        EXPECT_EQ(expectedLoadRules, UsdUfe::getLoadRules(*stage));
+        EXPECT_EQ("/b=none;/c=none", UsdUfe::convertLoadRulesToText(*stage));
+    }
+
+    EXPECT_FALSE(UsdUfe::LoadRulesTransaction::isActive());
+    EXPECT_EQ(expectedLoadRules, stage->GetLoadRules());
+}
+
+TEST(ModifyLoadRules, duplicateUnloadedPayloads)
+{
+    // The duplicated items are in a stage without a proxy shape, as when
+    // pasting from the clipboard.
+    UsdUfe::setStagePathAccessorFn([](UsdStageWeakPtr) { return Ufe::Path(); });
+
+    auto payloadLayer = SdfLayer::CreateAnonymous();
+    SdfCreatePrimInLayer(payloadLayer, SdfPath("/Ball/Geom"));
+
+    auto stage = UsdStage::CreateInMemory();
+    auto ball = stage->DefinePrim(SdfPath("/Ball1"));
+    ball.GetPayloads().AddPayload(payloadLayer->GetIdentifier(), SdfPath("/Ball"));
+    stage->Unload(ball.GetPath());
+    ASSERT_FALSE(ball.IsLoaded());
+
+    Ufe::Selection selection;
+    const Ufe::Path srcPath(Ufe::PathSegment("/Ball1", UsdUfe::getUsdRunTimeId(), '/'));
+    selection.append(UsdUfe::UsdSceneItem::create(srcPath, ball));
+    auto dstParentItem = UsdUfe::UsdSceneItem::create(Ufe::Path(), stage->GetPseudoRoot());
+
+    LoadedPayloadsRecorder recorder(stage);
+
+    auto cmd = UsdUfe::UsdUndoDuplicateSelectionCommand::create(selection, dstParentItem);
+    ASSERT_TRUE(cmd);
+    cmd->execute();
+
+    // The duplicate must be unloaded as soon as it exists, not only when the
+    // command is done.
+    auto duplicate = stage->GetPrimAtPath(SdfPath("/Ball2"));
+    ASSERT_TRUE(duplicate);
+    EXPECT_FALSE(duplicate.IsLoaded());
+    EXPECT_FALSE(ball.IsLoaded());
+    EXPECT_TRUE(recorder.loadedPayloads.empty());
+}
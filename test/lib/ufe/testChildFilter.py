@@ -179,5 +179,52 @@ class ChildFilterTestCase(unittest.TestCase):
         ball1Children = propsHier.children()
         self.assertEqual(len(ball1Children), 35)
 
+    def testCachedChildren(self):
+        '''Verify that the children stay up to date as the stage is edited.'''
+        import mayaUsd_createStageWithNewLayer
+        proxyShape = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.ufe.getStage(proxyShape)
+        stage.DefinePrim('/Parent/A', 'Xform')
+        stage.DefinePrim('/Parent/B', 'Xform')
+
+        parentItem = ufe.Hierarchy.createItem(
+            ufe.PathString.path('%s,/Parent' % proxyShape))
+        parentHier = ufe.Hierarchy.hierarchy(parentItem)
+        aItem = ufe.Hierarchy.createItem(
+            ufe.PathString.path('%s,/Parent/A' % proxyShape))
+        aHier = ufe.Hierarchy.hierarchy(aItem)
+
+        def childNames(children):
+            return [str(child.path().back()) for child in children]
+
+        self.assertEqual(['A', 'B'], childNames(parentHier.children()))
+        self.assertFalse(aHier.hasChildren())
+
+        # Adding a prim updates its parent's children and hasChildren().
+        stage.DefinePrim('/Parent/A/Child', 'Xform')
+        stage.DefinePrim('/Parent/C', 'Xform')
+        self.assertTrue(aHier.hasChildren())
+        self.assertEqual(['Child'], childNames(aHier.children()))
+        self.assertEqual(['A', 'B', 'C'], childNames(parentHier.children()))
+
+        # Reordering the children is reflected.
+        stage.GetPrimAtPath('/Parent').SetChildrenReorder(['C', 'B', 'A'])
+        self.assertEqual(['C', 'B', 'A'], childNames(parentHier.children()))
+
+        # Removing a prim updates its parent's children, and hasChildren()
+        # honours the inactive filter.
+        stage.RemovePrim('/Parent/C')
+        stage.GetPrimAtPath('/Parent/A/Child').SetActive(False)
+        self.assertEqual(['B', 'A'], childNames(parentHier.children()))
+        self.assertEqual([], childNames(aHier.children()))
+        if hasattr(aHier, 'hasFilteredChildren'):
+            cf = ufe.RunTimeMgr.instance().hierarchyHandler(
+                aItem.runTimeId()).childFilter()
+            cf[0].value = True
+            self.assertTrue(aHier.hasFilteredChildren(cf))
+            self.assertEqual(['Child'], childNames(aHier.filteredChildren(cf)))
+            cf[0].value = False
+            self.assertFalse(aHier.hasFilteredChildren(cf))
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -27,6 +27,7 @@ import maya.cmds as cmds
 
 import ufe
 
+import os
 import unittest
 
 
@@ -488,5 +489,68 @@ class ClipboardHandlerTestCase(unittest.TestCase):
         pasteCmd = ufe.ClipboardHandler.pasteCmd(ufe.GlobalSelection.get())
         self.assertRaisesRegex(RuntimeError, 'Failed to load Clipboard stage.', pasteCmd.execute)
 
+    def testClipboardFileChangedByOtherInstance(self):
+        '''The clipboard file written by another instance wins over the in-memory data.'''
+
+        psPathStr = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.lib.GetPrim(psPathStr).GetStage()
+        stage.DefinePrim('/Xform1', 'Xform')
+        stage.DefinePrim('/Xform1/Sphere1', 'Sphere')
+        xformItem = ufeUtils.createItem(psPathStr + ',/Xform1')
+        sphereItem = ufeUtils.createItem(psPathStr + ',/Xform1/Sphere1')
+        ch = ufe.ClipboardHandler.clipboardHandler(sphereItem.runTimeId())
+
+        ufe.ClipboardHandler.preCopy()
+        ch.copyCmd_(sphereItem).execute()
+        self.assertTrue(ch.hasItemsToPaste_())
+
+        # Simulate a copy of a cube made in another instance of Maya, which
+        # overwrites the clipboard file.
+        from pxr import Usd
+        otherStage = Usd.Stage.CreateInMemory()
+        otherStage.DefinePrim('/Cube1', 'Cube')
+        clipboardFilePath = mayaUsd.ufe.getClipboardFilePath()
+        self.assertTrue(otherStage.GetRootLayer().Export(clipboardFilePath))
+
+        ufe.GlobalSelection.get().clear()
+        ch.pasteCmd_(xformItem).execute()
+        self.assertIsNotNone(ufeUtils.createItem(psPathStr + ',/Xform1/Cube1'))
+        self.assertIsNone(ufeUtils.createItem(psPathStr + ',/Xform1/Sphere2'))
+
+        # Another instance cleaning the clipboard removes the file.
+        os.remove(clipboardFilePath)
+        self.assertFalse(ch.hasItemsToPaste_())
+
+    def testClipboardInMemoryOnly(self):
+        '''Copy/paste without a clipboard file.'''
+
+        psPathStr = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.lib.GetPrim(psPathStr).GetStage()
+        stage.DefinePrim('/Xform1', 'Xform')
+        stage.DefinePrim('/Xform1/Sphere1', 'Sphere')
+        xformItem = ufeUtils.createItem(psPathStr + ',/Xform1')
+        sphereItem = ufeUtils.createItem(psPathStr + ',/Xform1/Sphere1')
+        ch = ufe.ClipboardHandler.clipboardHandler(sphereItem.runTimeId())
+
+        clipboardFilePath = mayaUsd.ufe.getClipboardFilePath()
+        mayaUsd.ufe.setClipboardFilePath('')
+        try:
+            ufe.ClipboardHandler.preCopy()
+            self.assertFalse(ch.hasItemsToPaste_())
+            ch.copyCmd_(sphereItem).execute()
+            self.assertTrue(ch.hasItemsToPaste_())
+            self.assertFalse(os.path.exists(clipboardFilePath))
+
+            # The in-memory data can be pasted more than once.
+            ufe.GlobalSelection.get().clear()
+            ch.pasteCmd_(xformItem).execute()
+            ufe.GlobalSelection.get().clear()
+            ch.pasteCmd_(xformItem).execute()
+            self.assertIsNotNone(ufeUtils.createItem(psPathStr + ',/Xform1/Sphere2'))
+            self.assertIsNotNone(ufeUtils.createItem(psPathStr + ',/Xform1/Sphere3'))
+        finally:
+            ufe.ClipboardHandler.preCopy()
+            mayaUsd.ufe.setClipboardFilePath(clipboardFilePath)
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -0,0 +1,138 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+"""
+Micro-benchmark for the USD clipboard.
+
+Copies and pastes a large selection of prims, with and without the clipboard
+file used to paste in other running instances of Maya, and writes the elapsed
+times with perfStatsUtils. Set MAYAUSD_PERF_SCALE to change the number of
+copied prims.
+"""
+
+import fixturesUtils
+import mayaUtils
+import perfStatsUtils
+
+import mayaUsd
+
+from maya import cmds
+from maya import standalone
+
+from pxr import Sdf
+from pxr import Tf
+
+import ufe
+
+import os
+import unittest
+
+
+class testClipboardPerformance(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.readOnlySetUpClass(__file__, loadPlugin=False)
+        cls._testDir = os.path.abspath('.')
+        cls._perfStats = perfStatsUtils.PerfStats(cls.__name__, cls._testDir)
+
+    @classmethod
+    def tearDownClass(cls):
+        cls._perfStats.write()
+
+        standalone.uninitialize()
+
+    def setUp(self):
+        self.assertTrue(mayaUtils.isMayaUsdPluginLoaded())
+        cmds.file(new=True, force=True)
+
+    def _RunCopyPaste(self, profileScopeName):
+        import mayaUsd_createStageWithNewLayer
+        proxyShape = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.ufe.getStage(proxyShape)
+
+        # Author the source prims directly in a change block, defining that
+        # many prims one by one would dominate the test time. The selection
+        # is made of groups of ten prims each.
+        primCount = perfStatsUtils.scaled(10000, 10)
+        groupCount = primCount // 10
+        layer = stage.GetRootLayer()
+        with Sdf.ChangeBlock():
+            for group in range(groupCount):
+                groupSpec = Sdf.CreatePrimInLayer(layer, '/Source/Group%d' % group)
+                groupSpec.specifier = Sdf.SpecifierDef
+                groupSpec.typeName = 'Xform'
+                for child in range(9):
+                    Sdf.PrimSpec(groupSpec, 'Sphere%d' % child, Sdf.SpecifierDef, 'Sphere')
+            targetSpec = Sdf.CreatePrimInLayer(layer, '/Target')
+            targetSpec.specifier = Sdf.SpecifierDef
+            targetSpec.typeName = 'Xform'
+
+        selection = ufe.Selection()
+        for group in range(groupCount):
+            selection.append(ufe.Hierarchy.createItem(ufe.PathString.path(
+                '%s,/Source/Group%d' % (proxyShape, group))))
+        targetItem = ufe.Hierarchy.createItem(
+            ufe.PathString.path('%s,/Target' % proxyShape))
+
+        ch = ufe.ClipboardHandler.clipboardHandler(targetItem.runTimeId())
+
+        stopwatch = Tf.Stopwatch()
+        stopwatch.Start()
+        ufe.ClipboardHandler.preCopy()
+        ch.copyCmd_(selection).execute()
+        stopwatch.Stop()
+        self._perfStats.addTime('%s copy' % profileScopeName, stopwatch.seconds, primCount)
+
+        # The Outliner and the menus query the clipboard before pasting.
+        stopwatch.Reset()
+        stopwatch.Start()
+        self.assertTrue(ch.hasItemsToPaste_())
+        stopwatch.Stop()
+        self._perfStats.addTime('%s hasItemsToPaste' % profileScopeName, stopwatch.seconds)
+
+        ufe.GlobalSelection.get().clear()
+        pasteCount = 3
+        stopwatch.Reset()
+        stopwatch.Start()
+        for paste in range(pasteCount):
+            ch.pasteCmd_(targetItem).execute()
+        stopwatch.Stop()
+        self._perfStats.addTime('%s paste' % profileScopeName, stopwatch.seconds,
+            primCount * pasteCount)
+
+        targetHier = ufe.Hierarchy.hierarchy(targetItem)
+        self.assertEqual(groupCount * pasteCount, len(targetHier.children()))
+
+        ufe.ClipboardHandler.preCopy()
+        cmds.file(new=True, force=True)
+
+    def testCopyPaste(self):
+        self._RunCopyPaste('Clipboard file')
+
+    def testCopyPasteInMemoryOnly(self):
+        clipboardFilePath = mayaUsd.ufe.getClipboardFilePath()
+        mayaUsd.ufe.setClipboardFilePath('')
+        try:
+            self._RunCopyPaste('In-memory clipboard')
+        finally:
+            mayaUsd.ufe.setClipboardFilePath(clipboardFilePath)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
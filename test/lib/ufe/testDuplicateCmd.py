@@ -647,6 +647,44 @@ class DuplicateCmdTestCase(unittest.TestCase):
         self.assertNotIn('"Geom"', rootLayerText)
         self.assertNotIn('Mesh', rootLayerText)
 
+    @unittest.skipUnless(ufeUtils.ufeFeatureSetVersion() >= 4, 'Test only available in UFE v4 or greater')
+    def testUfeDuplicateManySiblings(self):
+        '''Test that duplicating many siblings at once gives each duplicate the
+        next Maya standard unique name.'''
+        cmds.file(new=True, force=True)
+        import mayaUsd_createStageWithNewLayer
+
+        psPathStr = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.lib.GetPrim(psPathStr).GetStage()
+        stage.DefinePrim('/Xform1', 'Xform')
+        sourceCount = 50
+        for i in range(1, sourceCount + 1):
+            stage.DefinePrim('/Xform1/Cone%d' % i, 'Cone')
+        stage.DefinePrim('/Xform1/Sphere001', 'Sphere')
+
+        sel = ufe.Selection()
+        for i in range(1, sourceCount + 1):
+            sel.append(ufeUtils.createUfeSceneItem(psPathStr, '/Xform1/Cone%d' % i))
+        sel.append(ufeUtils.createUfeSceneItem(psPathStr, '/Xform1/Sphere001'))
+
+        batchOpsHandler = ufe.RunTimeMgr.instance().batchOpsHandler(mayaUsd.ufe.getUsdRunTimeId())
+        self.assertIsNotNone(batchOpsHandler)
+        cmd = batchOpsHandler.duplicateSelectionCmd(sel, {"inputConnections": False})
+        cmd.execute()
+
+        for i in range(1, sourceCount + 1):
+            sourcePath = ufeUtils.createUfeSceneItem(psPathStr, '/Xform1/Cone%d' % i).path()
+            self.assertEqual(cmd.targetItem(sourcePath).nodeName(), 'Cone%d' % (sourceCount + i))
+        spherePath = ufeUtils.createUfeSceneItem(psPathStr, '/Xform1/Sphere001').path()
+        self.assertEqual(cmd.targetItem(spherePath).nodeName(), 'Sphere002')
+        self.assertEqual(len(stage.GetPrimAtPath('/Xform1').GetChildren()), 2 * (sourceCount + 1))
+
+        cmd.undo()
+        self.assertEqual(len(stage.GetPrimAtPath('/Xform1').GetChildren()), sourceCount + 1)
+
+        cmd.redo()
+        self.assertTrue(stage.GetPrimAtPath('/Xform1/Cone%d' % (2 * sourceCount)))
+
     def testDuplicateUniqueName(self):
         '''Test the duplicate of prims and ensure the new name follows Maya
         unique new name standard.'''
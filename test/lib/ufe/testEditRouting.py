@@ -9,6 +9,7 @@ import ufeUtils
 import ufe
 import os
 import unittest
+import usdUfe
 import usdUtils
 from pxr import UsdGeom
 from pxr import Gf
@@ -238,6 +239,81 @@ class EditRoutingTestCase(unittest.TestCase):
     def testEditRouterForDuplicateCmdWithFastRouting(self):
         self._testEditRouterForDuplicateCmd(True)
 
+    def testEditRouterForDuplicateSelection(self):
+        '''
+        Test that duplicating several prims calls the edit router once per prim
+        and routes all the duplicates.
+        '''
+        self._prepareSimpleScene()
+
+        routedPrimPaths = []
+        def countingRouter(context, routingData):
+            routedPrimPaths.append(context.get('prim').GetPath().pathString)
+            routeCmdToSessionLayer(context, routingData)
+
+        mayaUsd.lib.registerEditRouter('duplicate', countingRouter)
+
+        sn = ufe.GlobalSelection.get()
+        sn.clear()
+        sn.append(self.a)
+        sn.append(self.b)
+
+        cmds.duplicate()
+
+        self.assertEqual(sorted(routedPrimPaths), ['/A', '/B'])
+        self.assertTrue(self.sessionLayer.GetPrimAtPath('/A1'))
+        self.assertTrue(self.sessionLayer.GetPrimAtPath('/B1'))
+
+    def testBatchedAndMemoizedRouting(self):
+        '''
+        Test the batched routing and the routing memoization scope.
+        '''
+        self._prepareSimpleScene()
+        self.stage.DefinePrim('/C', 'Scope')
+
+        routedPrimPaths = []
+        def countingRouter(context, routingData):
+            routedPrimPaths.append(context.get('prim').GetPath().pathString)
+            routeVisibilityAttribute(context, routingData)
+
+        mayaUsd.lib.registerEditRouter('attribute', countingRouter)
+
+        primA = self.stage.GetPrimAtPath('/A')
+        primB = self.stage.GetPrimAtPath('/B')
+        primC = self.stage.GetPrimAtPath('/C')
+        visibility = UsdGeom.Tokens.visibility
+
+        # Batched routing gives the same layers as individual routing.
+        requests = [('attribute', prim, visibility) for prim in [primA, primB, primC]]
+        requests.append(('attribute', primA, 'purpose'))
+        requests.append(('unknownOperation', primA))
+        layers = usdUfe.getEditRouterLayers(requests)
+        self.assertEqual(routedPrimPaths, ['/A', '/B', '/C', '/A'])
+        self.assertEqual(layers[:3], [self.sessionLayer] * 3)
+        self.assertIsNone(layers[3])
+        self.assertIsNone(layers[4])
+
+        for prim in [primA, primB, primC]:
+            self.assertEqual(usdUfe.getAttrEditRouterLayer(prim, visibility), self.sessionLayer)
+        self.assertIsNone(usdUfe.getAttrEditRouterLayer(primA, 'purpose'))
+
+        # Within a memoization scope, the router is only called once per prim
+        # type and attribute, including for null results.
+        del routedPrimPaths[:]
+        with usdUfe.EditRouterCacheScope():
+            layers = usdUfe.getEditRouterLayers(requests[:4])
+            self.assertEqual(routedPrimPaths, ['/A', '/C', '/A'])
+            self.assertEqual(layers, [self.sessionLayer] * 3 + [None])
+
+            for prim in [primA, primB, primC]:
+                self.assertEqual(usdUfe.getAttrEditRouterLayer(prim, visibility), self.sessionLayer)
+            self.assertIsNone(usdUfe.getAttrEditRouterLayer(primB, 'purpose'))
+            self.assertEqual(routedPrimPaths, ['/A', '/C', '/A'])
+
+        # Leaving the scope forgets the memoized layers.
+        usdUfe.getAttrEditRouterLayer(primB, visibility)
+        self.assertEqual(routedPrimPaths, ['/A', '/C', '/A', '/B'])
+
     def testEditRouterForParentCmd(self):
         '''
         Test edit router functionality for the parent command.
@@ -0,0 +1,167 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+"""
+Micro-benchmark for the edit routing of bulk attribute edits.
+
+Routes an attribute edit on many prims with a Python edit router, one call per
+prim, as a batch, and as a batch within a memoization scope. A batch only
+takes the GIL once: the Python router is still called once per request. Only
+the memoization scope reduces the number of calls to the Python router, to one
+per prim type. The elapsed times are written with perfStatsUtils. Set
+MAYAUSD_PERF_SCALE to change the number of prims.
+"""
+
+import fixturesUtils
+import mayaUtils
+import perfStatsUtils
+
+import mayaUsd
+import usdUfe
+
+from maya import cmds
+from maya import standalone
+
+from pxr import Sdf
+from pxr import Tf
+from pxr import UsdGeom
+
+import ufe
+
+import os
+import unittest
+
+
+def _routeToSessionLayer(context, routingData):
+    prim = context.get('prim')
+    if prim is None:
+        return
+
+    routingData['layer'] = prim.GetStage().GetSessionLayer().identifier
+
+
+def _routeAttributeToSessionLayer(context, routingData):
+    if context.get('attribute') != UsdGeom.Tokens.visibility:
+        return
+
+    _routeToSessionLayer(context, routingData)
+
+
+class testEditRoutingPerformance(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.readOnlySetUpClass(__file__, loadPlugin=False)
+        cls._testDir = os.path.abspath('.')
+        cls._perfStats = perfStatsUtils.PerfStats(cls.__name__, cls._testDir)
+
+    @classmethod
+    def tearDownClass(cls):
+        cls._perfStats.write()
+
+        standalone.uninitialize()
+
+    def setUp(self):
+        self.assertTrue(mayaUtils.isMayaUsdPluginLoaded())
+        cmds.file(new=True, force=True)
+
+    def tearDown(self):
+        usdUfe.restoreAllDefaultEditRouters()
+
+    def _CreatePrims(self, primCount):
+        import mayaUsd_createStageWithNewLayer
+        proxyShape = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.ufe.getStage(proxyShape)
+
+        # Author the specs directly in a change block, defining that many
+        # prims one by one would dominate the test time.
+        layer = stage.GetRootLayer()
+        with Sdf.ChangeBlock():
+            for i in range(primCount):
+                Sdf.PrimSpec(layer.pseudoRoot, 'Prim%d' % i, Sdf.SpecifierDef,
+                    'Xform' if i % 2 else 'Scope')
+
+        return proxyShape, stage, list(stage.GetPseudoRoot().GetChildren())
+
+    def _Time(self, profileScopeName, samples, func):
+        stopwatch = Tf.Stopwatch()
+        stopwatch.Start()
+        result = func()
+        stopwatch.Stop()
+        self._perfStats.addTime(profileScopeName, stopwatch.seconds, samples)
+        return result
+
+    def testAttributeRouting(self):
+        primCount = perfStatsUtils.scaled(20000, 10)
+        _, stage, prims = self._CreatePrims(primCount)
+        sessionLayer = stage.GetSessionLayer()
+        visibility = UsdGeom.Tokens.visibility
+
+        usdUfe.registerEditRouter('attribute', _routeAttributeToSessionLayer)
+
+        def routePerCall():
+            return [usdUfe.getAttrEditRouterLayer(prim, visibility) for prim in prims]
+
+        requests = [('attribute', prim, visibility) for prim in prims]
+
+        def routeBatch():
+            return usdUfe.getEditRouterLayers(requests)
+
+        def routeMemoizedBatch():
+            with usdUfe.EditRouterCacheScope():
+                return usdUfe.getEditRouterLayers(requests)
+
+        def routeMemoizedPerCall():
+            with usdUfe.EditRouterCacheScope():
+                return routePerCall()
+
+        expected = [sessionLayer] * primCount
+        self.assertEqual(expected, self._Time(
+            'Attribute routing per call', primCount, routePerCall))
+        self.assertEqual(expected, self._Time(
+            'Attribute routing batched', primCount, routeBatch))
+        self.assertEqual(expected, self._Time(
+            'Attribute routing memoized per call', primCount, routeMemoizedPerCall))
+        self.assertEqual(expected, self._Time(
+            'Attribute routing memoized batched', primCount, routeMemoizedBatch))
+
+        cmds.file(new=True, force=True)
+
+    def testDuplicateSelection(self):
+        primCount = perfStatsUtils.scaled(2000, 10)
+        proxyShape, stage, prims = self._CreatePrims(primCount)
+
+        usdUfe.registerEditRouter('duplicate', _routeToSessionLayer)
+
+        sn = ufe.GlobalSelection.get()
+        sn.clear()
+        for prim in prims:
+            sn.append(ufe.Hierarchy.createItem(
+                ufe.PathString.path('%s,%s' % (proxyShape, prim.GetPath()))))
+
+        self._Time('Duplicate selection with Python router', primCount,
+            lambda: cmds.duplicate())
+
+        self.assertEqual(2 * primCount, len(stage.GetPseudoRoot().GetChildren()))
+        self.assertEqual(primCount, len(stage.GetSessionLayer().rootPrims))
+
+        cmds.file(new=True, force=True)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
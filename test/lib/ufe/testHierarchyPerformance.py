@@ -0,0 +1,170 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+"""
+Micro-benchmark for UFE hierarchy queries on USD prims.
+
+Expands a wide and a deep synthetic hierarchy the way the Outliner does: the
+children of an expanded item are listed, and each of them is asked whether it
+has children to draw its expand arrow. The elapsed times are written with
+perfStatsUtils. Set MAYAUSD_PERF_SCALE to change the size of the hierarchies.
+"""
+
+import fixturesUtils
+import mayaUtils
+import perfStatsUtils
+
+import mayaUsd
+
+from maya import cmds
+from maya import standalone
+
+from pxr import Sdf
+from pxr import Tf
+
+import ufe
+
+import os
+import unittest
+
+
+class testHierarchyPerformance(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.readOnlySetUpClass(__file__, loadPlugin=False)
+        cls._testDir = os.path.abspath('.')
+        cls._perfStats = perfStatsUtils.PerfStats(cls.__name__, cls._testDir)
+
+    @classmethod
+    def tearDownClass(cls):
+        cls._perfStats.write()
+
+        standalone.uninitialize()
+
+    def setUp(self):
+        self.assertTrue(mayaUtils.isMayaUsdPluginLoaded())
+        cmds.file(new=True, force=True)
+
+    def _CreateStage(self):
+        import mayaUsd_createStageWithNewLayer
+        proxyShape = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        return proxyShape, mayaUsd.ufe.getStage(proxyShape)
+
+    def _Expand(self, item):
+        '''
+        Lists the children of item and asks each of them whether it has
+        children, like the Outliner does when item is expanded.
+        Returns the children.
+        '''
+        children = ufe.Hierarchy.hierarchy(item).children()
+        for child in children:
+            ufe.Hierarchy.hierarchy(child).hasChildren()
+        return children
+
+    def _TimeExpand(self, profileScopeName, items):
+        stopwatch = Tf.Stopwatch()
+        stopwatch.Start()
+        rows = 0
+        for item in items:
+            rows += len(self._Expand(item))
+        stopwatch.Stop()
+        self._perfStats.addTime(profileScopeName, stopwatch.seconds, rows)
+        return rows
+
+    def testExpandWideHierarchy(self):
+        proxyShape, stage = self._CreateStage()
+
+        # A single scope with many leaf children. Author the specs directly in
+        # a change block, defining that many prims one by one would dominate
+        # the test time.
+        childCount = perfStatsUtils.scaled(100000, 10)
+        layer = stage.GetRootLayer()
+        with Sdf.ChangeBlock():
+            scopeSpec = Sdf.CreatePrimInLayer(layer, '/Wide')
+            scopeSpec.specifier = Sdf.SpecifierDef
+            scopeSpec.typeName = 'Scope'
+            for i in range(childCount):
+                Sdf.PrimSpec(scopeSpec, 'Child%d' % i, Sdf.SpecifierDef, 'Xform')
+
+        wideItem = ufe.Hierarchy.createItem(
+            ufe.PathString.path('%s,/Wide' % proxyShape))
+
+        rows = self._TimeExpand('Wide expand', [wideItem])
+        self.assertEqual(childCount, rows)
+
+        # Redrawing the Outliner queries the same rows again.
+        rows = self._TimeExpand('Wide redraw', [wideItem])
+        self.assertEqual(childCount, rows)
+
+        # An edit elsewhere in the stage does not affect the expanded scope.
+        stage.DefinePrim('/Other', 'Xform')
+        rows = self._TimeExpand('Wide redraw after unrelated edit', [wideItem])
+        self.assertEqual(childCount, rows)
+
+        # Adding a child to the scope invalidates its children.
+        stage.DefinePrim('/Wide/NewChild', 'Xform')
+        rows = self._TimeExpand('Wide redraw after child edit', [wideItem])
+        self.assertEqual(childCount + 1, rows)
+
+        cmds.file(new=True, force=True)
+
+    def testExpandDeepHierarchy(self):
+        proxyShape, stage = self._CreateStage()
+
+        # A tree of a few levels with a moderate branching factor, expanded
+        # level by level.
+        branching = max(int(20 * perfStatsUtils.getScale() ** 0.25), 2)
+        depth = 4
+        layer = stage.GetRootLayer()
+        with Sdf.ChangeBlock():
+            levelSpecs = [layer.pseudoRoot]
+            for level in range(depth):
+                nextLevelSpecs = []
+                for parentSpec in levelSpecs:
+                    for i in range(branching):
+                        nextLevelSpecs.append(Sdf.PrimSpec(parentSpec,
+                            'Level%d_%d' % (level, i), Sdf.SpecifierDef, 'Xform'))
+                levelSpecs = nextLevelSpecs
+
+        rootItem = ufe.Hierarchy.createItem(ufe.PathString.path(proxyShape))
+
+        def expandAll(profileScopeName):
+            stopwatch = Tf.Stopwatch()
+            stopwatch.Start()
+            rows = 0
+            items = [rootItem]
+            for level in range(depth):
+                nextItems = []
+                for item in items:
+                    nextItems.extend(self._Expand(item))
+                rows += len(nextItems)
+                items = nextItems
+            stopwatch.Stop()
+            self._perfStats.addTime(profileScopeName, stopwatch.seconds, rows)
+            return rows
+
+        expectedRows = sum(branching ** (level + 1) for level in range(depth))
+        self.assertEqual(expectedRows, expandAll('Deep expand'))
+        self.assertEqual(expectedRows, expandAll('Deep redraw'))
+
+        cmds.file(new=True, force=True)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
@@ -162,6 +162,51 @@ class PythonWrappersTestCase(unittest.TestCase):
         # a worker thread.
         cmds.file(new=True, force=True)
 
+    def testUfePathToPrimCache(self):
+        '''Verify that resolved prims follow stage and proxy shape edits.'''
+        cmds.file(new=True, force=True)
+
+        import mayaUsd_createStageWithNewLayer
+        proxyShape = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.ufe.getStage(proxyShape)
+        stage.DefinePrim('/Parent/Child', 'Xform')
+
+        childPathString = '%s,/Parent/Child' % proxyShape
+        self.assertTrue(mayaUsd.ufe.ufePathToPrim(childPathString))
+        self.assertTrue(mayaUsd.ufe.ufePathToPrim(childPathString))
+
+        # Removing an ancestor resyncs the cached child.
+        stage.RemovePrim('/Parent')
+        self.assertFalse(mayaUsd.ufe.ufePathToPrim(childPathString))
+
+        stage.DefinePrim('/Parent/Child', 'Scope')
+        child = mayaUsd.ufe.ufePathToPrim(childPathString)
+        self.assertTrue(child)
+        self.assertEqual(child.GetTypeName(), 'Scope')
+
+        # Deactivating the parent also expires the cached child.
+        stage.GetPrimAtPath('/Parent').SetActive(False)
+        self.assertFalse(mayaUsd.ufe.ufePathToPrim(childPathString))
+        stage.GetPrimAtPath('/Parent').SetActive(True)
+        self.assertTrue(mayaUsd.ufe.ufePathToPrim(childPathString))
+
+        # Renaming the proxy shape transform is picked up without a full
+        # rebuild of the stage map.
+        proxyTransform = cmds.listRelatives(proxyShape, parent=True, fullPath=True)[0]
+        renamedTransform = cmds.rename(proxyTransform, 'renamedStage')
+        renamedShape = cmds.listRelatives(renamedTransform, shapes=True, fullPath=True)[0]
+        self.assertFalse(mayaUsd.ufe.ufePathToPrim(childPathString))
+        renamedPrim = mayaUsd.ufe.ufePathToPrim('%s,/Parent/Child' % renamedShape)
+        self.assertTrue(renamedPrim)
+        self.assertEqual(renamedPrim.GetStage(), stage)
+
+        # A removed proxy shape no longer resolves.
+        cmds.delete(renamedTransform)
+        self.assertFalse(mayaUsd.ufe.ufePathToPrim('%s,/Parent/Child' % renamedShape))
+        self.assertEqual(len(mayaUsd.ufe.getAllStages()), 0)
+
+        cmds.file(new=True, force=True)
+
     # In Maya 2022, undo does not restore the stage.  To be
     # investigated as needed.
     @unittest.skipUnless(mayaUtils.mayaMajorVersion() == 2023, 'Only supported in Maya 2023 or greater.')
@@ -0,0 +1,112 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+"""
+Micro-benchmark for UFE path to USD prim resolution.
+
+Resolves UFE paths to prims through ufe.Hierarchy and mayaUsd.ufe and writes
+the elapsed times with perfStatsUtils. Set MAYAUSD_PERF_SCALE to change the
+number of resolved paths.
+"""
+
+import fixturesUtils
+import mayaUtils
+import perfStatsUtils
+
+import mayaUsd
+
+from maya import cmds
+from maya import standalone
+
+from pxr import Tf
+
+import ufe
+
+import os
+import unittest
+
+
+class testUfePathToPrimPerformance(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.readOnlySetUpClass(__file__, loadPlugin=False)
+        cls._testDir = os.path.abspath('.')
+        cls._perfStats = perfStatsUtils.PerfStats(cls.__name__, cls._testDir)
+
+    @classmethod
+    def tearDownClass(cls):
+        cls._perfStats.write()
+
+        standalone.uninitialize()
+
+    def setUp(self):
+        self.assertTrue(mayaUtils.isMayaUsdPluginLoaded())
+        cmds.file(new=True, force=True)
+
+    def testResolvePaths(self):
+        import mayaUsd_createStageWithNewLayer
+        proxyShape = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.ufe.getStage(proxyShape)
+
+        # A few thousand distinct prims, a few levels deep.
+        primPaths = []
+        for i in range(20):
+            for j in range(20):
+                for k in range(10):
+                    primPath = '/Group%d/Asset%d/Part%d' % (i, j, k)
+                    stage.DefinePrim(primPath, 'Xform')
+                    primPaths.append(primPath)
+
+        pathStrings = ['%s,%s' % (proxyShape, primPath) for primPath in primPaths]
+        ufePaths = [ufe.PathString.path(pathString) for pathString in pathStrings]
+
+        resolveCount = perfStatsUtils.scaled(1000000, len(primPaths))
+
+        stopwatch = Tf.Stopwatch()
+        stopwatch.Start()
+        for index in range(resolveCount):
+            prim = mayaUsd.ufe.ufePathToPrim(pathStrings[index % len(pathStrings)])
+        stopwatch.Stop()
+        self.assertTrue(prim)
+        self._perfStats.addTime('ufePathToPrim', stopwatch.seconds, resolveCount)
+
+        stopwatch.Reset()
+        stopwatch.Start()
+        for index in range(resolveCount):
+            item = ufe.Hierarchy.createItem(ufePaths[index % len(ufePaths)])
+        stopwatch.Stop()
+        self.assertTrue(item)
+        self._perfStats.addTime('Hierarchy.createItem', stopwatch.seconds, resolveCount)
+
+        # Resolve again after an edit that resyncs part of the stage.
+        stage.GetPrimAtPath('/Group0').SetActive(False)
+        stopwatch.Reset()
+        stopwatch.Start()
+        for pathString in pathStrings:
+            prim = mayaUsd.ufe.ufePathToPrim(pathString)
+        stopwatch.Stop()
+        self.assertTrue(prim)
+        self.assertFalse(mayaUsd.ufe.ufePathToPrim(pathStrings[0]))
+        self._perfStats.addTime('ufePathToPrim after resync', stopwatch.seconds, len(pathStrings))
+
+        cmds.file(new=True, force=True)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
@@ -64,6 +64,38 @@ class testUsdExportAnimation(unittest.TestCase):
             num_samples = attr.GetNumTimeSamples()
             self.assertEqual(num_samples, int(not state))
 
+    def testExportStaticAndAnimatedPrims(self):
+        """Static prims are not written at each time sample, make sure the
+           animated ones still are."""
+        cmds.file(new=True, force=True)
+        cmds.polyCube(name="StaticCube")
+
+        cmds.polyCube(name="VisibilityCube")
+        cmds.setKeyframe("VisibilityCube", v=1, at='visibility', time=1)
+        cmds.setKeyframe("VisibilityCube", v=0, at='visibility', time=5)
+
+        cmds.polyCube(name="UserAttrCube")
+        cmds.addAttr("UserAttrCube", ln="TestFloat", at="float", keyable=True)
+        cmds.setKeyframe("UserAttrCube", v=0.0, at='TestFloat', time=1)
+        cmds.setKeyframe("UserAttrCube", v=10.0, at='TestFloat', time=10)
+        cmds.addAttr("UserAttrCube", ln="USD_UserExportedAttributesJson", dt="string")
+        cmds.setAttr("UserAttrCube.USD_UserExportedAttributesJson", '{"TestFloat": {}}', type="string")
+
+        path = os.path.join(self.temp_dir, "staticAndAnimatedPrims.usda")
+        cmds.mayaUSDExport(f=path, frameRange=(1, 10))
+
+        stage = Usd.Stage.Open(path)
+
+        prim = stage.GetPrimAtPath("/StaticCube")
+        self.assertEqual(prim.GetAttribute("visibility").GetNumTimeSamples(), 0)
+        self.assertEqual(prim.GetChild("StaticCubeShape").GetAttribute("points").GetNumTimeSamples(), 0)
+
+        prim = stage.GetPrimAtPath("/VisibilityCube")
+        self.assertGreater(prim.GetAttribute("visibility").GetNumTimeSamples(), 1)
+
+        prim = stage.GetPrimAtPath("/UserAttrCube")
+        self.assertGreater(prim.GetAttribute("userProperties:TestFloat").GetNumTimeSamples(), 1)
+
     def testExportAnimatedCompundValue(self):
         """MayaUSD Issue #1712: Test that animated custom compound attributes
            on a mesh are exported."""
@@ -128,5 +128,89 @@ class TestUsdExportBlendshapes(unittest.TestCase):
         self.assertEqual(blendShapes[0].GetName(), "tgt1")
         self.assertEqual(blendShapes[1].GetName(), "tgt0")
 
+    def testBlendShapesExportPrunesZeroOffsets(self):
+        """Offsets that do not move a component are not exported, so that the
+        pointIndices of the target stay sparse."""
+        om.MFileIO.newFile(True)
+        parent = cmds.group(name="root", empty=True)
+        base, _ = cmds.polyCube(name="base")
+        cmds.parent(base, parent)
+        target, _ = cmds.polyCube(name="blend")
+        cmds.parent(target, parent)
+        cmds.polyMoveVertex('{}.vtx[0]'.format(target), t=(0.0, 1.0, 0.0))
+        cmds.polyMoveVertex('{}.vtx[1:7]'.format(target), t=(0.0, 1e-7, 0.0))
+
+        cmds.blendShape(target, base, automatic=True)
+
+        cmds.select(base, replace=True)
+        temp_file = os.path.join(self.temp_dir, 'blendshapePruned.usda')
+        cmds.mayaUSDExport(f=temp_file, v=True, sl=True, ebs=True, skl="auto")
+
+        stage = Usd.Stage.Open(temp_file)
+        blendShape = UsdSkel.BlendShape(stage.GetPrimAtPath("/root/base/blend"))
+        indices = blendShape.GetPointIndicesAttr().Get()
+        offsets = blendShape.GetOffsetsAttr().Get()
+        normalOffsets = blendShape.GetNormalOffsetsAttr().Get()
+
+        self.assertIn(0, indices)
+        self.assertEqual(len(indices), len(offsets))
+        self.assertEqual(len(indices), len(normalOffsets))
+        for offset, normalOffset in zip(offsets, normalOffsets):
+            self.assertTrue(offset.GetLength() > 1e-5 or normalOffset.GetLength() > 1e-5)
+
+    def testBlendShapesExportSkipsPrunedTargets(self):
+        """A target whose offsets are all below the blendShapeOffsetTolerance
+        is not exported."""
+        om.MFileIO.newFile(True)
+        parent = cmds.group(name="root", empty=True)
+        base, _ = cmds.polyCube(name="base")
+        cmds.parent(base, parent)
+        target, _ = cmds.polyCube(name="blend")
+        cmds.parent(target, parent)
+        cmds.polyMoveVertex('{}.vtx[0]'.format(target), t=(0.0, 1.0, 0.0))
+
+        cmds.blendShape(target, base, automatic=True)
+
+        cmds.select(base, replace=True)
+        temp_file = os.path.join(self.temp_dir, 'blendshapeSkipped.usda')
+        cmds.mayaUSDExport(f=temp_file, v=True, sl=True, ebs=True, skl="auto",
+                           blendShapeOffsetTolerance=10.0)
+
+        stage = Usd.Stage.Open(temp_file)
+        self.assertTrue(stage.GetPrimAtPath("/root/base"))
+        self.assertFalse(stage.GetPrimAtPath("/root/base/blend"))
+
+    def testBlendShapesExportSkipsMismatchedTargets(self):
+        """A target whose vertex count differs from its base mesh is not
+        exported, rather than exported with point indices but no offsets."""
+        om.MFileIO.newFile(True)
+        parent = cmds.group(name="root", empty=True)
+        base, _ = cmds.polyCube(name="base")
+        cmds.parent(base, parent)
+        target, _ = cmds.polyCube(name="blend")
+        cmds.parent(target, parent)
+        cmds.polyMoveVertex('{}.vtx[0]'.format(target), t=(0.0, 1.0, 0.0))
+
+        cmds.blendShape(target, base, automatic=True)
+
+        # Change the topology of the target once the blendshape is set up.
+        cmds.polySubdivideFacet(target, divisions=1)
+
+        cmds.select(base, replace=True)
+        temp_file = os.path.join(self.temp_dir, 'blendshapeMismatched.usda')
+        cmds.mayaUSDExport(f=temp_file, v=True, sl=True, ebs=True, skl="auto")
+
+        stage = Usd.Stage.Open(temp_file)
+        self.assertTrue(stage.GetPrimAtPath("/root/base"))
+        self.assertFalse(stage.GetPrimAtPath("/root/base/blend"))
+
+        for prim in stage.Traverse():
+            if not prim.IsA(UsdSkel.BlendShape):
+                continue
+            blendShape = UsdSkel.BlendShape(prim)
+            numIndices = len(blendShape.GetPointIndicesAttr().Get() or [])
+            self.assertEqual(numIndices, len(blendShape.GetOffsetsAttr().Get() or []))
+            self.assertEqual(numIndices, len(blendShape.GetNormalOffsetsAttr().Get() or []))
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
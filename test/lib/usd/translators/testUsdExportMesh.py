@@ -15,6 +15,7 @@
 # limitations under the License.
 #
 
+import json
 import os
 import unittest
 
@@ -185,6 +186,31 @@ class testUsdExportMesh(unittest.TestCase):
                 elif sidedness == 'double':
                     self.assertTrue(value, "Incorrect double sidedness value")
 
+    def testExportProfileReport(self):
+        """The profile report lists the time spent in each prim writer."""
+        cmds.file(new=True, force=True)
+        cmds.polyCube()
+
+        output = os.path.join(self.temp_dir, 'profileReport.usda')
+        cmds.mayaUSDExport(file=output, profileReport=True)
+
+        reportFile = output + '.profile.json'
+        self.assertTrue(os.path.isfile(reportFile))
+        with open(reportFile) as f:
+            report = json.load(f)
+
+        meshWriters = [t for t in report['translators']
+            if t['name'].startswith('Prim writer Mesh')]
+        self.assertEqual(len(meshWriters), 1)
+        self.assertEqual(meshWriters[0]['count'], 1)
+        for key in ('total', 'mean', 'p95'):
+            self.assertGreaterEqual(meshWriters[0][key], 0.0)
+
+        # Without the flag, no report is written.
+        os.remove(reportFile)
+        cmds.mayaUSDExport(file=output)
+        self.assertFalse(os.path.isfile(reportFile))
+
 
 
 
@@ -56,6 +56,71 @@ class TestUsdExportSkin(unittest.TestCase):
         grp = build_scene()
         self.assertRaises(RuntimeError, cmds.mayaUSDExport, file="Does_not_export.usdc", skn="auto", skl="auto")
 
+    def test_exportSkinMaxInfluences(self):
+        """Influences above the cap are dropped and the remaining weights renormalized"""
+        cmds.file(f=1, new=1)
+        root = cmds.joint(p=(0, -1, 0))
+        cmds.joint(p=(0, 0, 0))
+        cmds.joint(p=(0, 1, 0))
+        cube = cmds.polyCube(sy=4)[0]
+        cmds.select(root, add=1)
+        cmds.group()
+        cmds.skinCluster(root, cube, maximumInfluences=3, toSelectedBones=False)
+
+        usdFile = os.path.abspath('UsdExportSkinMaxInfluences.usda')
+        cmds.mayaUSDExport(file=usdFile, skn="auto", skl="auto", maxSkinInfluences=1)
+
+        stage = Usd.Stage.Open(usdFile)
+        binding = UsdSkel.BindingAPI(stage.GetPrimAtPath('/group1/pCube1'))
+        weightsPrimvar = binding.GetJointWeightsPrimvar()
+        self.assertEqual(weightsPrimvar.GetElementSize(), 1)
+        for weight in weightsPrimvar.Get():
+            self.assertAlmostEqual(weight, 1.0, places=5)
+
+    def test_exportSkinRigid(self):
+        """A mesh bound to a single joint gets constant joint influences"""
+        cmds.file(f=1, new=1)
+        root = cmds.joint()
+        cube = cmds.polyCube()[0]
+        cmds.select(root, add=1)
+        cmds.group()
+        cmds.skinCluster(root, cube)
+
+        usdFile = os.path.abspath('UsdExportSkinRigid.usda')
+        cmds.mayaUSDExport(file=usdFile, skn="auto", skl="auto")
+
+        stage = Usd.Stage.Open(usdFile)
+        binding = UsdSkel.BindingAPI(stage.GetPrimAtPath('/group1/pCube1'))
+        self.assertTrue(binding.GetJointIndicesPrimvar().IsDefined())
+        self.assertEqual(
+            binding.GetJointIndicesPrimvar().GetInterpolation(), UsdGeom.Tokens.constant)
+        self.assertEqual(binding.GetJointIndicesPrimvar().Get(), Vt.IntArray([0]))
+        self.assertEqual(binding.GetJointWeightsPrimvar().Get(), Vt.FloatArray([1.0]))
+
+    def test_exportSkinNegativeWeights(self):
+        """Negative weights are exported like the positive ones"""
+        cmds.file(f=1, new=1)
+        root = cmds.joint(p=(0, -1, 0))
+        cmds.joint(p=(0, 1, 0))
+        cube = cmds.polyCube()[0]
+        cmds.select(root, add=1)
+        cmds.group()
+        skin = cmds.skinCluster(root, cube, toSelectedBones=False, normalizeWeights=0)[0]
+        cmds.setAttr('%s.weightList[0].weights[0]' % skin, -0.5)
+        cmds.setAttr('%s.weightList[0].weights[1]' % skin, 1.5)
+
+        usdFile = os.path.abspath('UsdExportSkinNegativeWeights.usda')
+        cmds.mayaUSDExport(file=usdFile, skn="auto", skl="auto")
+
+        stage = Usd.Stage.Open(usdFile)
+        binding = UsdSkel.BindingAPI(stage.GetPrimAtPath('/group1/pCube1'))
+        weightsPrimvar = binding.GetJointWeightsPrimvar()
+        elementSize = weightsPrimvar.GetElementSize()
+        self.assertEqual(elementSize, 2)
+        firstPointWeights = sorted(weightsPrimvar.Get()[0:elementSize])
+        self.assertAlmostEqual(firstPointWeights[0], -0.5, places=5)
+        self.assertAlmostEqual(firstPointWeights[1], 1.5, places=5)
+
 
 if __name__ == '__main__':
     unittest.main(verbosity=2)
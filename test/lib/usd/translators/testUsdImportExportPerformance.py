@@ -0,0 +1,263 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+"""
+Headless throughput benchmark for mayaUSDExport and mayaUSDImport.
+
+Each test builds a synthetic scene, exports it, then imports the result back
+into an empty scene. The wall-clock time of each command, the time spent in
+each phase of UsdMaya_WriteJob and UsdMaya_ReadJob (gathered from their trace
+scopes) and the peak resident set size are recorded with perfStatsUtils.
+"""
+
+from maya import cmds
+from maya import standalone
+
+from pxr import Tf
+from pxr import Trace
+from pxr import Usd
+
+import contextlib
+import os
+import unittest
+
+try:
+    import resource
+except ImportError:
+    resource = None
+
+import fixturesUtils
+import perfStatsUtils
+
+
+_WRITE_JOB_PHASES = [
+    'UsdMaya_WriteJob::Write',
+    'UsdMaya_WriteJob::_BeginWriting',
+    'UsdMaya_WriteJob::_WriteFrame',
+    'UsdMaya_WriteJob::_FinishWriting',
+    'UsdMaya_WriteJob::_PruneEmpties',
+    'UsdMaya_WriteJob::Save',
+]
+
+_READ_JOB_PHASES = [
+    'UsdMaya_ReadJob::Read',
+    'UsdMaya_ReadJob::_DoImport',
+]
+
+
+def _GetPeakRssKilobytes():
+    """
+    Returns the peak resident set size of the process in kilobytes, or None
+    when the platform does not report it.
+    """
+    if resource is None:
+        return None
+    peak = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # ru_maxrss is reported in bytes on macOS and in kilobytes on Linux.
+    if os.uname()[0] == 'Darwin':
+        peak //= 1024
+    return peak
+
+
+def _GatherPhaseTimes(node, phaseNames, phaseTimes):
+    """
+    Walks the aggregate trace tree and accumulates the inclusive time (in
+    seconds) and call count of every scope named in phaseNames.
+    """
+    key = str(node.key)
+    if key in phaseNames:
+        elapsed, count = phaseTimes.get(key, (0.0, 0))
+        # Aggregate node times are reported in milliseconds.
+        phaseTimes[key] = (elapsed + node.inclusiveTime / 1000.0, count + node.count)
+    for child in node.children:
+        _GatherPhaseTimes(child, phaseNames, phaseTimes)
+
+
+class testUsdImportExportPerformance(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__)
+
+        cls._testDir = os.path.abspath('.')
+
+        cls._perfStats = perfStatsUtils.PerfStats(cls.__name__, cls._testDir)
+
+    @classmethod
+    def tearDownClass(cls):
+        cls._perfStats.write()
+
+        standalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+    @contextlib.contextmanager
+    def _ProfileScope(self, profileScopeName, phaseNames):
+        """
+        A context manager that measures the execution time between enter and
+        exit, along with the time spent in each of the given job phases, and
+        records them in the class' stats.
+        """
+        stopwatch = Tf.Stopwatch()
+        collector = Trace.Collector()
+        reporter = Trace.Reporter.globalReporter
+
+        collector.Clear()
+        reporter.ClearTree()
+        try:
+            stopwatch.Start()
+            collector.enabled = True
+            yield
+        finally:
+            collector.enabled = False
+            stopwatch.Stop()
+
+            self._perfStats.addTime(profileScopeName, stopwatch.seconds)
+
+            if hasattr(reporter, 'UpdateTraceTrees'):
+                reporter.UpdateTraceTrees()
+            else:
+                reporter.UpdateAggregateTree()
+            phaseTimes = dict()
+            _GatherPhaseTimes(reporter.aggregateTreeRoot, phaseNames, phaseTimes)
+            for phaseName in phaseNames:
+                elapsed, count = phaseTimes.get(phaseName, (0.0, 0))
+                self._perfStats.add('%s %s' % (profileScopeName, phaseName), 'time', elapsed,
+                    count)
+
+            peakRss = _GetPeakRssKilobytes()
+            if peakRss is not None:
+                self._perfStats.add(profileScopeName, 'peak_rss_kb', peakRss)
+
+            collector.Clear()
+            reporter.ClearTree()
+
+    def _RunExportImport(self, testName, **exportArgs):
+        """
+        Exports the current scene, then imports the result into a new scene,
+        profiling both commands. Returns the exported stage.
+        """
+        usdFilePath = os.path.join(self._testDir, '%s.usdc' % testName)
+
+        with self._ProfileScope('%s Export' % testName, _WRITE_JOB_PHASES):
+            cmds.mayaUSDExport(file=usdFilePath, **exportArgs)
+
+        cmds.file(new=True, force=True)
+
+        with self._ProfileScope('%s Import' % testName, _READ_JOB_PHASES):
+            cmds.mayaUSDImport(file=usdFilePath, readAnimData=True)
+
+        stage = Usd.Stage.Open(usdFilePath)
+        self.assertTrue(stage)
+        return stage
+
+    def testDenseMesh(self):
+        subdivisions = perfStatsUtils.scaled(400, 2)
+        cmds.polyPlane(name='DenseMesh', width=100, height=100,
+            subdivisionsX=subdivisions, subdivisionsY=subdivisions)
+
+        stage = self._RunExportImport('DenseMesh')
+
+        self.assertTrue(stage.GetPrimAtPath('/DenseMesh'))
+
+    def testDeepHierarchy(self):
+        depth = perfStatsUtils.scaled(200)
+        breadth = perfStatsUtils.scaled(20)
+        for branch in range(breadth):
+            parent = None
+            for level in range(depth):
+                name = 'Branch%d_Level%d' % (branch, level)
+                if parent:
+                    parent = cmds.group(empty=True, name=name, parent=parent)
+                else:
+                    parent = cmds.group(empty=True, name=name)
+            cmds.spaceLocator(name='Branch%d_Leaf' % branch)
+            cmds.parent('Branch%d_Leaf' % branch, parent)
+
+        stage = self._RunExportImport('DeepHierarchy')
+
+        self.assertTrue(stage.GetPrimAtPath('/Branch0_Level0'))
+
+    def testManyMaterials(self):
+        materialCount = perfStatsUtils.scaled(500)
+        for index in range(materialCount):
+            shape = cmds.polyCube(name='Cube%d' % index)[0]
+            cmds.move(index * 2.0, 0, 0, shape)
+            material = cmds.shadingNode('lambert', asShader=True,
+                name='Material%d' % index)
+            cmds.setAttr('%s.color' % material,
+                (index % 7) / 7.0, (index % 11) / 11.0, (index % 13) / 13.0,
+                type='double3')
+            shadingEngine = cmds.sets(renderable=True, noSurfaceShader=True,
+                empty=True, name='Material%dSG' % index)
+            cmds.connectAttr('%s.outColor' % material,
+                '%s.surfaceShader' % shadingEngine)
+            cmds.sets(shape, edit=True, forceElement=shadingEngine)
+
+        stage = self._RunExportImport('ManyMaterials',
+            shadingMode='useRegistry', convertMaterialsTo=['UsdPreviewSurface'])
+
+        self.assertTrue(stage.GetPrimAtPath('/Cube0'))
+
+    def testSkinnedCharacter(self):
+        jointCount = perfStatsUtils.scaled(60, 2)
+        height = float(jointCount)
+
+        body = cmds.polyCylinder(name='Body', height=height, radius=2,
+            subdivisionsX=perfStatsUtils.scaled(64, 3), subdivisionsY=jointCount * 4)[0]
+        cmds.move(0, height / 2.0, 0, body)
+
+        cmds.select(clear=True)
+        joints = [cmds.joint(name='Joint%d' % index, position=(0, index, 0))
+            for index in range(jointCount)]
+        cmds.skinCluster(joints, body, maximumInfluences=4)
+
+        frameCount = perfStatsUtils.scaled(48, 2)
+        for index, joint in enumerate(joints[1:]):
+            cmds.setKeyframe(joint, attribute='rotateZ', time=1, value=0)
+            cmds.setKeyframe(joint, attribute='rotateZ', time=frameCount,
+                value=(index % 5) * 2.0)
+
+        cmds.group(body, joints[0], name='Character')
+
+        stage = self._RunExportImport('SkinnedCharacter',
+            exportSkels='auto', exportSkin='auto',
+            frameRange=(1, frameCount))
+
+        self.assertTrue(stage.GetPrimAtPath('/Character'))
+
+    def testLongAnimation(self):
+        objectCount = perfStatsUtils.scaled(100)
+        frameCount = perfStatsUtils.scaled(500, 2)
+        for index in range(objectCount):
+            shape = cmds.polySphere(name='Ball%d' % index,
+                subdivisionsX=8, subdivisionsY=8)[0]
+            cmds.setKeyframe(shape, attribute='translateY', time=1, value=0)
+            cmds.setKeyframe(shape, attribute='translateY', time=frameCount,
+                value=float(index))
+            cmds.setKeyframe(shape, attribute='rotateY', time=1, value=0)
+            cmds.setKeyframe(shape, attribute='rotateY', time=frameCount,
+                value=360.0)
+
+        stage = self._RunExportImport('LongAnimation', frameRange=(1, frameCount))
+
+        self.assertEqual(stage.GetEndTimeCode(), frameCount)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
@@ -15,12 +15,13 @@
 # limitations under the License.
 #
 
-from pxr import UsdGeom
+from pxr import Sdf, Usd, UsdGeom
 
 import mayaUsd.lib as mayaUsdLib
 
 from maya import cmds
 from maya import standalone
+from maya.api import OpenMaya as OM
 
 import os
 import unittest
@@ -93,5 +94,110 @@ class testUsdImportMesh(unittest.TestCase):
     def testImportLeftHandedSubdiv(self):
         self.verifySubdivCommonAttributes('LeftHandedSubdivMeshShape')
 
+    def testImportManyMeshes(self):
+        """
+        Imports more meshes than fit in a prefetch batch. When the
+        testUsdImportMeshPrefetch test turns the prefetching on, their topology
+        and points are read ahead of time on worker threads. Some meshes are
+        under their own transform, whose children are only prefetched because
+        the transform reader does not prune them.
+        """
+        stage = Usd.Stage.CreateInMemory()
+        UsdGeom.Xform.Define(stage, '/PrefetchRoot')
+        meshCount = 150
+        for i in range(meshCount):
+            parentPath = '/PrefetchRoot'
+            if i % 3 == 0:
+                parentPath = '/PrefetchRoot/PrefetchGroup_%d' % i
+                UsdGeom.Xform.Define(stage, parentPath)
+            mesh = UsdGeom.Mesh.Define(stage, '%s/PrefetchMesh_%d' % (parentPath, i))
+            mesh.CreatePointsAttr([(i, 0, 0), (i + 1, 0, 0), (i + 1, 1, 0), (i, 1, 0)])
+            mesh.CreateFaceVertexCountsAttr([4])
+            mesh.CreateFaceVertexIndicesAttr([0, 1, 2, 3])
+            if i % 2:
+                mesh.CreateOrientationAttr(UsdGeom.Tokens.leftHanded)
+
+        cmds.mayaUSDImport(file=stage.GetRootLayer().identifier,
+            primPath='/PrefetchRoot', shadingMode=[['none', 'default'], ])
+
+        for i in range(meshCount):
+            shapeName = 'PrefetchMesh_%dShape' % i
+            self.assertTrue(cmds.objExists(shapeName))
+
+            selection = OM.MSelectionList()
+            selection.add(shapeName)
+            meshFn = OM.MFnMesh(selection.getDagPath(0))
+            self.assertEqual(meshFn.numVertices, 4)
+            self.assertEqual(meshFn.numPolygons, 1)
+            self.assertAlmostEqual(meshFn.getPoint(0).x, i)
+
+            # Left-handed faces are reversed to match Maya's winding order.
+            expectedVertices = [3, 2, 1, 0] if i % 2 else [0, 1, 2, 3]
+            self.assertEqual(list(meshFn.getPolygonVertices(0)), expectedVertices)
+
+    def testImportPrimvarsAndCreases(self):
+        """
+        Imports a mesh with several UV and color set primvars of different
+        interpolations along with edge creases, which share the face-vertex
+        topology and edge lookup computed once for the mesh.
+        """
+        stage = Usd.Stage.CreateInMemory()
+        UsdGeom.Xform.Define(stage, '/CreaseRoot')
+        mesh = UsdGeom.Mesh.Define(stage, '/CreaseRoot/CreasedMesh')
+        mesh.CreatePointsAttr([(0, 0, 0), (1, 0, 0), (2, 0, 0),
+                               (0, 1, 0), (1, 1, 0), (2, 1, 0)])
+        mesh.CreateFaceVertexCountsAttr([4, 4])
+        mesh.CreateFaceVertexIndicesAttr([0, 1, 4, 3, 1, 2, 5, 4])
+        mesh.CreateSubdivisionSchemeAttr(UsdGeom.Tokens.catmullClark)
+
+        # The shared edge is authored in reverse vertex order on purpose.
+        mesh.CreateCreaseLengthsAttr([2, 3])
+        mesh.CreateCreaseIndicesAttr([4, 1, 0, 1, 2])
+        mesh.CreateCreaseSharpnessesAttr([2.0, 1.0])
+
+        primvarsApi = UsdGeom.PrimvarsAPI(mesh)
+        faceVaryingUVs = primvarsApi.CreatePrimvar('st',
+            Sdf.ValueTypeNames.TexCoord2fArray, UsdGeom.Tokens.faceVarying)
+        faceVaryingUVs.Set([(fvi / 8.0, 0.0) for fvi in range(8)])
+        vertexUVs = primvarsApi.CreatePrimvar('vertexUV',
+            Sdf.ValueTypeNames.TexCoord2fArray, UsdGeom.Tokens.vertex)
+        vertexUVs.Set([(0.0, vertexId / 6.0) for vertexId in range(6)])
+        uniformColors = primvarsApi.CreatePrimvar('uniformColor',
+            Sdf.ValueTypeNames.Color3fArray, UsdGeom.Tokens.uniform)
+        uniformColors.Set([(1, 0, 0), (0, 1, 0)])
+
+        cmds.mayaUSDImport(file=stage.GetRootLayer().identifier,
+            primPath='/CreaseRoot', shadingMode=[['none', 'default'], ])
+
+        selection = OM.MSelectionList()
+        selection.add('CreasedMeshShape')
+        meshFn = OM.MFnMesh(selection.getDagPath(0))
+
+        faceVertexIds = [(0, 0, 0), (0, 1, 1), (0, 2, 4), (0, 3, 3),
+                         (1, 0, 1), (1, 1, 2), (1, 2, 5), (1, 3, 4)]
+        for fvi, (faceId, localId, vertexId) in enumerate(faceVertexIds):
+            u, v = meshFn.getPolygonUV(faceId, localId, 'map1')
+            self.assertAlmostEqual(u, fvi / 8.0)
+            u, v = meshFn.getPolygonUV(faceId, localId, 'vertexUV')
+            self.assertAlmostEqual(v, vertexId / 6.0)
+
+        colors = meshFn.getFaceVertexColors('uniformColor')
+        for fvi, (faceId, _, _) in enumerate(faceVertexIds):
+            self.assertAlmostEqual(colors[fvi].r, 1.0 - faceId)
+            self.assertAlmostEqual(colors[fvi].g, float(faceId))
+
+        creaseEdges = dict()
+        for creaseSet in cmds.ls(type='creaseSet'):
+            members = cmds.ls(cmds.sets(creaseSet, query=True), flatten=True)
+            for member in members:
+                if not member.startswith('CreasedMeshShape.e['):
+                    continue
+                edgeId = int(member[len('CreasedMeshShape.e['):-1])
+                edgeVertices = tuple(sorted(meshFn.getEdgeVertices(edgeId)))
+                creaseEdges[edgeVertices] = cmds.getAttr(
+                    '%s.creaseLevel' % creaseSet)
+
+        self.assertEqual(creaseEdges, {(1, 4): 2.0, (0, 1): 1.0, (1, 2): 1.0})
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -20,6 +20,10 @@ import os
 import unittest
 from maya import cmds, standalone
 
+from pxr import Gf
+from pxr import Usd
+from pxr import UsdGeom
+
 
 class testUsdImportPointCache(unittest.TestCase):
 
@@ -71,5 +75,35 @@ class testUsdImportPointCache(unittest.TestCase):
         vtx = cmds.pointPosition(nodeName + '.vtx[1]')
         self.assertAlmostEqual(vtx[0], 13.99111366)
 
+    def testImportCurvePointCache(self):
+        """Test that animated curve points are streamed by a point based
+        deformer instead of being baked into blend shape targets."""
+
+        cmds.file(f=True, new=True)
+
+        usdFile = os.path.join(self.temp_dir, 'curvePointCache.usda')
+        stage = Usd.Stage.CreateNew(usdFile)
+        curve = UsdGeom.NurbsCurves.Define(stage, '/curve')
+        curve.CreateCurveVertexCountsAttr([3])
+        curve.CreateOrderAttr([2])
+        curve.CreateKnotsAttr([0, 0, 1, 2, 2])
+        pointsAttr = curve.CreatePointsAttr()
+        for frame in range(1, 11):
+            pointsAttr.Set([Gf.Vec3f(0, 0, 0), Gf.Vec3f(1, frame, 0), Gf.Vec3f(2, 0, 0)], frame)
+        stage.GetRootLayer().Save()
+
+        cmds.mayaUSDImport(file=usdFile, readAnimData=True, useAsAnimationCache=True)
+
+        nodeName = 'usdPointBasedDeformerNode_curve'
+        self.assertTrue(cmds.objExists(nodeName))
+        self.assertEqual(cmds.getAttr(nodeName + '.primPath'), '/curve')
+        self.assertFalse(cmds.ls(type='blendShape'))
+
+        cmds.currentTime(1)
+        self.assertAlmostEqual(cmds.pointPosition('curve.cv[1]')[1], 1.0)
+
+        cmds.currentTime(7)
+        self.assertAlmostEqual(cmds.pointPosition('curve.cv[1]')[1], 7.0)
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
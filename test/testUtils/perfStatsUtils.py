@@ -0,0 +1,78 @@
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+"""
+    Helper utilities shared by the performance tests.
+
+    Each test writes its stats, one JSON object per line, to its own
+    <testName>.perfStats.raw file, in the format used by the pxrUsdMayaGL
+    performance tests. The files are written to the test directory, or to
+    MAYAUSD_PERF_STATS_DIR when it is set. MAYAUSD_PERF_SCALE grows or shrinks
+    the data the tests work on.
+"""
+
+from pxr import Tf
+
+import json
+import os
+
+def getScale():
+    '''
+    Returns the factor by which to scale the size of the data of the tests.
+    '''
+    try:
+        return max(float(os.environ.get('MAYAUSD_PERF_SCALE', '1')), 0.001)
+    except ValueError:
+        return 1.0
+
+def scaled(count, minimum=1):
+    '''
+    Returns the count scaled by getScale(), but never less than the minimum.
+    '''
+    return max(int(count * getScale()), minimum)
+
+def getStatsFilePath(testName, testDir):
+    '''
+    Returns the path of the file where the stats of the given test are written.
+    '''
+    statsDir = os.environ.get('MAYAUSD_PERF_STATS_DIR', testDir)
+    return os.path.join(statsDir, '%s.perfStats.raw' % testName)
+
+class PerfStats(object):
+    '''
+    Collects the stats of a performance test and writes them to the file of
+    that test.
+    '''
+    def __init__(self, testName, testDir):
+        self.filePath = getStatsFilePath(testName, testDir)
+        self._stats = []
+
+    def add(self, profileScopeName, metric, value, samples=1):
+        self._stats.append({
+            'profile': profileScopeName,
+            'metric': metric,
+            'value': value,
+            'samples': samples
+        })
+
+    def addTime(self, profileScopeName, seconds, samples=1):
+        self.add(profileScopeName, 'time', seconds, samples)
+        Tf.Status('%s: %f' % (profileScopeName, seconds))
+
+    def write(self):
+        statsOutput = os.linesep.join(json.dumps(stats) for stats in self._stats)
+        with open(self.filePath, 'w') as perfStatsFile:
+            perfStatsFile.write(statsOutput)